@@ -0,0 +1,234 @@
+/*
+    Bar graph display
+    https://github.com/DLehenbauer/arduino-midi-sound-module
+
+    Draws the real-time bar graph of voice amplitudes on the SSD1306 without blocking the main 'loop()'.
+
+    The bar graph remembers the height last drawn for each bar.  When a bar's height changes, only the
+    8px pages between the old and new heights are sent (typically 1 or 2 pages instead of all 8), and
+    bars whose height is unchanged are skipped entirely.
+
+    Each bar may also display a single pixel peak-hold marker above the bar, which is tracked in the
+    same manner as the bar height.
+
+    Bytes are pushed to the display one at a time by 'poll()', which returns immediately if the SPI
+    transfer of the previous byte has not yet completed.  This allows the main 'loop()' to interleave
+    MIDI dispatch with display updates at the granularity of a single byte, and to avoid suspending
+    the synth entirely when the DAC does not share the SPI bus with the display.
+*/
+
+#ifndef __BARGRAPH_H__
+#define __BARGRAPH_H__
+
+#include <stdint.h>
+#include "ssd1306.h"
+
+template <typename TDisplay>
+class BarGraph final {
+  public:
+    static constexpr uint8_t numBars = 16;
+    static constexpr uint8_t maxHeight = 63;            // Bars are drawn in the range [0..63]
+
+  private:
+    static constexpr uint8_t unknownHeight = 0xFF;      // Forces all 8 pages of a bar to be redrawn.
+    static constexpr uint8_t barWidth = 7;              // (The 8th column is left unset to space the bars.)
+    static constexpr uint8_t numCommandBytes = 6;
+
+    enum State : uint8_t {
+      State_Idle,                                       // No transfer in progress.  Look for a dirty bar.
+      State_Command,                                    // Sending the 'select()' command bytes in '_command'.
+      State_Data,                                       // Sending the 7 data bytes of the current page.
+    };
+
+    TDisplay& _display;
+
+    uint8_t _target[numBars];                           // Most recently requested height of each bar.
+    uint8_t _targetHold[numBars];                       // Most recently requested height of each peak-hold marker.
+    uint8_t _drawn[numBars];                            // Height of each bar on the display (once the current update completes).
+    uint8_t _drawnHold[numBars];                        // Height of each peak-hold marker on the display.
+    uint8_t _command[numCommandBytes];                  // Buffered 'select()' command for the current bar.
+
+    State   _state      = State_Idle;
+    bool    _busy       = false;                        // True if a byte was pushed and SPIF has not yet been observed.
+    bool    _selected   = false;                        // True if the display is selected (CS low) for the current state.
+    uint8_t _bar        = 0;                            // Bar being updated (or the last bar updated if idle.)
+    uint8_t _index      = 0;                            // Index of next command/data byte to send.
+    uint8_t _page       = 0;                            // Page currently being sent.
+    uint8_t _lastPage   = 0;                            // Last page to send for the current bar.
+    uint8_t _pageMask   = 0;                            // Pixel mask for the current page.
+
+    // Returns the page containing the top pixel of a bar of the given 'height'.
+    static uint8_t topPage(uint8_t height) {
+      return 7 - (height >> 3);
+    }
+
+    // Returns the 8px vertical pixel mask for the given 'page' of a bar of the given 'height' with a
+    // peak-hold marker at 'hold'.
+    static uint8_t pageMask(uint8_t page, uint8_t height, uint8_t hold) {
+      uint8_t mask = 0;
+      if (page == topPage(hold)) {                      // Set the pixel of the peak-hold marker, if it's on this page.
+        mask = 1 << (7 - (hold & 0x07));
+      }
+
+      const uint8_t top = topPage(height);
+      if (page < top) { return mask; }                  // Pages above the bar are clear,
+      if (page > top) { return 0xFF; }                  // pages below the bar are set,
+      return mask | ~((1 << (7 - (height & 0x07))) - 1);// and the page containing the top of the bar is partially set.
+    }
+
+    // Selects the display for the command or data bytes of the current state, if not already selected.
+    void select() {
+      if (!_selected) {
+        if (_state == State_Command) { _display.beginCommand(); } else { _display.beginData(); }
+        _selected = true;
+      }
+    }
+
+    // Deselects the display, if selected.  Must not be called while a byte is in flight.
+    void deselect() {
+      if (_selected) {
+        if (_state == State_Command) { _display.endCommand(); } else { _display.endData(); }
+        _selected = false;
+      }
+    }
+
+    static uint8_t min(uint8_t a, uint8_t b) { return a < b ? a : b; }
+    static uint8_t max(uint8_t a, uint8_t b) { return a > b ? a : b; }
+
+    // Searches for the next bar (in round-robin order) whose drawn height differs from its target.  If
+    // found, latches the new height and prepares the 'select()' command covering the pages that changed.
+    bool beginNextBar() {
+      for (uint8_t i = numBars; i > 0; i--) {
+        _bar = (_bar + 1) & (numBars - 1);
+
+        const uint8_t oldHeight = _drawn[_bar];
+        const uint8_t newHeight = _target[_bar];
+        const uint8_t oldHold = _drawnHold[_bar];
+        const uint8_t newHold = _targetHold[_bar];
+
+        if (oldHeight != newHeight || oldHold != newHold) {
+          uint8_t firstPage = 0;
+          uint8_t lastPage = 7;
+
+          if (oldHeight != unknownHeight) {             // If we know what is currently drawn, we only need to send the
+            const uint8_t oldTop = topPage(oldHeight);  // pages between the old and new top of the bar and marker.
+            const uint8_t newTop = topPage(newHeight);
+            const uint8_t oldHoldTop = topPage(oldHold);
+            const uint8_t newHoldTop = topPage(newHold);
+
+            firstPage = min(min(oldTop, newTop), min(oldHoldTop, newHoldTop));
+            lastPage = max(max(oldTop, newTop), max(oldHoldTop, newHoldTop));
+          }
+
+          _drawn[_bar] = newHeight;
+          _drawnHold[_bar] = newHold;
+          _page = firstPage;
+          _lastPage = lastPage;
+
+          const uint8_t x = _bar << 3;                  // Left edge of the bar.
+          _command[0] = Command_SetColumnAddr;
+          _command[1] = x;
+          _command[2] = x + (barWidth - 1);
+          _command[3] = Command_SetPageAddr;
+          _command[4] = firstPage;
+          _command[5] = lastPage;
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+  public:
+    BarGraph(TDisplay& display) : _display(display) {
+      for (int8_t bar = numBars - 1; bar >= 0; bar--) {
+        _target[bar] = 0;
+        _targetHold[bar] = 0;
+        _drawn[bar] = unknownHeight;
+        _drawnHold[bar] = unknownHeight;
+      }
+    }
+
+    // Sets the requested height of the given 'bar' and its peak-hold marker in the range [0..63].  The
+    // display is updated incrementally by subsequent calls to 'poll()'.
+    void set(uint8_t bar, uint8_t height, uint8_t hold) {
+      _target[bar] = height;
+      _targetHold[bar] = hold;
+    }
+
+    // Advances the display update by at most one byte.  Returns false if the previously pushed byte is
+    // still being transmitted or if there is nothing to update, otherwise returns true after pushing
+    // the next byte (without waiting for the transmission to complete).
+    bool poll() {
+      if (_busy) {
+        if (!_display.isIdle()) {                       // If the previous byte is still in flight, return
+          return false;                                 // immediately rather than busy wait.
+        }
+        _busy = false;
+      }
+
+      switch (_state) {
+        case State_Idle: {
+          if (!beginNextBar()) {
+            return false;
+          }
+          _index = 0;
+          _state = State_Command;                       // Continue below to send the first command byte.
+        }
+        // fall through
+
+        case State_Command: {
+          if (_index == numCommandBytes) {              // If all command bytes have been sent, switch to data.
+            deselect();
+            _index = 0;
+            _pageMask = pageMask(_page, _drawn[_bar], _drawnHold[_bar]);
+            _state = State_Data;
+          } else {
+            select();
+            _display.unsafe_send(_command[_index++]);
+            break;
+          }                                             // Continue below to send the first data byte.
+        }
+        // fall through
+
+        case State_Data: {
+          if (_index == barWidth) {                     // If all columns of the current page have been sent...
+            if (_page == _lastPage) {                   //   and this was the last page, the bar is complete.
+              deselect();
+              _state = State_Idle;
+              return false;
+            }
+            _page++;                                    //   Otherwise, advance to the next page.
+            _index = 0;
+            _pageMask = pageMask(_page, _drawn[_bar], _drawnHold[_bar]);
+          }
+          select();
+          _display.unsafe_send(_pageMask);
+          _index++;
+          break;
+        }
+      }
+
+      _busy = true;
+      return true;
+    }
+
+    // Busy waits until the byte most recently pushed by 'poll()' (if any) has finished transmitting.
+    // Used when the SPI bus is shared with the DAC, in which case the caller must not resume the
+    // audio ISR while a byte is still in flight.
+    void flush() {
+      if (_busy) {
+        _display.flush();
+        _busy = false;
+      }
+    }
+
+    // Deselects the display between bytes, so that the audio ISR can use a shared SPI bus without the
+    // display interpreting the DAC's bytes as commands or pixels.  Must be called after 'flush()' and
+    // before resuming the ISR.  (The next 'poll()' reselects the display before pushing a byte.)
+    void release() {
+      deselect();
+    }
+};
+
+#endif //__BARGRAPH_H__
@@ -0,0 +1,101 @@
+#!/bin/sh
+# Compile the Arduino MIDI Sound Module firmware with avr-gcc once for each DAC variant and report the
+# flash / SRAM used by each symbol, e.g.:
+#
+#   ./build-avr.sh                                  # All variants (see below)
+#   ./build-avr.sh Pwm01                            # A single variant
+#
+# The variants are the mono DACs (Pwm0, Pwm1, Pwm01, Ltc16xx) and the stereo DACs (Mcp4822, StereoPwm for
+# 'StereoPair<Pwm0, Pwm1>', and StereoLtc16xx for 'StereoPair<Ltc16xx<PinId::D10>, Pwm0>').
+#
+# The compiler options mirror the Release configuration of 'arduino-midi-sound-module.cppproj'.  Additional
+# options may be passed via 'DEFINES', e.g. for the instrumented build (see 'voicestats.h'):
+#
+#   DEFINES=-DVOICE_STATS ./build-avr.sh Pwm0
+#
+# The build fails if the SRAM remaining for the stack is less than the worst case stack depth plus
+# 'MIN_HEADROOM' bytes (default 128).  The worst case stack depth, including the nesting of the USART RX
+# ISR within the Timer2 ISR, is calculated from the disassembly by 'host/stackdepth.cpp' (built by
+# 'build-host.sh' if needed.)
+
+set -e
+
+SrcPath=$(cd "$(dirname "$0")" && pwd)
+OutPath=$SrcPath/avr-bin
+CXX=${CXX:-avr-g++}
+NM=${NM:-avr-nm}
+OBJDUMP=${OBJDUMP:-avr-objdump}
+StackDepth=$SrcPath/host/bin/stackdepth
+MIN_HEADROOM=${MIN_HEADROOM:-128}
+
+FlashSize=32768                                     # ATmega328P
+SramSize=2048
+
+if ! command -v "$CXX" > /dev/null; then
+  echo "Error: '$CXX' not found.  Install avr-gcc or set CXX." >&2
+  exit 1
+fi
+
+if [ ! -x "$StackDepth" ]; then
+  "$SrcPath/build-host.sh"
+fi
+
+if [ $# -eq 0 ]; then
+  set -- Pwm0 Pwm1 Pwm01 Ltc16xx Mcp4822 StereoPwm StereoLtc16xx
+fi
+
+mkdir -p "$OutPath"
+Failed=0
+
+for Variant in "$@"; do
+  case $Variant in
+    Ltc16xx)        Dac="Ltc16xx<PinId::D10>" ;;
+    Mcp4822)        Dac="Mcp4822<PinId::D10>" ;;
+    StereoPwm)      Dac="StereoPair<Pwm0,Pwm1>" ;;
+    StereoLtc16xx)  Dac="StereoPair<Ltc16xx<PinId::D10>,Pwm0>" ;;
+    *)              Dac=$Variant ;;
+  esac
+
+  Out=$OutPath/$Variant
+  mkdir -p "$Out"
+
+  $CXX -c -o "$Out/main.o" -mmcu=atmega328p -Os -std=c++14 -DF_CPU=16000000 -DNDEBUG "-DDAC=$Dac" $DEFINES \
+    -funsigned-char -funsigned-bitfields -fpack-struct -fshort-enums -ffunction-sections -fdata-sections \
+    -Wall -Werror -pedantic -pedantic-errors "$SrcPath/main.cpp"
+  $CXX -o "$Out/firmware.elf" -mmcu=atmega328p -Wl,--gc-sections "$Out/main.o" -lm
+
+  echo "== $Variant (DAC=$Dac) =="
+
+  # Symbols sorted by size.  Flash symbols are in .text (including PROGMEM), SRAM symbols in .data / .bss.
+  # (Initialized .data also occupies flash for its initial values.)
+  $NM -C -S --size-sort -r --format=sysv "$Out/firmware.elf" | awk -F '|' \
+    -v out="$Out/sram" -v flashSize=$FlashSize -v sramSize=$SramSize '
+    function hex(str,   value, i) {
+      value = 0
+      for (i = 1; i <= length(str); i++) { value = value * 16 + index("0123456789abcdef", tolower(substr(str, i, 1))) - 1 }
+      return value
+    }
+    NF >= 7 {
+      name = $1; size = $5; section = $7
+      sub(/ +$/, "", name); gsub(/ /, "", size); gsub(/ /, "", section)
+      if (size !~ /^[0-9a-fA-F]+$/) { next }              # (Skip headers and symbols without a size.)
+      size = hex(size)
+      if (section ~ /^\.text/)        { flash += size; if (numText < 15) { text[numText++] = sprintf("  %6d  %s", size, name) } }
+      else if (section ~ /^\.data/)   { flash += size; sram += size; ram[numRam++] = sprintf("  %6d  %s (.data)", size, name) }
+      else if (section ~ /^\.(bss|noinit)/) { sram += size; ram[numRam++] = sprintf("  %6d  %s", size, name) }
+    }
+    END {
+      printf "Flash: %6d / %d bytes\n", flash, flashSize
+      for (i = 0; i < numText; i++) print text[i]
+      printf "SRAM:  %6d / %d bytes\n", sram, sramSize
+      for (i = 0; i < numRam; i++) print ram[i]
+      print sram > out
+    }'
+
+  Sram=$(cat "$Out/sram")
+  $OBJDUMP -d "$Out/firmware.elf" | "$StackDepth" $((SramSize - Sram)) "$MIN_HEADROOM" || Failed=1
+
+  echo
+done
+
+exit $Failed
@@ -0,0 +1,69 @@
+#!/bin/sh
+# Compile the Arduino MIDI Sound Module firmware for the host (against the mock AVR environment) to
+# produce command line tools for private testing, e.g.:
+#
+#   ./build-host.sh && ./host/bin/render song.mid song.wav
+#   ./build-host.sh && ./host/bin/render -j 8 song.mid song.wav             # (Render 8 sections in parallel.)
+#   ./build-host.sh && ./host/bin/render -c 90 song.bin song.mid song.wav    # (Save a checkpoint at 90s.)
+#   ./build-host.sh && ./host/bin/render -r song.bin song.mid tail.wav       # (Render from the checkpoint.)
+#
+# To regenerate 'instruments_generated.h' and 'wavetable_generated.h' after editing 'instruments.txt':
+#
+#   ./build-host.sh && ./host/bin/instgen instruments.txt instruments_generated.h
+#   ./build-host.sh && ./host/bin/wavepack wavetable_generated.h
+#
+# To measure the throughput of the synth engine for each benchmark scenario, and compare the two layouts
+# of the per-voice state (see 'host/bench.cpp' and 'VoiceState' in 'synth.h'):
+#
+#   ./build-host.sh && ./host/bin/bench && ./host/bin/bench-records
+#   ./build-host.sh && ./host/bin/bench --json > bench.json
+#
+# To check the tuning of every note and pitch bend against the exact frequencies (see 'host/tuning.cpp'):
+#
+#   ./build-host.sh && ./host/bin/tuning
+#
+# To check 'Envelope::seek()' against sampling every envelope program step by step (see 'host/envseek.cpp'):
+#
+#   ./build-host.sh && ./host/bin/envseek
+#
+# To check that snapshots restore, and that corrupt snapshots are rejected (see 'host/snapshotcheck.cpp'):
+#
+#   ./build-host.sh && ./host/bin/snapshotcheck
+#
+# To decode the telemetry reports sent by firmware built with -DTELEMETRY to CSV:
+#
+#   ./build-host.sh && ./host/bin/telemetry capture.bin > capture.csv
+#
+# If simavr is installed (e.g., 'apt install libsimavr-dev'), also builds 'avrsim', which measures the
+# note-on latency, ISR duration and stack high-water mark of the AVR firmware built by 'build-avr.sh' on
+# a simulated ATmega328P (and the cycles per note-on with '-f'):
+#
+#   ./build-host.sh && ./host/bin/avrsim -d pwm0 avr-bin/Pwm0/firmware.elf
+#   ./build-host.sh && ./host/bin/avrsim -f _Z6noteOnhhh avr-bin/Pwm0/firmware.elf
+#
+# 'host/bin/stackdepth' is used by 'build-avr.sh' to check the worst case stack depth of the firmware.
+#
+# (The same tools are also built by the CMake build, see 'CMakeLists.txt'.)
+
+set -e
+
+SrcPath=$(cd "$(dirname "$0")" && pwd)
+OutPath=$SrcPath/host/bin
+CXX=${CXX:-c++}
+
+mkdir -p "$OutPath"
+$CXX -o "$OutPath/render" -O2 -std=c++14 -DF_CPU=16000000 -DVOICE_STATS -I"$SrcPath/emscripten" "$SrcPath/emscripten/avr/mocks.cpp" "$SrcPath/host/render.cpp"
+$CXX -o "$OutPath/wavepack" -O2 -std=c++14 -DF_CPU=16000000 -I"$SrcPath/emscripten" "$SrcPath/emscripten/avr/mocks.cpp" "$SrcPath/host/wavepack.cpp"
+$CXX -o "$OutPath/instgen" -O2 -std=c++14 -DF_CPU=16000000 -I"$SrcPath/emscripten" "$SrcPath/emscripten/avr/mocks.cpp" "$SrcPath/host/instgen.cpp"
+$CXX -o "$OutPath/bench" -O2 -std=c++14 -DF_CPU=16000000 -I"$SrcPath/emscripten" "$SrcPath/emscripten/avr/mocks.cpp" "$SrcPath/host/bench.cpp"
+$CXX -o "$OutPath/bench-records" -O2 -std=c++14 -DF_CPU=16000000 -DVOICE_RECORDS -I"$SrcPath/emscripten" "$SrcPath/emscripten/avr/mocks.cpp" "$SrcPath/host/bench.cpp"
+$CXX -o "$OutPath/tuning" -O2 -std=c++14 -DF_CPU=16000000 -I"$SrcPath/emscripten" "$SrcPath/emscripten/avr/mocks.cpp" "$SrcPath/host/tuning.cpp"
+$CXX -o "$OutPath/envseek" -O2 -std=c++14 -DF_CPU=16000000 -I"$SrcPath/emscripten" "$SrcPath/emscripten/avr/mocks.cpp" "$SrcPath/host/envseek.cpp"
+$CXX -o "$OutPath/snapshotcheck" -O2 -std=c++14 -DF_CPU=16000000 -I"$SrcPath/emscripten" "$SrcPath/emscripten/avr/mocks.cpp" "$SrcPath/host/snapshotcheck.cpp"
+$CXX -o "$OutPath/stackdepth" -O2 -std=c++14 "$SrcPath/host/stackdepth.cpp"
+$CXX -o "$OutPath/telemetry" -O2 -std=c++14 "$SrcPath/host/telemetry.cpp"
+
+SimavrInclude=${SIMAVR_INCLUDE:-/usr/include/simavr}
+if [ -f "$SimavrInclude/sim_avr.h" ]; then
+  $CXX -o "$OutPath/avrsim" -O2 -std=c++14 -I"$SimavrInclude" "$SrcPath/host/avrsim.cpp" -lsimavr -lelf
+fi
@@ -0,0 +1,26 @@
+#!/bin/sh
+# Compile the Arduino MIDI Sound Module firmware to an optimized, standalone WASM for use in a browser
+# AudioWorklet (see 'emscripten/worklet.cpp' and 'emscripten/worklet/processor.mjs'), e.g.:
+#
+#   ./build-wasm.sh && node emscripten/worklet/bench.mjs
+#
+# Unlike 'emcc-firmware.bat' (an unoptimized embind build for debugging), the module has no JavaScript
+# glue and exports only the C ABI of 'worklet.cpp'.  Requires the Emscripten SDK ('emcc' on the PATH).
+
+set -e
+
+SrcPath=$(cd "$(dirname "$0")" && pwd)
+OutPath=$SrcPath/wasm-bin
+EMCC=${EMCC:-emcc}
+
+if ! command -v "$EMCC" > /dev/null; then
+  echo "Error: '$EMCC' not found.  Install and activate the Emscripten SDK or set EMCC." >&2
+  exit 1
+fi
+
+mkdir -p "$OutPath"
+$EMCC -o "$OutPath/firmware-worklet.wasm" -O3 -std=c++14 -DF_CPU=16000000 -DNDEBUG \
+  -fno-exceptions -fno-rtti --no-entry -sSTANDALONE_WASM -sINITIAL_MEMORY=1048576 \
+  -I"$SrcPath/emscripten" "$SrcPath/emscripten/avr/mocks.cpp" "$SrcPath/emscripten/worklet.cpp"
+
+echo "$OutPath/firmware-worklet.wasm"
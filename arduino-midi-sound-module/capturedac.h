@@ -0,0 +1,101 @@
+/*
+    Capture DAC policy
+    https://github.com/DLehenbauer/arduino-midi-sound-module
+
+    A DAC policy that records each output sample into a caller provided buffer instead of driving
+    any hardware.  Used by host builds to render the output of the sample/mix ISR for tests and
+    benchmarks:
+
+      uint16_t samples[1024];
+      CaptureDac::begin(samples, sizeof(samples) / sizeof(samples[0]));
+      Synth<CaptureDac> synth;
+      while (!CaptureDac::isFull()) { synth.isr(); }
+
+    Samples arriving after the buffer is full are discarded.
+
+    'StereoCaptureDac' is the stereo equivalent, recording interleaved left/right sample pairs.
+*/
+
+#ifndef CAPTUREDAC_H_
+#define CAPTUREDAC_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+class CaptureDac final {
+  private:
+    static uint16_t* _pNext;                        // Location at which the next sample will be stored.
+    static uint16_t* _pEnd;                         // End of the capture buffer.
+    static size_t _count;                           // Number of samples captured since 'begin()'.
+
+  public:
+    static constexpr bool usesSpi = false;
+    static constexpr bool isStereo = false;
+
+    static void setup() { /* do nothing */ }
+    static void sendHiByte() { /* do nothing */ }
+    static void sendLoByte() { /* do nothing */ }
+
+    static void set(uint16_t out) {
+      if (_pNext != _pEnd) {
+        *_pNext++ = out;
+        _count++;
+      }
+    }
+
+    // Begins capturing samples into the given 'buffer', which holds up to 'capacity' samples.
+    static void begin(uint16_t* buffer, size_t capacity) {
+      _pNext = buffer;
+      _pEnd = buffer + capacity;
+      _count = 0;
+    }
+
+    static size_t count()  { return _count; }
+    static bool isFull()   { return _pNext == _pEnd; }
+};
+
+uint16_t* CaptureDac::_pNext = nullptr;
+uint16_t* CaptureDac::_pEnd = nullptr;
+size_t CaptureDac::_count = 0;
+
+class StereoCaptureDac final {
+  private:
+    static uint16_t* _pNext;                        // Location at which the next left/right pair will be stored.
+    static uint16_t* _pEnd;                         // End of the capture buffer.
+    static size_t _count;                           // Number of left/right pairs captured since 'begin()'.
+
+  public:
+    static constexpr bool usesSpi = false;
+    static constexpr bool isStereo = true;
+
+    static void setup() { /* do nothing */ }
+    static void sendHiByte() { /* do nothing */ }
+    static void sendLoByte() { /* do nothing */ }
+    static void sendRightHiByte() { /* do nothing */ }
+    static void sendRightLoByte() { /* do nothing */ }
+
+    static void set(uint16_t left, uint16_t right) {
+      if (_pNext != _pEnd) {
+        *_pNext++ = left;
+        *_pNext++ = right;
+        _count++;
+      }
+    }
+
+    // Begins capturing samples into the given 'buffer', which holds up to 'capacity' left/right pairs
+    // (i.e., the buffer must be 'capacity * 2' elements in length.)
+    static void begin(uint16_t* buffer, size_t capacity) {
+      _pNext = buffer;
+      _pEnd = buffer + capacity * 2;
+      _count = 0;
+    }
+
+    static size_t count()  { return _count; }
+    static bool isFull()   { return _pNext == _pEnd; }
+};
+
+uint16_t* StereoCaptureDac::_pNext = nullptr;
+uint16_t* StereoCaptureDac::_pEnd = nullptr;
+size_t StereoCaptureDac::_count = 0;
+
+#endif /* CAPTUREDAC_H_ */
@@ -0,0 +1,25 @@
+# CMake toolchain file for the ATmega328P (Arduino Uno) using avr-gcc, e.g.:
+#
+#   cmake -S . -B build-avr -DCMAKE_TOOLCHAIN_FILE=cmake/avr-gcc.cmake && cmake --build build-avr
+#
+# (Normally configured automatically as the 'firmware-avr' external project of the host build when
+# avr-gcc is on the PATH, see 'CMakeLists.txt'.)
+
+set(CMAKE_SYSTEM_NAME Generic)
+set(CMAKE_SYSTEM_PROCESSOR avr)
+
+set(AVR_MCU atmega328p)
+set(AVR_FLASH_SIZE 32768)
+set(AVR_SRAM_SIZE 2048)
+
+find_program(CMAKE_CXX_COMPILER avr-g++ REQUIRED)
+find_program(CMAKE_OBJCOPY avr-objcopy REQUIRED)
+find_program(CMAKE_OBJDUMP avr-objdump REQUIRED)
+find_program(AVR_NM avr-nm REQUIRED)
+
+# The compiler can not link a test executable without '-mmcu', so only compile during checks.
+set(CMAKE_TRY_COMPILE_TARGET_TYPE STATIC_LIBRARY)
+
+set(CMAKE_FIND_ROOT_PATH_MODE_PROGRAM NEVER)
+set(CMAKE_FIND_ROOT_PATH_MODE_LIBRARY ONLY)
+set(CMAKE_FIND_ROOT_PATH_MODE_INCLUDE ONLY)
@@ -0,0 +1,35 @@
+#!/bin/sh
+# Measures the cost of a build option by running 'avrsim' on the firmware built without and with it,
+# and printing the median / max duration of the Timer2 ISR for each.  Fails if the median ISR of either
+# build exceeds the cycles between interrupts.  Invoked by the 'segments-avr' and 'records-avr' tests:
+#
+#   avr-isrcompare.sh <avrsim> <name> <firmware.elf> <name> <firmware.elf> [avrsim options...]
+
+set -e
+
+AvrSim=$1
+BeforeName=$2
+BeforeElf=$3
+AfterName=$4
+AfterElf=$5
+shift 5
+
+# Prints the median, max and budget of the Timer2 ISR reported by 'avrsim' for the given firmware.
+isr() {
+  Elf=$1
+  shift
+  "$AvrSim" "$@" "$Elf" | awk '/^Timer2 ISR/ { getline; gsub(/[,(]/, ""); print $4, $6, $8 }'
+}
+
+Before=$(isr "$BeforeElf" "$@")
+After=$(isr "$AfterElf" "$@")
+
+echo "$BeforeName $Before $AfterName $After" | awk '
+  NF != 8 { print "Error: \"avrsim\" did not report the Timer2 ISR." > "/dev/stderr"; exit 1 }
+  {
+    printf "Timer2 ISR (cycles)   median   max\n"
+    printf "  %-18s  %6d  %4d\n", $1, $2, $3
+    printf "  %-18s  %6d  %4d\n", $5, $6, $7
+    printf "  difference          %+6d  %+4d  (%d cycles between interrupts)\n", $6 - $2, $7 - $3, $4
+    if ($2 > $4 || $6 > $8) { print "Error: The median ISR exceeds the cycles between interrupts." > "/dev/stderr"; exit 1 }
+  }'
@@ -0,0 +1,22 @@
+#!/bin/sh
+# Runs 'avrsim' on an AVR firmware image, checking the stack high-water mark observed in simulation
+# against the worst case stack depth calculated from the disassembly by 'stackdepth'.  Invoked by the
+# 'latency-avr' test:
+#
+#   avr-simcheck.sh <firmware.elf> <avrsim> <stackdepth> <avr-objdump> [avrsim options...]
+
+set -e
+
+Elf=$1
+AvrSim=$2
+StackDepth=$3
+OBJDUMP=$4
+shift 4
+
+Bound=$("$OBJDUMP" -d "$Elf" | "$StackDepth" | awk '/worst case/ { print $2 }')
+if [ -z "$Bound" ]; then
+  echo "Error: 'stackdepth' did not report a worst case for '$Elf'." >&2
+  exit 1
+fi
+
+"$AvrSim" -k "$Bound" "$@" "$Elf"
@@ -0,0 +1,27 @@
+#!/bin/sh
+# Checks the worst case stack depth of an AVR firmware image against the SRAM remaining after .data /
+# .bss, as 'build-avr.sh' does.  Invoked by the CMake AVR build after linking each firmware variant:
+#
+#   avr-stackcheck.sh <firmware.elf> <sramSize> <minHeadroom> <stackdepth> <avr-nm> <avr-objdump>
+
+set -e
+
+Elf=$1
+SramSize=$2
+MinHeadroom=$3
+StackDepth=$4
+NM=$5
+OBJDUMP=$6
+
+# Sum the sizes of the symbols in SRAM (.data / .bss / .noinit).
+Sram=$("$NM" -S "$Elf" | awk '
+  function hex(str,   value, i) {
+    value = 0
+    for (i = 1; i <= length(str); i++) { value = value * 16 + index("0123456789abcdef", tolower(substr(str, i, 1))) - 1 }
+    return value
+  }
+  NF >= 4 && $3 ~ /^[dDbB]$/ { sram += hex($2) }
+  END { print sram + 0 }')
+
+echo "$(basename "$Elf"): $Sram / $SramSize bytes SRAM"
+"$OBJDUMP" -d "$Elf" | "$StackDepth" $((SramSize - Sram)) "$MinHeadroom"
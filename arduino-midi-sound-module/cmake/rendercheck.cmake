@@ -0,0 +1,64 @@
+# Renders a MIDI file sequentially, in parallel, and resumed from a checkpoint, and checks that each
+# render matches the sequential render byte for byte.  Invoked by the 'render' test:
+#
+#   cmake -DRENDER=<render> -DSONG=<input.mid> -DOUT=<directory> [-DJOBS=4] [-DCHECKPOINT=2.5] -P rendercheck.cmake
+#
+# The checkpoint saved by the sequential and parallel renders must also match, and the render resumed
+# from it must match the tail of the sequential render (after the 44 byte WAV header, see 'wavfile.h').
+
+if(NOT DEFINED JOBS)
+  set(JOBS 4)
+endif()
+if(NOT DEFINED CHECKPOINT)
+  set(CHECKPOINT 2.5)
+endif()
+
+set(WavHeaderSize 44)
+
+file(MAKE_DIRECTORY ${OUT})
+
+function(render)
+  execute_process(COMMAND ${RENDER} ${ARGN} RESULT_VARIABLE Result OUTPUT_QUIET)
+  if(NOT Result EQUAL 0)
+    message(FATAL_ERROR "'render ${ARGN}' failed (${Result}).")
+  endif()
+endfunction()
+
+# Reads the bytes of 'path' from 'offset' to the end as a hex string.
+function(read_hex var path offset)
+  file(READ ${path} Hex OFFSET ${offset} HEX)
+  set(${var} "${Hex}" PARENT_SCOPE)
+endfunction()
+
+function(expect_same expected actual description)
+  if(NOT "${expected}" STREQUAL "${actual}")
+    message(FATAL_ERROR "${description} differs from the sequential render.")
+  endif()
+  message(STATUS "${description} matches.")
+endfunction()
+
+render(${SONG} ${OUT}/sequential.wav)
+render(-j ${JOBS} ${SONG} ${OUT}/parallel.wav)
+render(-c ${CHECKPOINT} ${OUT}/checkpoint.bin ${SONG} ${OUT}/checkpoint.wav)
+render(-j ${JOBS} -c ${CHECKPOINT} ${OUT}/checkpoint-parallel.bin ${SONG} ${OUT}/checkpoint-parallel.wav)
+render(-r ${OUT}/checkpoint.bin ${SONG} ${OUT}/resumed.wav)
+
+read_hex(Sequential ${OUT}/sequential.wav 0)
+foreach(Name parallel checkpoint checkpoint-parallel)
+  read_hex(Actual ${OUT}/${Name}.wav 0)
+  expect_same("${Sequential}" "${Actual}" "'${Name}.wav'")
+endforeach()
+
+read_hex(Checkpoint ${OUT}/checkpoint.bin 0)
+read_hex(Actual ${OUT}/checkpoint-parallel.bin 0)
+expect_same("${Checkpoint}" "${Actual}" "Checkpoint saved by the parallel render")
+
+file(SIZE ${OUT}/sequential.wav SequentialSize)
+file(SIZE ${OUT}/resumed.wav ResumedSize)
+math(EXPR TailOffset "${SequentialSize} - ${ResumedSize} + ${WavHeaderSize}")
+if(ResumedSize LESS_EQUAL WavHeaderSize OR TailOffset LESS_EQUAL WavHeaderSize)
+  message(FATAL_ERROR "'resumed.wav' (${ResumedSize} bytes) is not a tail of 'sequential.wav' (${SequentialSize} bytes).")
+endif()
+read_hex(Tail ${OUT}/sequential.wav ${TailOffset})
+read_hex(Actual ${OUT}/resumed.wav ${WavHeaderSize})
+expect_same("${Tail}" "${Actual}" "'resumed.wav'")
@@ -0,0 +1,97 @@
+/*
+    Composite DAC policy
+    https://github.com/DLehenbauer/arduino-midi-sound-module
+
+    Drives two DAC policies from the same sample/mix ISR.  For example, a PWM monitor output in
+    addition to an SPI DAC main output:
+
+      #define DAC DacPair<Ltc16xx<PinId::D10>, Pwm0>
+
+    Each call made by the ISR is statically forwarded to both DACs, so the pair adds no runtime
+    dispatch beyond the cost of the two DACs themselves.
+
+    'StereoPair' similarly combines two mono DACs into a stereo DAC, sending the left channel to the
+    first DAC and the right channel to the second.  For example, stereo PWM output on pins 5/6 (left)
+    and 9/10 (right):
+
+      #define DAC StereoPair<Pwm0, Pwm1>
+
+    Notes:
+      - At most one of the DACs may use the SPI bus, as the ISR interleaves SPI transmission of the
+        previous sample with calculating the next sample.
+
+      - The two DACs must not share a timer (e.g., 'Pwm0' and 'Pwm01').  To drive both PWM pairs
+        with carrier cancellation, use 'Pwm01' instead of 'DacPair<Pwm0, Pwm1>'.
+*/
+
+#ifndef DACPAIR_H_
+#define DACPAIR_H_
+
+#include <stdint.h>
+
+template<typename TFirst, typename TSecond>
+class DacPair final {
+  static_assert(!(TFirst::usesSpi && TSecond::usesSpi), "At most one DAC in a DacPair may use the SPI bus.");
+  static_assert(!(TFirst::isStereo || TSecond::isStereo), "DacPair requires mono DACs.");
+
+  public:
+    static constexpr bool usesSpi = TFirst::usesSpi || TSecond::usesSpi;
+    static constexpr bool isStereo = false;
+
+    static void setup() {
+      TFirst::setup();
+      TSecond::setup();
+    }
+
+    static void sendHiByte() __attribute__((always_inline)) {
+      TFirst::sendHiByte();
+      TSecond::sendHiByte();
+    }
+
+    static void sendLoByte() __attribute__((always_inline)) {
+      TFirst::sendLoByte();
+      TSecond::sendLoByte();
+    }
+
+    static void set(uint16_t out) __attribute__((always_inline)) {
+      TFirst::set(out);
+      TSecond::set(out);
+    }
+};
+
+template<typename TLeft, typename TRight>
+class StereoPair final {
+  static_assert(!(TLeft::usesSpi && TRight::usesSpi), "At most one DAC in a StereoPair may use the SPI bus.");
+  static_assert(!(TLeft::isStereo || TRight::isStereo), "StereoPair requires mono DACs.");
+
+  public:
+    static constexpr bool usesSpi = TLeft::usesSpi || TRight::usesSpi;
+    static constexpr bool isStereo = true;
+
+    static void setup() {
+      TLeft::setup();
+      TRight::setup();
+    }
+
+    // Note: Because at most one of the DACs uses SPI, both transmit the previous sample using the
+    //       left channel hooks.
+    static void sendHiByte() __attribute__((always_inline)) {
+      TLeft::sendHiByte();
+      TRight::sendHiByte();
+    }
+
+    static void sendLoByte() __attribute__((always_inline)) {
+      TLeft::sendLoByte();
+      TRight::sendLoByte();
+    }
+
+    static void sendRightHiByte() __attribute__((always_inline)) { /* do nothing */ }
+    static void sendRightLoByte() __attribute__((always_inline)) { /* do nothing */ }
+
+    static void set(uint16_t left, uint16_t right) __attribute__((always_inline)) {
+      TLeft::set(left);
+      TRight::set(right);
+    }
+};
+
+#endif /* DACPAIR_H_ */
@@ -3,6 +3,6 @@
 setlocal
 
 set SrcPath=%CD%
-emcc --bind -o %CD%\firmware.js -O0 -g -std=c++14 -DF_CPU=16000000 -I%SrcPath%\emscripten %SrcPath%\emscripten\avr\mocks.cpp %SrcPath%\emscripten\bindings.cpp
+emcc --bind -o %CD%\firmware.js -O0 -g -std=c++14 -DF_CPU=16000000 -DVOICE_STATS -I%SrcPath%\emscripten %SrcPath%\emscripten\avr\mocks.cpp %SrcPath%\emscripten\bindings.cpp
 
 endlocal
@@ -198,6 +198,15 @@ extern uint8_t UBRR0H;
 #define UBRR0_10 2
 #define UBRR0_11 3
 
+extern uint8_t UCSR0A;
+#define MPCM0 0
+#define U2X0 1
+#define UPE0 2
+#define DOR0 3
+#define FE0 4
+#define UDRE0 5
+#define TXC0 6
+#define RXC0 7
 extern uint8_t UCSR0C;
 #define UCPOL0 0
 #define UCSZ00 1
@@ -275,6 +284,13 @@ extern uint8_t TIMSK1;
 extern uint8_t TIMSK2;
 #define OCIE2A 1
 
+extern uint8_t TIFR2;
+#define TOV2 0
+#define OCF2A 1
+#define OCF2B 2
+
+extern uint8_t TCNT2;
+
 #define SIGNAL(vector) \
 void vector()
 
@@ -15,6 +15,7 @@ uint8_t TCCR2A;
 uint8_t TCCR2B;
 uint8_t UBRR0H;
 uint8_t UBRR0L;
+uint8_t UCSR0A = 1 << UDRE0;  // Note: Initialized w/UDRE0 so that USART transmit wait loops will terminate.
 uint8_t UCSR0B;
 uint8_t UCSR0C;
 uint8_t GTCCR;
@@ -24,6 +25,21 @@ uint8_t PORTB;
 uint8_t SPDR;
 uint8_t SPSR = 1 << SPIF;     // Note: Initialized w/SPIF so that SPI wait loops will terminate.
 uint8_t TIMSK2;
+uint8_t TIFR2;
+uint8_t TCNT2;
+uint8_t DDRB;
+uint8_t DDRC;
+uint8_t DDRD;
+uint8_t PORTC;
+uint8_t PORTD;
+uint8_t ICR1H;
+uint8_t ICR1L;
+uint8_t TCCR0A;
+uint8_t TCCR0B;
+uint8_t TCNT0;
+uint8_t TIMSK0;
+uint8_t TIMSK1;
+uint8_t UDR0;
 
 void cli() {}
 void sei() {}
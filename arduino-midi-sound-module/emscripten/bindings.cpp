@@ -5,20 +5,27 @@ MidiSynth synth;
 
 void noteOn(uint8_t channel, uint8_t note, uint8_t velocity)		    { synth.midiNoteOn(channel, note, velocity); }
 void noteOff(uint8_t channel, uint8_t note)							            { synth.midiNoteOff(channel, note); }
-void sysex(uint8_t cbData, uint8_t data[])							            { }
+void sysex(uint8_t cbData, uint8_t data[])							            { synth.midiSysex(cbData, data, [](uint8_t) { /* discard replies */ }); }
 void controlChange(uint8_t channel, uint8_t control, uint8_t value) { synth.midiControlChange(channel, control, value); }
 void programChange(uint8_t channel, uint8_t value)					        { synth.midiProgramChange(channel, value); }
 void pitchBend(uint8_t channel, int16_t value)						          { synth.midiPitchBend(channel, value); }
 
 static MidiSynth* getSynth()  { return &synth; }
-static double getSampleRate() { return Synth::sampleRate; }
+static double getSampleRate() { return MidiSynth::sampleRate; }
+static uint16_t sample()      { return synth.isr(); }
+
+#ifdef VOICE_STATS
+static const MidiSynth::Stats* getVoiceStats() { return &MidiSynth::getStats(); }
+#endif // VOICE_STATS
 
 EMSCRIPTEN_BINDINGS(firmware) {  function("midi_decode_byte", &Midi::decode);  function("getPercussionNotes", &Instruments::getPercussionNotes);
   function("getWavetable", &Instruments::getWavetable);
   function("getEnvelopeStages", &Instruments::getEnvelopeStages);
   function("getEnvelopePrograms", &Instruments::getEnvelopePrograms);
+  function("getAmpModVariants", &Instruments::getAmpModVariants);
+  function("getInstrumentRecords", &Instruments::getInstrumentRecords);
   function("getInstruments", &Instruments::getInstruments);
-  function("sample", &Synth::isr);
+  function("sample", &sample);
   
   value_object<HeapRegion<int8_t>>("I8s")
     .field("start", &HeapRegion<int8_t>::start)
@@ -40,15 +47,34 @@ EMSCRIPTEN_BINDINGS(firmware) {  function("midi_decode_byte", &Midi::decode);
     .field("end", &HeapRegion<EnvelopeProgram>::end)
     .field("itemSize", &HeapRegion<EnvelopeProgram>::itemSize);
 
-  value_object<HeapRegion<Instrument>>("Instruments")
-    .field("start", &HeapRegion<Instrument>::start)
-    .field("end", &HeapRegion<Instrument>::end)
-    .field("itemSize", &HeapRegion<Instrument>::itemSize);
+  value_object<HeapRegion<EnvelopeStart>>("EnvelopeStarts")
+    .field("start", &HeapRegion<EnvelopeStart>::start)
+    .field("end", &HeapRegion<EnvelopeStart>::end)
+    .field("itemSize", &HeapRegion<EnvelopeStart>::itemSize);
+
+  value_object<HeapRegion<InstrumentRecord>>("InstrumentRecords")
+    .field("start", &HeapRegion<InstrumentRecord>::start)
+    .field("end", &HeapRegion<InstrumentRecord>::end)
+    .field("itemSize", &HeapRegion<InstrumentRecord>::itemSize);
   
   function("getSampleRate", &getSampleRate);
   function("getSynth", &getSynth, allow_raw_pointer<ret_val>());
-  class_<EnvelopeStage>("EnvelopeStage");  class_<EnvelopeProgram>("EnvelopeProgram");  class_<Instrument>("Instrument");  class_<Envelope>("Envelope")    .constructor<>()    .function("sample", &Envelope::sampleEm)    .function("start", &Envelope::startEm)    .function("stop", &Envelope::stopEm)    .function("getStageIndex", &Envelope::getStageIndex);  class_<Synth>("Synth")    .constructor<>()
-    .function("noteOn", &Synth::noteOnEm)
-    .function("noteOff", &Synth::noteOff);
-  class_<MidiSynth, base<Synth>>("MidiSynth")    .constructor<>()    .function("midiNoteOn", &MidiSynth::midiNoteOn)    .function("midiNoteOff", &MidiSynth::midiNoteOff)    .function("midiProgramChange", &MidiSynth::midiProgramChange)    .function("midiPitchBend", &MidiSynth::midiPitchBend);
+  class_<EnvelopeStage>("EnvelopeStage");  class_<EnvelopeProgram>("EnvelopeProgram");  class_<EnvelopeStart>("EnvelopeStart");  class_<InstrumentRecord>("InstrumentRecord");  class_<Envelope>("Envelope")    .constructor<>()    .function("sample", &Envelope::sampleEm)    .function("start", &Envelope::startEm)    .function("stop", &Envelope::stopEm)    .function("getStageIndex", &Envelope::getStageIndex);  class_<Synth<DAC>>("Synth")    .constructor<>()
+    .function("noteOn", &Synth<DAC>::noteOnEm)
+    .function("noteOff", &Synth<DAC>::noteOff);
+  class_<MidiSynth, base<Synth<DAC>>>("MidiSynth")    .constructor<>()    .function("midiNoteOn", &MidiSynth::midiNoteOn)    .function("midiNoteOff", &MidiSynth::midiNoteOff)    .function("midiProgramChange", &MidiSynth::midiProgramChange)    .function("midiPitchBend", &MidiSynth::midiPitchBend)
+    .function("updateStats", &MidiSynth::updateStats);
+
+#ifdef VOICE_STATS
+  function("getVoiceStats", &getVoiceStats, allow_raw_pointer<ret_val>());
+  class_<MidiSynth::Stats>("VoiceStats")
+    .function("getEventCount", &MidiSynth::Stats::getEventCount)
+    .function("getNoteCount", &MidiSynth::Stats::getNoteCount)
+    .function("getStealCount", &MidiSynth::Stats::getStealCount)
+    .function("getActiveFrames", &MidiSynth::Stats::getActiveFrames)
+    .function("getStageFrames", &MidiSynth::Stats::getStageFrames)
+    .function("getFrames", &MidiSynth::Stats::getFrames)
+    .function("getPolyphonyFrames", &MidiSynth::Stats::getPolyphonyFrames)
+    .function("getMaxPolyphony", &MidiSynth::Stats::getMaxPolyphony);
+#endif // VOICE_STATS
 }
\ No newline at end of file
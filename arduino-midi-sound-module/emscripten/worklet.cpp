@@ -0,0 +1,144 @@
+/*
+    AudioWorklet entry points
+    https://github.com/DLehenbauer/arduino-midi-sound-module
+
+    C ABI used to run the synth inside a browser AudioWorklet (see 'build-wasm.sh' and
+    'emscripten/worklet/').  Unlike 'bindings.cpp', there is no embind glue: the module is built as a
+    standalone WASM that the worklet instantiates directly, and each 128-frame render quantum costs a
+    single call to 'render()'.
+
+    Both directions of data exchange use buffers preallocated in WASM memory, whose addresses are
+    obtained once after instantiation:
+
+      getOutput()     - Planar float output, 'getMaxFrames()' left samples followed by 'getMaxFrames()'
+                        right samples in [-1 .. 1).  'render(frames)' overwrites the first 'frames' of each.
+
+      getMidiRing()   - Ring of raw MIDI bytes:
+
+                          uint32_t head;              // Bytes written by JavaScript (free running).
+                          uint32_t tail;              // Bytes consumed by 'render()' (free running).
+                          uint8_t  data[capacity];    // Byte 'i' is stored at 'data[i & (capacity - 1)]'.
+
+                        JavaScript stores the bytes of each message and then advances 'head'.  At the
+                        start of each 'render()', all bytes between 'tail' and 'head' are passed to
+                        'Midi::decode()'.
+
+                        The ring is only written by the thread that calls 'render()' (between calls), so
+                        it needs no synchronization.  The module's memory is not shared: other threads
+                        (e.g., the page's main thread) send MIDI to the AudioWorklet via 'port.postMessage()',
+                        and the processor copies it into the ring (see 'processor.mjs').
+
+    MIDI messages therefore take effect at the start of the next render quantum (~6ms at the synth's
+    sample rate), comparable to the time the USART takes to receive a 3 byte message (~1ms).
+
+    The synth runs at its native 'getSampleRate()' (~20kHz).  The AudioContext should be created at this
+    rate and left to resample to the output device.
+*/
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __EMSCRIPTEN__
+#include <emscripten.h>
+#else
+#define EMSCRIPTEN_KEEPALIVE
+#endif
+
+// DAC policy that converts each stereo sample to float and stores it in the planar output buffer.
+class WorkletDac final {
+  private:
+    static float* _pLeft;                           // Location at which the next left sample will be stored.
+    static float* _pRight;                          // Location at which the next right sample will be stored.
+
+  public:
+    static constexpr bool usesSpi = false;
+    static constexpr bool isStereo = true;
+
+    static void setup() { /* do nothing */ }
+    static void sendHiByte() { /* do nothing */ }
+    static void sendLoByte() { /* do nothing */ }
+    static void sendRightHiByte() { /* do nothing */ }
+    static void sendRightLoByte() { /* do nothing */ }
+
+    static void set(uint16_t left, uint16_t right) {
+      *_pLeft++ = static_cast<int16_t>(left - 0x8000) * (1.0f / 32768.0f);
+      *_pRight++ = static_cast<int16_t>(right - 0x8000) * (1.0f / 32768.0f);
+    }
+
+    // Directs the next samples to the given left/right channel buffers.
+    static void begin(float* pLeft, float* pRight) {
+      _pLeft = pLeft;
+      _pRight = pRight;
+    }
+};
+
+float* WorkletDac::_pLeft = nullptr;
+float* WorkletDac::_pRight = nullptr;
+
+#define DAC WorkletDac
+
+#include "../midi.h"
+#include "../midisynth.h"
+
+MidiSynth synth;
+
+// The below thunks are invoked by Midi::decode() and forwarded to our MidiSynth.
+void noteOn(uint8_t channel, uint8_t note, uint8_t velocity)        { synth.midiNoteOn(channel, note, velocity); }
+void noteOff(uint8_t channel, uint8_t note)                         { synth.midiNoteOff(channel, note); }
+void sysex(uint8_t cbData, uint8_t data[])                          { synth.midiSysex(cbData, data, [](uint8_t) { /* discard replies */ }); }
+void controlChange(uint8_t channel, uint8_t control, uint8_t value) { synth.midiControlChange(channel, control, value); }
+void programChange(uint8_t channel, uint8_t value)                  { synth.midiProgramChange(channel, value); }
+void pitchBend(uint8_t channel, int16_t value)                      { synth.midiPitchBend(channel, value); }
+
+static constexpr uint32_t maxFrames = 1024;         // Largest 'render()' (AudioWorklets currently use 128 frame quanta.)
+static constexpr uint32_t midiRingCapacity = 1024;  // Must be a power of 2.
+
+static_assert((midiRingCapacity & (midiRingCapacity - 1)) == 0, "'midiRingCapacity' must be a power of 2.");
+
+struct MidiRing {
+  uint32_t head;
+  uint32_t tail;
+  uint8_t  data[midiRingCapacity];
+};
+
+static float s_output[2 * maxFrames];
+static MidiRing s_midiRing;
+
+extern "C" {
+
+EMSCRIPTEN_KEEPALIVE float* getOutput()                 { return s_output; }
+EMSCRIPTEN_KEEPALIVE MidiRing* getMidiRing()            { return &s_midiRing; }
+EMSCRIPTEN_KEEPALIVE uint32_t getMidiRingCapacity()     { return midiRingCapacity; }
+EMSCRIPTEN_KEEPALIVE uint32_t getMaxFrames()            { return maxFrames; }
+EMSCRIPTEN_KEEPALIVE double getSampleRate()             { return MidiSynth::sampleRate; }
+
+// Resets the synth and discards any pending MIDI.  Must be called once before the first 'render()'.
+EMSCRIPTEN_KEEPALIVE void init() {
+  s_midiRing.tail = s_midiRing.head;
+  synth.begin();
+}
+
+// Decodes the pending MIDI bytes and renders the next 'frames' stereo samples into the output buffer.
+// Returns the number of frames rendered (at most 'maxFrames').
+EMSCRIPTEN_KEEPALIVE uint32_t render(uint32_t frames) {
+  const uint32_t head = s_midiRing.head;
+  uint32_t tail = s_midiRing.tail;
+  while (tail != head) {
+    Midi::decode(s_midiRing.data[tail & (midiRingCapacity - 1)]);
+    tail++;
+  }
+  s_midiRing.tail = tail;
+
+  if (frames > maxFrames) {
+    frames = maxFrames;
+  }
+
+  WorkletDac::begin(s_output, s_output + maxFrames);
+  for (uint32_t frame = frames; frame > 0; frame--) {
+    synth.isr();
+  }
+
+  return frames;
+}
+
+}
@@ -0,0 +1,54 @@
+/*
+    WASM benchmark
+    https://github.com/DLehenbauer/arduino-midi-sound-module
+
+    Measures the throughput of the standalone WASM built by 'build-wasm.sh' under Node, rendering
+    128 frame quanta (as an AudioWorklet would) with all 16 voices sounding a sustained note.  The MIDI
+    is delivered through the MIDI ring, as from the AudioWorklet processor.  (See 'host/bench.cpp' for
+    the native equivalent.)
+
+    Usage: node bench.mjs [firmware-worklet.wasm] [seconds]
+
+    Reports the mean time to render each quantum, and the fraction of the quantum's real time duration
+    that this represents.
+*/
+
+import { readFileSync } from 'node:fs';
+import { fileURLToPath } from 'node:url';
+import { SynthWasm } from './synth-wasm.mjs';
+
+const wasmPath = process.argv[2] ?? fileURLToPath(new URL('../../wasm-bin/firmware-worklet.wasm', import.meta.url));
+const seconds = Number(process.argv[3] ?? 60);      // Duration of audio rendered (not wall clock time).
+const quantumFrames = 128;
+
+const synth = new SynthWasm(new WebAssembly.Module(readFileSync(wasmPath)));
+
+// Sustain 16 notes across two channels playing an organ (program 16), which does not decay, so that
+// every voice remains active for the duration of the benchmark.
+for (let channel = 0; channel < 2; channel++) {
+  synth.midi([0xC0 | channel, 16]);
+  for (let note = 0; note < 8; note++) {
+    synth.midi([0x90 | channel, 48 + channel * 12 + note * 3, 127]);
+  }
+}
+
+// Warm up (and decode the MIDI above) before timing.
+const numQuanta = Math.ceil(seconds * synth.sampleRate / quantumFrames);
+for (let i = 0; i < Math.min(numQuanta, 1000); i++) {
+  synth.render(quantumFrames);
+}
+
+let checksum = 0;
+const start = process.hrtime.bigint();
+
+for (let i = 0; i < numQuanta; i++) {
+  const [left, right] = synth.render(quantumFrames);
+  checksum += left[i & (quantumFrames - 1)] + right[i & (quantumFrames - 1)];   // (Keeps the output observed.)
+}
+
+const elapsed = Number(process.hrtime.bigint() - start) / 1e9;
+const quantumSeconds = quantumFrames / synth.sampleRate;
+const perQuantum = elapsed / numQuanta;
+
+console.log(`wasm: ${(perQuantum * 1e6).toFixed(2)} us/quantum (${(perQuantum * 1e9 / quantumFrames).toFixed(2)} ns/sample), `
+  + `${(100 * perQuantum / quantumSeconds).toFixed(2)}% of real time (checksum ${checksum.toFixed(4)})`);
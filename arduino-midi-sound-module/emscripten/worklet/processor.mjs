@@ -0,0 +1,48 @@
+/*
+    AudioWorklet processor
+    https://github.com/DLehenbauer/arduino-midi-sound-module
+
+    Plays the synth in a browser AudioWorklet, calling the WASM 'render()' once per render quantum.
+    MIDI bytes posted to the node's port are copied into the MIDI ring in WASM memory by the audio
+    thread itself, and take effect at the start of the next quantum.  (The module's memory is not
+    shared, so no SharedArrayBuffer or cross-origin isolation is required.)
+
+      const module = await WebAssembly.compileStreaming(fetch('firmware-worklet.wasm'));
+      const context = new AudioContext({ sampleRate: 16000000 / 8 / 101 });   // Synth::sampleRate
+      await context.audioWorklet.addModule('processor.mjs');
+      const node = new AudioWorkletNode(context, 'arduino-midi-synth', {
+        numberOfInputs: 0,
+        outputChannelCount: [2],
+        processorOptions: { module },
+      });
+      node.connect(context.destination);
+      node.port.postMessage([0x90, 60, 127]);                                  // Note on
+
+    'synth-wasm.mjs' must be served alongside this file.
+*/
+
+import { SynthWasm } from './synth-wasm.mjs';
+
+class SynthProcessor extends AudioWorkletProcessor {
+  constructor(options) {
+    super();
+    this.synth = new SynthWasm(options.processorOptions.module);
+    this.port.onmessage = (event) => {
+      if (!this.synth.midi(event.data)) {
+        this.port.postMessage({ dropped: event.data.length });
+      }
+    };
+  }
+
+  process(inputs, outputs) {
+    const output = outputs[0];
+    const [left, right] = this.synth.render(output[0].length);
+    output[0].set(left);
+    if (output.length > 1) {
+      output[1].set(right);
+    }
+    return true;
+  }
+}
+
+registerProcessor('arduino-midi-synth', SynthProcessor);
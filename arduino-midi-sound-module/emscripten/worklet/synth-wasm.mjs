@@ -0,0 +1,72 @@
+/*
+    Synth WASM wrapper
+    https://github.com/DLehenbauer/arduino-midi-sound-module
+
+    Instantiates the standalone WASM built by 'build-wasm.sh' (see 'emscripten/worklet.cpp') and
+    exposes its preallocated output buffer and MIDI ring.  Shared by the AudioWorklet processor
+    ('processor.mjs') and the Node benchmark ('bench.mjs').
+
+    Instantiation is synchronous so that it can be performed in the AudioWorkletProcessor constructor
+    from a 'WebAssembly.Module' compiled on the main thread.
+*/
+
+// Returns an import object that satisfies any (unused) imports of the module.  The firmware does not
+// perform I/O, but the toolchain may still reference a few WASI functions.
+function stubImports(module) {
+  const imports = {};
+  for (const { module: name, name: field, kind } of WebAssembly.Module.imports(module)) {
+    if (kind === 'function') {
+      (imports[name] ??= {})[field] = () => 0;
+    }
+  }
+  return imports;
+}
+
+export class SynthWasm {
+  constructor(module) {
+    const exports = new WebAssembly.Instance(module, stubImports(module)).exports;
+    if (exports._initialize) {
+      exports._initialize();                        // (Runs static constructors of a '--no-entry' module.)
+    }
+    exports.init();
+
+    this.exports = exports;
+    this.sampleRate = exports.getSampleRate();
+    this.maxFrames = exports.getMaxFrames();
+
+    // The memory does not grow, so views created here remain valid.
+    const buffer = exports.memory.buffer;
+    const output = exports.getOutput();
+    this.left = new Float32Array(buffer, output, this.maxFrames);
+    this.right = new Float32Array(buffer, output + this.maxFrames * 4, this.maxFrames);
+
+    const ring = exports.getMidiRing();
+    this.ringCapacity = exports.getMidiRingCapacity();
+    this.ringIndices = new Uint32Array(buffer, ring, 2);       // [head, tail]
+    this.ringData = new Uint8Array(buffer, ring + 8, this.ringCapacity);
+  }
+
+  // Queues the given MIDI bytes (an array of numbers or Uint8Array) to be decoded at the start of the
+  // next 'render()'.  Returns false without queuing any bytes if the ring does not have room for all
+  // of them.  Must be called from the thread that calls 'render()' (the module's memory is not shared.)
+  midi(bytes) {
+    const [head, tail] = this.ringIndices;
+    if (bytes.length > this.ringCapacity - ((head - tail) >>> 0)) {
+      return false;
+    }
+
+    const mask = this.ringCapacity - 1;
+    for (let i = 0; i < bytes.length; i++) {
+      this.ringData[(head + i) & mask] = bytes[i];
+    }
+    this.ringIndices[0] = head + bytes.length;
+    return true;
+  }
+
+  // Renders the next 'frames' samples and returns views of the left and right channels.  The views
+  // are overwritten by the next call.
+  render(frames) {
+    const rendered = this.exports.render(frames);
+    return [this.left.subarray(0, rendered), this.right.subarray(0, rendered)];
+  }
+}
@@ -55,18 +55,27 @@ class Envelope {
     }
 
     // 'start()' is called by 'Synth::noteOn()' to intialize the envelope generators with the
-    /// program from 'Instruments::EnvelopePrograms' at the given 'programIndex'.
-    void start(uint8_t programIndex) volatile {
-      EnvelopeProgram program;
-      Instruments::getEnvelopeProgram(programIndex, program);
-    
-      pFirstStage = program.start;
+    /// program start read from the instrument's record (see 'InstrumentRecord').
+    void start(const EnvelopeStart& program) volatile {
+      pFirstStage = program.stages;
       loopStart = program.loopStartAndEnd >> 4;
       loopEnd = program.loopStartAndEnd & 0x0F;
       value = program.initialValue << 8;
       stageIndex = 0;
-    
-      loadStage();
+      slope = program.first.slope;          // The first stage is copied into the record, so there is no
+      limit = program.first.limit;          // need to 'loadStage()'.
+    }
+
+    // 'reset()' is called by 'Synth::reset()' to return the envelope generator to its initial
+    // (idle) state.
+    void reset() volatile {
+      pFirstStage = nullptr;
+      loopStart = 0xFF;
+      loopEnd = 0xFF;
+      stageIndex = 0xFF;
+      value = 0;
+      slope = 0;
+      limit = -64;
     }
 
     // 'stop()' is called by 'Synth::noteOff()' to advance the the envelope generator to the
@@ -81,12 +90,144 @@ class Envelope {
       }
     }
 
+  #ifndef __AVR__
+    static constexpr uint32_t never = 0xFFFFFFFF;   // Stage length of a stage that never completes / 'releaseStep' of a held note
+
+  private:
+    // Returns true if 'sample()' advances to the next stage after adding 'slope' produced the given
+    // 'value'.  (Must match the comparison in 'sample()'.)
+    static bool isStageComplete(int16_t value, int16_t slope, int8_t limit) {
+      const int8_t out = value >> 8;
+      return ((out < 0) || (slope <= 0))
+        ? out <= limit
+        : out >= limit;
+    }
+
+    // Returns the number of calls to 'sample()' needed to complete the stage with the given 'slope'
+    // and 'limit', starting from 'value', or 'never' if the stage does not complete.
+    static uint32_t stageLength(int16_t value, int16_t slope, int8_t limit) {
+      if (slope == 0) {                               // Constant value completes immediately or never.
+        return isStageComplete(value, slope, limit) ? 1 : never;
+      }
+
+      int32_t steps = 1;
+      if (slope < 0) {                                // Decreasing: completes once 'value <= (limit << 8) + 0xFF'.
+        const int32_t distance = value - (limit * 256 + 0xFF);
+        if (distance > 0) { steps = (distance - slope - 1) / -slope; }
+      } else if (value >= 0 && limit >= 0) {          // Increasing: completes once 'value >= limit << 8'.
+        const int32_t distance = limit * 256 - value;
+        if (distance > 0) { steps = (distance + slope - 1) / slope; }
+      }
+
+      const int32_t end = value + steps * slope;
+      if (INT16_MIN <= end && end <= INT16_MAX && isStageComplete(end, slope, limit)) {
+        return steps;                                 // Reached the limit without wrapping around.
+      }
+
+      // Otherwise the value wraps around before reaching the limit.  Simulate the stage instead.  The
+      // Q8.8 value repeats after 2^16 steps, so a stage that has not completed by then never will.
+      for (steps = 1; steps <= 0x10000; steps++) {
+        value += slope;
+        if (isStageComplete(value, slope, limit)) { return steps; }
+      }
+      return never;
+    }
+
+  public:
+    // Advances the envelope generator to the state it would have after 'steps' calls to 'sample()'.
+    // The cost is proportional to the number of stages crossed, not 'steps'.  (Once the sustain loop
+    // has repeated, whole loop iterations are skipped.)
+    void advance(uint32_t steps) volatile {
+      uint8_t index = stageIndex;
+      int16_t current = value;
+      int16_t currentSlope = slope;
+      int8_t currentLimit = limit;
+      uint32_t remainingAtLoop = never;               // 'steps' remaining the last time the loop jumped back to 'loopStart'
+
+      while (steps > 0) {
+        const uint32_t length = stageLength(current, currentSlope, currentLimit);
+        if (length > steps) {                         // Stage does not complete.  Q8.8 value wraps like 'sample()'.
+          current = static_cast<int16_t>(static_cast<uint32_t>(current) + static_cast<uint32_t>(currentSlope) * steps);
+          break;
+        }
+
+        steps -= length;                              // Complete the stage as in 'sample()'.
+        current = currentLimit << 8;
+        index++;
+        if (index == loopEnd) {
+          index = loopStart;
+
+          // Every jump to 'loopStart' begins from the same value, so the loop is periodic.  Skip
+          // the remaining whole iterations.
+          if (remainingAtLoop != never) { steps %= remainingAtLoop - steps; }
+          remainingAtLoop = steps;
+        }
+
+        EnvelopeStage stage;
+        Instruments::getEnvelopeStage(pFirstStage + index, /* out: */ stage);
+        currentSlope = stage.slope;
+        currentLimit = stage.limit;
+      }
+
+      stageIndex = index;
+      value = current;
+      slope = currentSlope;
+      limit = currentLimit;
+    }
+
+    // Computes the state of an envelope generator that was started with the given 'program', then
+    // sampled 'steps' times, where 'stop()' was called after the first 'releaseStep' calls to
+    // 'sample()' (or not at all if 'releaseStep' is 'never').
+    //
+    // Note: 'Synth' samples each envelope once per 256 samples (see 'Synth::isr()'), so 'steps' and
+    //       'releaseStep' count envelope steps rather than audio samples.
+    void seek(const EnvelopeStart& program, uint32_t steps, uint32_t releaseStep = never) volatile {
+      start(program);
+      if (releaseStep <= steps) {
+        advance(releaseStep);
+        stop();
+        steps -= releaseStep;
+      }
+      advance(steps);
+    }
+
+    // As above, for the EnvelopeProgram at the given 'programIndex'.
+    void seek(uint8_t programIndex, uint32_t steps, uint32_t releaseStep = never) volatile {
+      EnvelopeStart program;
+      Instruments::getEnvelopeStart(programIndex, program);
+      seek(program, steps, releaseStep);
+    }
+  #endif // !__AVR__
+
+    // Saves or restores the state of the envelope generator (see 'snapshot.h').  A restored envelope
+    // whose stages are outside of 'Instruments::EnvelopeStages' fails the restore and is reset.
+    template <typename TArchive> void serialize(TArchive& archive) volatile {
+      uint16_t firstStage = Instruments::getEnvelopeStageIndex(pFirstStage);
+      archive.io(firstStage);
+      archive.io(loopStart);
+      archive.io(loopEnd);
+      archive.io(stageIndex);
+      archive.io(value);
+      archive.io(slope);
+      archive.io(limit);
+
+      if (archive.check(firstStage == Instruments::noStage || (
+            Instruments::isEnvelopeStageIndex(firstStage) &&
+            Instruments::isEnvelopeStageIndex(firstStage + loopStart) &&
+            Instruments::isEnvelopeStageIndex(firstStage + loopEnd) &&
+            Instruments::isEnvelopeStageIndex(firstStage + stageIndex)))) {
+        pFirstStage = Instruments::getEnvelopeStageAt(firstStage);
+      } else {
+        reset();
+      }
+    }
+
     // Allow Synth::getNextVoice() to inspect private state when choosing the next best voice.
-    friend class Synth;
+    template <typename TDac> friend class Synth;
   
   #ifdef __EMSCRIPTEN__
     uint8_t sampleEm()            { return sample(); }
-    void startEm(uint8_t program) { start(program); }
+    void startEm(uint8_t program) { EnvelopeStart s; Instruments::getEnvelopeStart(program, s); start(s); }
     void stopEm()                 { stop(); }
     uint8_t getStageIndex()       { return stageIndex; }
   #endif // __EMSCRIPTEN__
@@ -0,0 +1,594 @@
+/*
+    AVR simulation harness
+    https://github.com/DLehenbauer/arduino-midi-sound-module
+
+    Runs the real firmware ELF (see 'build-avr.sh') on a cycle-accurate ATmega328P simulated by simavr
+    (https://github.com/buserror/simavr), feeding it MIDI via USART0 with 31250 baud timing and
+    capturing the samples written to the DAC, to measure:
+
+      - Note-on latency: the time from the end of the stop bit of the last byte of a note-on message
+        to the first non-silent sample written to the DAC.  The note-on is repeated for each trial,
+        and the silence between trials is waited for.  The first byte of each note-on is sent on entry
+        to the Timer2 ISR (i.e., at a fixed Timer2 count), after a number of Timer2 interrupts that
+        sweeps the phase of the note-on across the synth's amplitude updates (which occur once per
+        frame of 256 samples, see 'Synth::getFrame()').
+
+      - Behavior under a saturated MIDI bus: back-to-back note on / off messages for several seconds.
+        If the firmware was built with -DTELEMETRY, the harness decodes the telemetry reports it
+        transmits (see 'telemetry.h') to report the bytes dropped by the MIDI receive buffer, its
+        high-water mark, and ISR overruns.
+
+      - The duration of the Timer2 (sample/mix) ISR, from entering its interrupt vector until the
+        'reti' that returns from it.  (Includes the USART RX ISR when it preempts the Timer2 ISR.)
+
+      - The stack high-water mark, i.e. the lowest stack pointer observed after any instruction, which
+        is checked against the worst case calculated by 'host/stackdepth.cpp' if given ('-k').
+
+      - Optionally, the cycles per call of a function in the firmware ('-f'), excluding the time spent
+        in interrupts, e.g. '-f _Z6noteOnhhh' for each note-on (see 'main.h').  With '-f', a note-on of
+        each program at a low, middle and high note and of each percussion note is also sent, so that
+        the calls cover every instrument record rather than only the default program.
+
+    Usage: avrsim [-d pwm0|pwm1|spi] [-n trials] [-s seconds] [-k bytes] [-f symbol] <firmware.elf>
+
+      -d    How the DAC is driven: pwm0 for 'Pwm0' and 'Pwm01' (default), pwm1 for 'Pwm1', and spi for
+            'Ltc16xx<PinId::D10>'.
+      -n    Number of note-on latency trials (default 16).
+      -s    Seconds of saturated MIDI input (default 5).
+      -k    Worst case stack depth reported by 'stackdepth'.  Exits with 2 if the high-water mark exceeds it.
+      -f    Name of a function (as in the ELF symbol table) to measure the cycles per call of.
+
+    Samples are captured as the firmware writes them: for PWM, on the write of the low byte register
+    (after the high byte has been written), and for SPI, when CS (D10) is raised after the two bytes
+    of a sample have been transmitted.  The silent output level is 0x8000.
+
+    Note: simavr's USART buffers received bytes rather than modelling the hardware's 2 byte receive
+    buffer, so bytes lost to a USART data overrun (i.e., the RX ISR being blocked for ~640us) are not
+    detected.  (The RX ISR is able to preempt the Timer2 ISR, so such overruns are not expected.)
+*/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <deque>
+#include <vector>
+#include <fcntl.h>
+#include <gelf.h>
+#include <unistd.h>
+#include <sim_avr.h>
+#include <sim_elf.h>
+#include <sim_io.h>
+#include <sim_irq.h>
+#include <sim_cycle_timers.h>
+#include <avr_uart.h>
+#include "telemetryreport.h"
+
+static constexpr uint32_t cpuFrequency = 16000000;
+static constexpr uint32_t baudRate = 31250;
+static constexpr avr_cycle_count_t cyclesPerByte = cpuFrequency / baudRate * 10;  // Start bit + 8 data bits + stop bit
+static constexpr uint16_t silence = 0x8000;                                     // DAC output while all voices are silent.
+static constexpr uint32_t silentSamples = 2048;                                 // Consecutive silent samples to consider the synth idle.
+static constexpr uint32_t samplesPerFrame = 256;                                // Samples between amplitude updates of a voice.
+static constexpr avr_cycle_count_t isrBudget = 8 * 0x65;                        // Cycles between Timer2 interrupts (see 'Synth::samplingInterval').
+
+// Interrupt vectors of the ATmega328P (byte addresses in flash.)
+static constexpr uint32_t vectorSize = 4;
+static constexpr uint32_t numVectors = 26;
+static constexpr uint32_t timer2Vector = 7;                                     // TIMER2_COMPA
+
+// ATmega328P data space addresses of the registers written by the DAC drivers.
+enum : avr_io_addr_t {
+  Addr_PORTB    = 0x25,
+  Addr_OCR0A    = 0x47,
+  Addr_OCR0B    = 0x48,
+  Addr_SPDR     = 0x4E,
+  Addr_OCR1AL   = 0x88,
+  Addr_OCR1BL   = 0x8A,
+};
+
+static constexpr uint8_t csBit = 2;                                             // D10 = PB2
+
+enum DacKind { Dac_Pwm0, Dac_Pwm1, Dac_Spi };
+
+struct TimedReport {
+  avr_cycle_count_t cycle;
+  TelemetryReport report;
+};
+
+static avr_t* avr;
+static avr_irq_t* uartInput;
+
+static std::deque<uint8_t> midiOut;                 // Bytes waiting to be sent to the firmware.
+static avr_cycle_count_t lastByteEnd = 0;           // Cycle at which the stop bit of the most recent byte ended.
+static uint64_t bytesSent = 0;
+
+static uint64_t numSamples = 0;
+static uint32_t silentRun = 0;                      // Consecutive silent samples written to the DAC.
+static bool isAwaitingSound = false;
+static avr_cycle_count_t firstSound = 0;            // Cycle of the first non-silent sample after 'isAwaitingSound' was set.
+
+static bool isCsLow = false;                        // SPI sample assembly.
+static uint8_t spiBytes[2];
+static uint8_t spiCount = 0;
+
+static TelemetryDecoder decoder;
+static std::vector<TimedReport> reports;
+
+static bool isSending = false;                      // True while the byte timer is running (see 'queueMidi()').
+
+// Interrupts in progress (innermost last), detected by the PC entering a vector and ended by the
+// 'reti' that pops the interrupted PC (i.e., the stack pointer rising above its value on entry.)
+struct Interrupt {
+  avr_cycle_count_t start;
+  uint16_t sp;
+  uint32_t vector;
+};
+
+static std::vector<Interrupt> interrupts;
+static uint64_t timer2Count = 0;                    // Timer2 ISRs entered since reset.
+static bool isTimer2Entry = false;                  // True if the last instruction entered the Timer2 ISR.
+static std::vector<avr_cycle_count_t> isrCycles;    // Duration of each Timer2 ISR.
+
+static uint16_t minSp = 0xFFFF;                     // Lowest stack pointer observed.
+
+static uint32_t profileAddress = 0;                 // Address of the function measured with '-f' (if any).
+static bool isInCall = false;
+static avr_cycle_count_t callStart = 0;
+static uint16_t callSp = 0;                         // Stack pointer after the return address was pushed by the call.
+static avr_cycle_count_t callInterrupts = 0;        // Cycles spent in interrupts during the current call.
+static std::vector<avr_cycle_count_t> callCycles;   // Duration of each call, excluding interrupts.
+
+static double toSeconds(avr_cycle_count_t cycles) { return static_cast<double>(cycles) / cpuFrequency; }
+static avr_cycle_count_t toCycles(double seconds) { return static_cast<avr_cycle_count_t>(seconds * cpuFrequency); }
+
+static void onSample(uint16_t value) {
+  numSamples++;
+  if (value == silence) {
+    silentRun++;
+  } else {
+    silentRun = 0;
+    if (isAwaitingSound && firstSound == 0) {
+      firstSound = avr->cycle;
+    }
+  }
+}
+
+static void onOcr0bWrite(avr_t* avr, avr_io_addr_t addr, uint8_t value, void* param) {
+  onSample(static_cast<uint16_t>(avr->data[Addr_OCR0A] << 8) | value);
+}
+
+static void onOcr1aWrite(avr_t* avr, avr_io_addr_t addr, uint8_t value, void* param) {
+  onSample(static_cast<uint16_t>(avr->data[Addr_OCR1BL] << 8) | value);
+}
+
+static void onPortbWrite(avr_t* avr, avr_io_addr_t addr, uint8_t value, void* param) {
+  const bool isLow = (value & (1 << csBit)) == 0;
+  if (isLow && !isCsLow) {
+    spiCount = 0;
+  } else if (!isLow && isCsLow && spiCount == 2) {
+    onSample(static_cast<uint16_t>(spiBytes[0] << 8) | spiBytes[1]);
+  }
+  isCsLow = isLow;
+}
+
+static void onSpdrWrite(avr_t* avr, avr_io_addr_t addr, uint8_t value, void* param) {
+  if (isCsLow && spiCount < 2) {
+    spiBytes[spiCount++] = value;
+  }
+}
+
+static void onUartOutput(avr_irq_t* irq, uint32_t value, void* param) {
+  TelemetryReport report;
+  if (decoder.decode(static_cast<uint8_t>(value), report)) {
+    reports.push_back({ avr->cycle, report });
+  }
+}
+
+// Sends the next queued MIDI byte, one byte time after the previous byte.  (The USART delivers each
+// byte to the firmware one byte time after it is raised, i.e., at the end of its stop bit.)  Stops
+// once the queue is empty, one byte time after the last byte.
+static avr_cycle_count_t onByteTime(avr_t* avr, avr_cycle_count_t when, void* param) {
+  if (midiOut.empty()) {
+    isSending = false;
+    return 0;
+  }
+
+  avr_raise_irq(uartInput, midiOut.front());
+  midiOut.pop_front();
+  bytesSent++;
+  lastByteEnd = when + cyclesPerByte;
+  return when + cyclesPerByte;
+}
+
+static uint16_t getSp() {
+  return static_cast<uint16_t>(avr->data[R_SPL] | (avr->data[R_SPH] << 8));
+}
+
+static avr_cycle_count_t median(std::vector<avr_cycle_count_t> values) {
+  std::sort(values.begin(), values.end());
+  return values[values.size() / 2];
+}
+
+// Called after each instruction to track interrupts, the stack high-water mark and calls of the
+// function measured with '-f'.
+static void onStep() {
+  const uint16_t sp = getSp();
+  minSp = std::min(minSp, sp);
+
+  isTimer2Entry = false;
+
+  while (!interrupts.empty() && sp > interrupts.back().sp) {              // Returned from an interrupt?
+    const Interrupt interrupt = interrupts.back();
+    interrupts.pop_back();
+
+    const avr_cycle_count_t cycles = avr->cycle - interrupt.start;
+    if (interrupt.vector == timer2Vector) {
+      isrCycles.push_back(cycles);
+    }
+    if (isInCall && interrupts.empty()) {                                 // (Nested interrupts are included in the outermost.)
+      callInterrupts += cycles;
+    }
+  }
+
+  const uint32_t pc = avr->pc;
+  if (pc != 0 && pc < numVectors * vectorSize && pc % vectorSize == 0) {  // Entered an interrupt vector?
+    interrupts.push_back({ avr->cycle, sp, pc / vectorSize });
+    if (pc / vectorSize == timer2Vector) {
+      timer2Count++;
+      isTimer2Entry = true;
+    }
+  }
+
+  if (profileAddress != 0) {
+    if (isInCall && sp > callSp && interrupts.empty()) {                  // Returned from the measured function?
+      callCycles.push_back(avr->cycle - callStart - callInterrupts);
+      isInCall = false;
+    }
+    if (!isInCall && pc == profileAddress) {
+      isInCall = true;
+      callStart = avr->cycle;
+      callSp = sp;
+      callInterrupts = 0;
+    }
+  }
+}
+
+// Runs the simulation until 'done()' returns true or 'timeout' seconds have elapsed.  Returns false
+// on timeout.
+template <typename TDone>
+static bool runUntil(TDone done, double timeout) {
+  const avr_cycle_count_t end = avr->cycle + toCycles(timeout);
+  while (!done()) {
+    if (avr->cycle >= end) {
+      return false;
+    }
+
+    const int state = avr_run(avr);
+    if (state == cpu_Done || state == cpu_Crashed) {
+      fprintf(stderr, "Error: Firmware stopped (state %d) at %.3fs.\n", state, toSeconds(avr->cycle));
+      exit(1);
+    }
+    onStep();
+  }
+  return true;
+}
+
+static void runFor(double seconds) {
+  runUntil([]() { return false; }, seconds);
+}
+
+// Queues the given bytes for transmission.  If the USART is idle, the first byte is sent immediately.
+static void queueMidi(std::initializer_list<uint8_t> bytes) {
+  midiOut.insert(midiOut.end(), bytes);
+  if (!isSending) {
+    isSending = true;
+    avr_cycle_timer_register(avr, 1, onByteTime, nullptr);
+  }
+}
+
+static void measureLatency(uint32_t numTrials) {
+  std::vector<double> latencies;
+
+  for (uint32_t trial = 0; trial < numTrials; trial++) {
+    // Sweep the phase of the note-on across the synth frame (~13ms) by starting each trial on entry to
+    // the Timer2 ISR that samples a different position within the frame.  (The Timer2 ISR count since
+    // reset is the synth's time divider, see 'Synth::tick()'.)
+    const uint32_t phase = trial * samplesPerFrame / numTrials;
+    runUntil([=]() { return isTimer2Entry && timer2Count % samplesPerFrame == phase; }, 1.0);
+
+    firstSound = 0;
+    isAwaitingSound = true;
+    queueMidi({ 0x90, 60, 127 });
+
+    const bool isSounding = runUntil([]() { return firstSound != 0; }, 1.0);
+    isAwaitingSound = false;
+    if (!isSounding) {
+      fprintf(stderr, "Error: Trial %u: No sound within 1s of note-on.\n", trial);
+      exit(1);
+    }
+    latencies.push_back(toSeconds(firstSound - lastByteEnd));
+
+    queueMidi({ 0x80, 60, 0 });
+    if (!runUntil([]() { return midiOut.empty() && silentRun >= silentSamples; }, 10.0)) {
+      fprintf(stderr, "Warning: Trial %u: Note did not decay to silence within 10s.\n", trial);
+    }
+  }
+
+  std::sort(latencies.begin(), latencies.end());
+  double sum = 0;
+  for (double latency : latencies) { sum += latency; }
+
+  printf("Note-on latency (%u trials across the frame, end of last byte to first non-silent DAC sample):\n", numTrials);
+  printf("  min %.3f ms, median %.3f ms, mean %.3f ms, max %.3f ms\n",
+    latencies.front() * 1e3, latencies[latencies.size() / 2] * 1e3, sum / latencies.size() * 1e3, latencies.back() * 1e3);
+}
+
+// Plays a note-on (and note-off) of each melodic program at a low, middle and high note, followed by each
+// percussion note, so that '-f _Z6noteOnhhh' covers every instrument record (see 'InstrumentRecord' in
+// 'instruments.h'), including the alternate amplitude envelopes of 'SelectAmplitude' instruments.  Each
+// note is played at a low, middle and full velocity, which covers both velocity curves (see
+// '_velocityToGain' in 'synth.h'.)  Returns the number of note-ons sent.
+static uint32_t sweepNoteOns() {
+  static constexpr uint8_t notes[] = { 36, 60, 96 };
+  static constexpr uint8_t velocities[] = { 1, 64, 127 };
+  uint32_t count = 0;
+
+  for (uint16_t program = 0; program < 128; program++) {
+    queueMidi({ 0xC0, static_cast<uint8_t>(program) });
+    for (uint8_t note : notes) {
+      for (uint8_t velocity : velocities) {
+        queueMidi({ 0x90, note, velocity });
+        queueMidi({ 0x80, note, 0 });
+        count++;
+      }
+    }
+  }
+  for (uint8_t note = 35; note <= 81; note++) {     // GM percussion key map.
+    for (uint8_t velocity : velocities) {
+      queueMidi({ 0x99, note, velocity });
+      count++;
+    }
+  }
+
+  runUntil([]() { return midiOut.empty(); }, 10.0);
+  runFor(0.01);                                     // Allow the last note-on to be dispatched.
+  return count;
+}
+
+static void measureSaturation(double seconds) {
+  const uint32_t baseline = reports.empty() ? 0 : reports.back().report.rxDropped;
+  const size_t firstReport = reports.size();
+  const uint64_t firstByte = bytesSent;
+
+  // Back-to-back note on / off messages cycling through the melodic channels and a range of notes.
+  // (Consecutive bytes always differ.)
+  const uint64_t numMessages = static_cast<uint64_t>(seconds * baudRate / 10 / 3);
+  for (uint64_t i = 0; i < numMessages; i++) {
+    const uint8_t channel = (i >> 1) % 9;
+    const uint8_t note = 36 + (i >> 1) % 48;
+    if (i & 1) {
+      queueMidi({ static_cast<uint8_t>(0x80 | channel), note, 0 });
+    } else {
+      queueMidi({ static_cast<uint8_t>(0x90 | channel), note, 100 });
+    }
+  }
+
+  const avr_cycle_count_t start = avr->cycle;
+  runUntil([]() { return midiOut.empty(); }, seconds * 2 + 1);
+  const avr_cycle_count_t end = avr->cycle;
+  runFor(1.5);                                      // Wait for the telemetry report covering the end of the burst.
+
+  printf("\nSaturated MIDI input (%.1fs, %llu bytes at %u baud):\n", toSeconds(end - start),
+    static_cast<unsigned long long>(bytesSent - firstByte), baudRate);
+
+  if (reports.size() == firstReport) {
+    printf("  No telemetry reports received.  (Build the firmware with -DTELEMETRY to report drops.)\n");
+    return;
+  }
+
+  uint32_t dropped = 0, overruns = 0, maxCycles = 0;
+  uint8_t highWater = 0;
+  for (size_t i = firstReport; i < reports.size(); i++) {
+    const TelemetryReport& report = reports[i].report;
+    dropped = (report.rxDropped - baseline) & 0xFFFF;                          // (Counted modulo 2^16.)
+    overruns += report.isrOverruns;
+    maxCycles = std::max(maxCycles, report.isrMaxCycles);
+    highWater = std::max(highWater, report.rxHighWater);
+  }
+
+  printf("  %u byte(s) dropped, receive buffer high-water %u, %u ISR overrun(s), longest ISR %u cycles (%zu reports)\n",
+    dropped, highWater, overruns, maxCycles, reports.size() - firstReport);
+}
+
+static void reportIsr() {
+  if (isrCycles.empty()) {
+    printf("\nTimer2 ISR: Not entered.\n");
+    return;
+  }
+  printf("\nTimer2 ISR (%zu interrupts, including nested USART RX ISRs):\n", isrCycles.size());
+  printf("  min %llu, median %llu, max %llu cycles (%llu cycles between interrupts)\n",
+    static_cast<unsigned long long>(*std::min_element(isrCycles.begin(), isrCycles.end())),
+    static_cast<unsigned long long>(median(isrCycles)),
+    static_cast<unsigned long long>(*std::max_element(isrCycles.begin(), isrCycles.end())),
+    static_cast<unsigned long long>(isrBudget));
+}
+
+static void reportCalls(const char* symbol) {
+  if (callCycles.empty()) {
+    printf("\n%s: Not called.  (Check that it is not inlined, e.g., with 'avr-nm'.)\n", symbol);
+    return;
+  }
+  printf("\n%s (%zu calls, excluding interrupts):\n", symbol, callCycles.size());
+  printf("  min %llu, median %llu, max %llu cycles\n",
+    static_cast<unsigned long long>(*std::min_element(callCycles.begin(), callCycles.end())),
+    static_cast<unsigned long long>(median(callCycles)),
+    static_cast<unsigned long long>(*std::max_element(callCycles.begin(), callCycles.end())));
+}
+
+// Returns the stack high-water mark in bytes, after printing it and the bound from 'stackdepth' (if
+// given.)
+static uint32_t reportStack(uint32_t bound) {
+  const uint32_t highWater = avr->ramend - minSp;
+  printf("\nStack high-water: %u bytes", highWater);
+  if (bound != 0) {
+    printf(" (worst case from 'stackdepth': %u bytes, %d bytes above the high-water)", bound,
+      static_cast<int>(bound) - static_cast<int>(highWater));
+  }
+  printf("\n");
+  return highWater;
+}
+
+// Returns the address of the function with the given name in the ELF symbol table, or 0 if not found.
+static uint32_t findFunction(const char* path, const char* name) {
+  uint32_t address = 0;
+  const int fd = open(path, O_RDONLY);
+  if (fd < 0 || elf_version(EV_CURRENT) == EV_NONE) {
+    return 0;
+  }
+
+  Elf* elf = elf_begin(fd, ELF_C_READ, nullptr);
+  Elf_Scn* section = nullptr;
+  while (address == 0 && elf != nullptr && (section = elf_nextscn(elf, section)) != nullptr) {
+    GElf_Shdr header;
+    if (gelf_getshdr(section, &header) == nullptr || header.sh_type != SHT_SYMTAB) {
+      continue;
+    }
+
+    Elf_Data* data = elf_getdata(section, nullptr);
+    const size_t count = header.sh_size / header.sh_entsize;
+    for (size_t i = 0; i < count; i++) {
+      GElf_Sym symbol;
+      if (gelf_getsym(data, i, &symbol) == nullptr || GELF_ST_TYPE(symbol.st_info) != STT_FUNC) {
+        continue;
+      }
+      const char* const symbolName = elf_strptr(elf, header.sh_link, symbol.st_name);
+      if (symbolName != nullptr && strcmp(symbolName, name) == 0) {
+        address = static_cast<uint32_t>(symbol.st_value);
+        break;
+      }
+    }
+  }
+
+  if (elf != nullptr) { elf_end(elf); }
+  close(fd);
+  return address;
+}
+
+int main(int argc, char* argv[]) {
+  DacKind dac = Dac_Pwm0;
+  uint32_t numTrials = 16;
+  double saturationSeconds = 5;
+  uint32_t stackBound = 0;
+  const char* profileSymbol = nullptr;
+  const char* path = nullptr;
+
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "-d") == 0 && i + 1 < argc) {
+      const char* const kind = argv[++i];
+      if (strcmp(kind, "pwm0") == 0)      { dac = Dac_Pwm0; }
+      else if (strcmp(kind, "pwm1") == 0) { dac = Dac_Pwm1; }
+      else if (strcmp(kind, "spi") == 0)  { dac = Dac_Spi; }
+      else { path = nullptr; break; }
+    } else if (strcmp(argv[i], "-n") == 0 && i + 1 < argc) {
+      numTrials = std::max(1, atoi(argv[++i]));
+    } else if (strcmp(argv[i], "-s") == 0 && i + 1 < argc) {
+      saturationSeconds = atof(argv[++i]);
+    } else if (strcmp(argv[i], "-k") == 0 && i + 1 < argc) {
+      stackBound = static_cast<uint32_t>(std::max(0, atoi(argv[++i])));
+    } else if (strcmp(argv[i], "-f") == 0 && i + 1 < argc) {
+      profileSymbol = argv[++i];
+    } else if (path == nullptr && argv[i][0] != '-') {
+      path = argv[i];
+    } else {
+      path = nullptr;
+      break;
+    }
+  }
+
+  if (path == nullptr) {
+    fprintf(stderr, "Usage: %s [-d pwm0|pwm1|spi] [-n trials] [-s seconds] [-k bytes] [-f symbol] <firmware.elf>\n", argv[0]);
+    return 1;
+  }
+
+  if (profileSymbol != nullptr) {
+    profileAddress = findFunction(path, profileSymbol);
+    if (profileAddress == 0) {
+      fprintf(stderr, "Error: Function '%s' not found in '%s'.\n", profileSymbol, path);
+      return 1;
+    }
+  }
+
+  elf_firmware_t firmware;
+  memset(&firmware, 0, sizeof(firmware));
+  if (elf_read_firmware(path, &firmware) != 0) {
+    fprintf(stderr, "Error: Unable to read firmware '%s'.\n", path);
+    return 1;
+  }
+  if (firmware.mmcu[0] == '\0') {                   // (The firmware does not embed an '.mmcu' section.)
+    strcpy(firmware.mmcu, "atmega328p");
+  }
+  firmware.frequency = cpuFrequency;
+
+  avr = avr_make_mcu_by_name(firmware.mmcu);
+  if (avr == nullptr) {
+    fprintf(stderr, "Error: simavr does not support '%s'.\n", firmware.mmcu);
+    return 1;
+  }
+  avr_init(avr);
+  avr_load_firmware(avr, &firmware);
+
+  // Capture the USART output without echoing it to stdout.
+  uint32_t uartFlags = 0;
+  avr_ioctl(avr, AVR_IOCTL_UART_GET_FLAGS('0'), &uartFlags);
+  uartFlags &= ~AVR_UART_FLAG_STDIO;
+  avr_ioctl(avr, AVR_IOCTL_UART_SET_FLAGS('0'), &uartFlags);
+
+  uartInput = avr_io_getirq(avr, AVR_IOCTL_UART_GETIRQ('0'), UART_IRQ_INPUT);
+  avr_irq_register_notify(avr_io_getirq(avr, AVR_IOCTL_UART_GETIRQ('0'), UART_IRQ_OUTPUT), onUartOutput, nullptr);
+
+  switch (dac) {
+    case Dac_Pwm0: avr_register_io_write(avr, Addr_OCR0B, onOcr0bWrite, nullptr); break;
+    case Dac_Pwm1: avr_register_io_write(avr, Addr_OCR1AL, onOcr1aWrite, nullptr); break;
+    case Dac_Spi:
+      avr_register_io_write(avr, Addr_PORTB, onPortbWrite, nullptr);
+      avr_register_io_write(avr, Addr_SPDR, onSpdrWrite, nullptr);
+      break;
+  }
+
+  runFor(0.5);                                      // Allow 'setup()' to complete.
+  if (numSamples == 0) {
+    fprintf(stderr, "Error: No DAC samples captured.  (Check that '-d' matches the firmware's DAC.)\n");
+    return 1;
+  }
+
+  const avr_cycle_count_t start = avr->cycle;
+  const uint64_t startSamples = numSamples;
+
+  measureLatency(numTrials);
+  if (profileSymbol != nullptr) {
+    const size_t firstCall = callCycles.size();
+    const uint32_t numNoteOns = sweepNoteOns();
+    printf("\nNote-on sweep: %u note-ons across all programs and percussion notes, %s called %zu times.\n",
+      numNoteOns, profileSymbol, callCycles.size() - firstCall);
+  }
+  if (saturationSeconds > 0) {
+    measureSaturation(saturationSeconds);
+  }
+
+  reportIsr();
+  if (profileSymbol != nullptr) {
+    reportCalls(profileSymbol);
+  }
+  const uint32_t highWater = reportStack(stackBound);
+
+  printf("\nSimulated %.1fs, DAC sample rate %.1f Hz\n", toSeconds(avr->cycle),
+    (numSamples - startSamples) / toSeconds(avr->cycle - start));
+
+  if (stackBound != 0 && highWater > stackBound) {
+    fprintf(stderr, "Error: The stack high-water mark exceeds the worst case from 'stackdepth'.\n");
+    return 2;
+  }
+  return 0;
+}
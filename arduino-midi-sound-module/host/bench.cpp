@@ -0,0 +1,451 @@
+/*
+    Host benchmark
+    https://github.com/DLehenbauer/arduino-midi-sound-module
+
+    Measures the throughput of the firmware's MIDI decoder and sample/mix ISR on the host, rendering
+    to a buffer for each of the following scenarios:
+
+      sustained     All 16 voices sustaining a note (an organ, which does not decay.)
+      percussion    A General MIDI drum pattern at 120 BPM (16th note hi-hats, kick, snare, tom fills
+                    and crashes) over a bass line and held piano chords.
+      pitchbend     A sustained note on each of the 15 melodic channels, each swept through the full
+                    pitch bend range while a bend message is sent every 1ms (i.e., at the rate of a
+                    saturated MIDI bus.)
+      storm         A note-on every 1ms without note-offs, so that (once the voices are exhausted) every
+                    note steals a sounding voice.
+      noteon        'MidiSynth::midiNoteOn()' alone, without rendering: every program at notes across the
+                    keyboard and velocities across the velocity curve, and every GM percussion note.
+                    Reported as ns/note-on (the ISR does not run, so '--seconds' does not apply.)
+
+    The MIDI messages of each scenario are generated deterministically, and passed to 'Midi::decode()'
+    at their scheduled sample, so the time spent dispatching them is included in the measurement.
+    Each scenario is rendered several times (after resetting the synth, and following a discarded warm
+    up run), and the median is reported as ns/sample, samples/second and real time factor (i.e.,
+    seconds of audio rendered per second), along with the spread of ns/sample across the runs: the
+    interquartile range and the fastest / slowest run.  Compare layouts or commits by their medians only
+    when their interquartile ranges do not overlap.
+
+    Usage: bench [--json] [--seconds <n>] [--runs <n>] [--expect <scenario>=<checksum>...] [scenario...]
+
+      --json        Print the results as JSON (e.g., to track regressions across commits.)
+      --seconds     Seconds of audio rendered by each run (default 60.)
+      --runs        Runs of each scenario (default 11.)
+      --expect      Expected checksum of the given scenario (e.g., 'storm=e7751880'.)
+      scenario      Scenarios to run (default all.)
+
+    The checksum of the output is printed for each scenario to detect behavioral changes.  (Each run
+    begins from the power-on state, so the checksum does not depend on the scenarios selected.)  Exits
+    with 1 if the runs of a scenario (including the warm up run) differ in checksum, or a checksum
+    differs from the one given with '--expect'.  The 'golden-*' ctests use this to check that renders
+    are reproducible byte-for-byte.
+
+    'build-host.sh' builds the benchmark twice, once for each layout of the per-voice state (see
+    'VoiceState' in 'synth.h'):
+
+        host/bin/bench          Structure of arrays (the default, as used on AVR)
+        host/bin/bench-records  Array of per-voice records (-DVOICE_RECORDS)
+
+    The host results do not carry over to AVR, which has no cache.  The AVR cycles of the ISR for each
+    layout are measured by 'host/avrsim.cpp' ('Timer2 ISR' median / max) in the 'records-avr' test
+    (see 'CMakeLists.txt'), or by hand, e.g.:
+
+        ./build-avr.sh Pwm0 && avrsim avr-bin/Pwm0/firmware.elf
+        DEFINES=-DVOICE_RECORDS ./build-avr.sh Pwm0 && avrsim avr-bin/Pwm0/firmware.elf
+
+    Likewise, the AVR cycles of each note-on (the counterpart of the 'noteon' scenario) are measured by
+    'avrsim -f _Z6noteOnhhh avr-bin/Pwm0/firmware.elf'.
+*/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <utility>
+#include <vector>
+#include "../capturedac.h"
+
+#define DAC StereoCaptureDac
+
+#include "../midi.h"
+#include "../midisynth.h"
+#include "../snapshot.h"
+
+#ifdef VOICE_RECORDS
+static constexpr const char* layout = "records";
+#else
+static constexpr const char* layout = "arrays";
+#endif
+
+MidiSynth synth;
+
+// The below thunks are invoked by Midi::decode() and forwarded to our MidiSynth.
+void noteOn(uint8_t channel, uint8_t note, uint8_t velocity)        { synth.midiNoteOn(channel, note, velocity); }
+void noteOff(uint8_t channel, uint8_t note)                         { synth.midiNoteOff(channel, note); }
+void sysex(uint8_t cbData, uint8_t data[])                          { synth.midiSysex(cbData, data, [](uint8_t) { /* discard replies */ }); }
+void controlChange(uint8_t channel, uint8_t control, uint8_t value) { synth.midiControlChange(channel, control, value); }
+void programChange(uint8_t channel, uint8_t value)                  { synth.midiProgramChange(channel, value); }
+void pitchBend(uint8_t channel, int16_t value)                      { synth.midiPitchBend(channel, value); }
+
+struct Event {
+  uint32_t frame;                                       // Sample at which the message is decoded.
+  uint8_t  bytes[3];
+  uint8_t  length;
+};
+
+class Events final {
+  private:
+    std::vector<Event> _events;
+
+  public:
+    void add(double seconds, uint8_t status, uint8_t data1) {
+      _events.push_back({ frameAt(seconds), { status, data1, 0 }, 2 });
+    }
+
+    void add(double seconds, uint8_t status, uint8_t data1, uint8_t data2) {
+      _events.push_back({ frameAt(seconds), { status, data1, data2 }, 3 });
+    }
+
+    // Sorts the events by frame, preserving the order of events scheduled for the same frame.
+    const std::vector<Event>& sorted() {
+      std::stable_sort(_events.begin(), _events.end(), [](const Event& left, const Event& right) { return left.frame < right.frame; });
+      return _events;
+    }
+
+    static uint32_t frameAt(double seconds) { return static_cast<uint32_t>(seconds * MidiSynth::sampleRate); }
+};
+
+// Deterministic pseudo-random numbers for the scenarios (https://en.wikipedia.org/wiki/Xorshift).
+class Random final {
+  private:
+    uint32_t _state;
+
+  public:
+    explicit Random(uint32_t seed) : _state(seed) {}
+
+    // Returns a number in [min .. max].
+    uint8_t next(uint8_t min, uint8_t max) {
+      _state ^= _state << 13;
+      _state ^= _state >> 17;
+      _state ^= _state << 5;
+      return min + _state % (max - min + 1);
+    }
+};
+
+static void sustained(Events& events, double /* duration */) {      // (The notes are held to the end.)
+  for (uint8_t channel = 0; channel < 2; channel++) {
+    events.add(0, 0xC0 | channel, 16);
+    for (uint8_t note = 0; note < 8; note++) {
+      events.add(0, 0x90 | channel, 48 + channel * 12 + note * 3, 127);
+    }
+  }
+}
+
+static void percussion(Events& events, double duration) {
+  constexpr double sixteenth = 60.0 / 120 / 4;           // 120 BPM
+  constexpr uint8_t drums = 0x99;                        // Note on, channel 10
+  static const uint8_t bassLine[] = { 36, 36, 43, 36, 39, 36, 43, 46 };
+  static const uint8_t chords[][3] = { { 60, 63, 67 }, { 58, 63, 67 }, { 56, 60, 63 }, { 58, 62, 65 } };
+
+  Random random(0x2F6E2B1);
+  events.add(0, 0xC0, 33);                               // Electric bass (finger)
+  events.add(0, 0xC1, 0);                                // Acoustic grand piano
+
+  for (uint32_t step = 0; step * sixteenth < duration; step++) {
+    const double time = step * sixteenth;
+    const uint8_t beat = step % 16;                      // 16th note within the bar
+    const uint32_t bar = step / 16;
+
+    events.add(time, drums, beat % 4 == 2 ? 46 : 42, random.next(60, 100));   // Closed hi-hat, open on the off beats
+    if (beat == 0 || beat == 8 || beat == 10) {
+      events.add(time, drums, 36, 120);                  // Kick
+    }
+    if (beat == 4 || beat == 12) {
+      events.add(time, drums, 38, 110);                  // Snare
+    }
+    if (bar % 4 == 3 && beat >= 12) {
+      events.add(time, drums, 50 - (beat - 12) * 2, 100);   // Tom fill
+    }
+    if (bar % 4 == 0 && beat == 0) {
+      events.add(time, drums, 49, 120);                  // Crash
+    }
+
+    if (beat % 2 == 0) {                                 // Bass line in 8th notes
+      const uint8_t note = bassLine[(beat / 2) % 8];
+      events.add(time, 0x90, note, 100);
+      events.add(time + sixteenth * 1.5, 0x80, note, 0);
+    }
+
+    if (beat == 0) {                                     // Chord held for the bar
+      for (uint8_t note : chords[bar % 4]) {
+        events.add(time, 0x91, note, 70);
+        events.add(time + sixteenth * 15, 0x81, note, 0);
+      }
+    }
+  }
+}
+
+static void pitchbend(Events& events, double duration) {
+  constexpr double interval = 0.001;                     // One bend message per 1ms
+  constexpr double period = 2.0;                         // Each channel sweeps down and up over 2s
+
+  uint8_t channels[15];
+  uint8_t numChannels = 0;
+  for (uint8_t channel = 0; channel < 16; channel++) {
+    if (channel != 9) {                                  // (Skip the percussion channel.)
+      channels[numChannels++] = channel;
+      events.add(0, 0xC0 | channel, 16);
+      events.add(0, 0x90 | channel, 40 + numChannels * 3, 100);
+    }
+  }
+
+  for (uint32_t i = 0; i * interval < duration; i++) {
+    const double time = i * interval;
+    const uint8_t index = i % numChannels;
+    double phase = time / period + static_cast<double>(index) / numChannels;
+    phase -= static_cast<uint32_t>(phase);
+    const uint16_t value = static_cast<uint16_t>((phase < 0.5 ? phase * 2 : 2 - phase * 2) * 0x3FFF);
+    events.add(time, 0xE0 | channels[index], value & 0x7F, value >> 7);
+  }
+}
+
+static void storm(Events& events, double duration) {
+  constexpr double interval = 0.001;                     // One note-on per 1ms
+
+  Random random(0x5EED);
+  for (uint8_t channel = 0; channel < 9; channel++) {
+    events.add(0, 0xC0 | channel, channel * 8);          // A different instrument family on each channel
+  }
+
+  for (uint32_t i = 0; i * interval < duration; i++) {
+    events.add(i * interval, 0x90 | random.next(0, 8), random.next(24, 96), random.next(40, 127));
+  }
+}
+
+struct Scenario {
+  const char* name;
+  void (*generate)(Events& events, double duration);    // (Null for 'noteon', which is not rendered.)
+};
+
+static const Scenario scenarios[] = {
+  { "sustained", sustained },
+  { "percussion", percussion },
+  { "pitchbend", pitchbend },
+  { "storm", storm },
+  { "noteon", nullptr },
+};
+
+struct Result {
+  double ns;                                             // Per sample (or per note-on for 'noteon'.)
+  uint32_t checksum;
+};
+
+// Renders 'numFrames' while decoding the given 'events', and returns the elapsed time.
+static Result run(const std::vector<Event>& events, uint32_t numFrames) {
+  constexpr uint32_t blockFrames = 4096;                 // Frames captured between each 'begin()'.
+  static uint16_t samples[blockFrames * 2];
+
+  synth.reset();                                         // Start each run from the power-on state.
+  Midi::reset();
+
+  uint32_t checksum = 0;
+  size_t next = 0;
+  const auto start = std::chrono::steady_clock::now();
+
+  for (uint32_t frame = 0; frame < numFrames;) {
+    const uint32_t blockEnd = std::min(frame + blockFrames, numFrames);
+    MidiSynth::Dac::begin(samples, blockEnd - frame);
+
+    for (; frame < blockEnd; frame++) {
+      while (next < events.size() && events[next].frame <= frame) {
+        const Event& event = events[next++];
+        for (uint8_t i = 0; i < event.length; i++) {
+          Midi::decode(event.bytes[i]);
+        }
+      }
+      synth.isr();
+    }
+
+    for (uint32_t i = 0; i < MidiSynth::Dac::count() * 2; i++) {
+      checksum = checksum * 31 + samples[i];
+    }
+  }
+
+  const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+  return { elapsed.count() * 1e9 / numFrames, checksum };
+}
+
+// Times the note-ons of the 'noteon' scenario, and returns the elapsed time per note-on.  The checksum
+// covers the synth state after each burst of note-ons (e.g., the gain of each voice.)
+static Result runNoteOns(uint32_t& numNoteOns) {
+  static constexpr uint8_t notes[] = { 24, 36, 48, 60, 72, 84, 96 };
+  static constexpr uint8_t velocities[] = { 1, 32, 64, 96, 127 };
+  static constexpr uint8_t repeats = 16;                // Each burst is repeated to amortize reading the clock.
+
+  synth.reset();
+  Midi::reset();
+
+  uint32_t checksum = 0;
+  std::chrono::duration<double> elapsed(0);
+  numNoteOns = 0;
+
+  for (uint16_t program = 0; program <= 128; program++) {
+    const bool isPercussion = program == 128;           // (The last burst plays the percussion notes.)
+    if (!isPercussion) {
+      synth.midiProgramChange(0, static_cast<uint8_t>(program));
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    for (uint8_t repeat = 0; repeat < repeats; repeat++) {
+      for (uint8_t velocity : velocities) {
+        if (isPercussion) {
+          for (uint8_t note = 35; note <= 81; note++) {
+            synth.midiNoteOn(9, note, velocity);
+          }
+        } else {
+          for (uint8_t note : notes) {
+            synth.midiNoteOn(0, note, velocity);
+          }
+        }
+      }
+    }
+    elapsed += std::chrono::steady_clock::now() - start;
+    numNoteOns += repeats * sizeof(velocities) * (isPercussion ? 81 - 35 + 1 : sizeof(notes));
+
+    Snapshot::save(synth, [&](uint8_t byte) { checksum = checksum * 31 + byte; });
+  }
+
+  return { elapsed.count() * 1e9 / numNoteOns, checksum };
+}
+
+int main(int argc, char* argv[]) {
+  bool isJson = false;
+  double seconds = 60.0;                                 // Duration of audio rendered (not wall clock time).
+  uint32_t numRuns = 11;
+  std::vector<const Scenario*> selected;
+  std::vector<std::pair<const Scenario*, uint32_t>> expected;
+
+  for (int i = 1; i < argc; i++) {
+    const Scenario* match = nullptr;
+    for (const Scenario& scenario : scenarios) {
+      if (strcmp(argv[i], scenario.name) == 0) { match = &scenario; }
+    }
+
+    if (strcmp(argv[i], "--json") == 0) {
+      isJson = true;
+    } else if (strcmp(argv[i], "--seconds") == 0 && i + 1 < argc) {
+      seconds = atof(argv[++i]);
+    } else if (strcmp(argv[i], "--runs") == 0 && i + 1 < argc) {
+      numRuns = std::max(1, atoi(argv[++i]));
+    } else if (strcmp(argv[i], "--expect") == 0 && i + 1 < argc) {
+      const char* arg = argv[++i];
+      const char* separator = strchr(arg, '=');
+      const Scenario* scenario = nullptr;
+      for (const Scenario& candidate : scenarios) {
+        if (separator != nullptr && strncmp(arg, candidate.name, separator - arg) == 0 && candidate.name[separator - arg] == '\0') {
+          scenario = &candidate;
+        }
+      }
+      if (scenario == nullptr) {
+        fprintf(stderr, "Error: Expected '--expect <scenario>=<checksum>', but got '%s'.\n", arg);
+        return 1;
+      }
+      expected.emplace_back(scenario, static_cast<uint32_t>(strtoul(separator + 1, nullptr, 16)));
+    } else if (match != nullptr) {
+      selected.push_back(match);
+    } else {
+      fprintf(stderr, "Usage: %s [--json] [--seconds <n>] [--runs <n>] [--expect <scenario>=<checksum>...] [sustained|percussion|pitchbend|storm|noteon...]\n", argv[0]);
+      return 1;
+    }
+  }
+
+  if (selected.empty()) {
+    for (const Scenario& scenario : scenarios) { selected.push_back(&scenario); }
+  }
+
+  const uint32_t numFrames = Events::frameAt(seconds);
+  if (numFrames == 0) {
+    fprintf(stderr, "Error: '--seconds' must be positive.\n");
+    return 1;
+  }
+
+  synth.begin();
+  bool succeeded = true;
+
+  if (isJson) {
+    printf("{\n  \"layout\": \"%s\",\n  \"sampleRate\": %.3f,\n  \"seconds\": %g,\n  \"runs\": %u,\n  \"scenarios\": [",
+      layout, MidiSynth::sampleRate, seconds, numRuns);
+  }
+
+  for (size_t s = 0; s < selected.size(); s++) {
+    const bool isNoteOn = selected[s]->generate == nullptr;
+    Events events;
+    if (!isNoteOn) {
+      selected[s]->generate(events, seconds);
+    }
+    const std::vector<Event>& sorted = events.sorted();
+
+    std::vector<double> times;
+    uint32_t checksum = 0;
+    uint32_t numNoteOns = 0;
+    for (uint32_t r = 0; r <= numRuns; r++) {
+      const Result result = isNoteOn ? runNoteOns(numNoteOns) : run(sorted, numFrames);
+      if (r > 0) {                                       // (The first run warms up the caches and is discarded.)
+        times.push_back(result.ns);
+        if (result.checksum != checksum) {
+          fprintf(stderr, "Error: Run %u of '%s' has checksum %08x, but the first run has %08x.\n",
+            r + 1, selected[s]->name, result.checksum, checksum);
+          succeeded = false;
+        }
+      }
+      checksum = result.checksum;
+    }
+    std::sort(times.begin(), times.end());
+
+    for (const auto& expect : expected) {
+      if (expect.first == selected[s] && expect.second != checksum) {
+        fprintf(stderr, "Error: '%s' has checksum %08x, but %08x was expected.\n", selected[s]->name, checksum, expect.second);
+        succeeded = false;
+      }
+    }
+
+    const double median = times[times.size() / 2];
+    const double q1 = times[times.size() / 4];                // Interquartile range (nearest rank.)
+    const double q3 = times[(times.size() * 3) / 4];
+
+    if (isNoteOn) {
+      if (isJson) {
+        printf("%s\n    { \"name\": \"%s\", \"noteOns\": %u, \"nsPerNoteOn\": %.3f, "
+          "\"nsPerNoteOnQ1\": %.3f, \"nsPerNoteOnQ3\": %.3f, \"nsPerNoteOnMin\": %.3f, \"nsPerNoteOnMax\": %.3f, "
+          "\"checksum\": \"%08x\" }",
+          s == 0 ? "" : ",", selected[s]->name, numNoteOns, median, q1, q3, times.front(), times.back(), checksum);
+      } else {
+        printf("%s %-10s %8.2f ns/note-on (IQR %.2f .. %.2f, range %.2f .. %.2f) (%u note-ons, checksum %08x)\n",
+          layout, selected[s]->name, median, q1, q3, times.front(), times.back(), numNoteOns, checksum);
+      }
+      continue;
+    }
+
+    const double nsPerSample = median;
+    const double samplesPerSecond = 1e9 / nsPerSample;
+    const double realtimeFactor = samplesPerSecond / MidiSynth::sampleRate;
+
+    if (isJson) {
+      printf("%s\n    { \"name\": \"%s\", \"samples\": %u, \"messages\": %zu, \"nsPerSample\": %.3f, "
+        "\"nsPerSampleQ1\": %.3f, \"nsPerSampleQ3\": %.3f, \"nsPerSampleMin\": %.3f, \"nsPerSampleMax\": %.3f, "
+        "\"samplesPerSecond\": %.0f, \"realtimeFactor\": %.1f, \"checksum\": \"%08x\" }",
+        s == 0 ? "" : ",", selected[s]->name, numFrames, sorted.size(), nsPerSample, q1, q3, times.front(), times.back(),
+        samplesPerSecond, realtimeFactor, checksum);
+    } else {
+      printf("%s %-10s %8.2f ns/sample (IQR %.2f .. %.2f, range %.2f .. %.2f) %12.0f samples/s %8.0fx real time (%zu messages, checksum %08x)\n",
+        layout, selected[s]->name, nsPerSample, q1, q3, times.front(), times.back(), samplesPerSecond, realtimeFactor,
+        sorted.size(), checksum);
+    }
+  }
+
+  if (isJson) {
+    printf("\n  ]\n}\n");
+  }
+  return succeeded ? 0 : 1;
+}
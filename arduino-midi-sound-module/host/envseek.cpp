@@ -0,0 +1,96 @@
+/*
+    Envelope seek check
+    https://github.com/DLehenbauer/arduino-midi-sound-module
+
+    Checks that 'Envelope::seek()' produces the same state as starting the envelope generator and
+    calling 'sample()' repeatedly (with 'stop()' after 'releaseStep' samples), for every EnvelopeProgram
+    and each of several release points, e.g.:
+
+        programs  release points  seeks compared  mismatches
+             256               6         3431424           0
+
+    Usage: envseek [--steps <n>]
+
+    For each program and release point, the reference generator is sampled 'steps' times (default
+    20000, i.e., ~4.3 minutes of envelope at 256 samples per step), and 'seek()' is compared with it
+    after every step up to 2048 and after every 97th step thereafter.  The state is compared as it is
+    saved by 'Envelope::serialize()'.  Exits with 1 if any state differs.
+*/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include "../capturedac.h"
+
+#define DAC CaptureDac
+
+#include "../midisynth.h"
+#include "../snapshot.h"
+
+// Returns the state of the given envelope generator, as saved by 'serialize()'.
+static std::vector<uint8_t> getState(volatile Envelope& envelope) {
+  std::vector<uint8_t> bytes;
+  auto write = [&](uint8_t byte) { bytes.push_back(byte); };
+  SnapshotWriter<decltype(write)> writer(write);
+  envelope.serialize(writer);
+  return bytes;
+}
+
+int main(int argc, char* argv[]) {
+  uint32_t numSteps = 20000;
+
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--steps") == 0 && i + 1 < argc) {
+      numSteps = static_cast<uint32_t>(atol(argv[++i]));
+    } else {
+      fprintf(stderr, "Usage: %s [--steps <n>]\n", argv[0]);
+      return 1;
+    }
+  }
+
+  static constexpr uint32_t releaseSteps[] = { 0, 1, 7, 100, 1500, Envelope::never };
+
+  const HeapRegion<EnvelopeProgram> programs = Instruments::getEnvelopePrograms();
+  const uint32_t numPrograms = static_cast<uint32_t>((programs.end - programs.start) / programs.itemSize);
+
+  uint64_t numSeeks = 0;
+  uint32_t numMismatches = 0;
+
+  for (uint32_t program = 0; program < numPrograms; program++) {
+    for (const uint32_t releaseStep : releaseSteps) {
+      Envelope reference;
+      EnvelopeStart start;
+      Instruments::getEnvelopeStart(static_cast<uint8_t>(program), start);
+      reference.start(start);
+
+      for (uint32_t step = 0; step <= numSteps; step++) {
+        if (step == releaseStep) {
+          reference.stop();
+        }
+
+        if (step <= 2048 || step % 97 == 0) {
+          Envelope sought;
+          sought.seek(static_cast<uint8_t>(program), step, releaseStep);
+          numSeeks++;
+
+          if (getState(sought) != getState(reference)) {
+            if (numMismatches++ < 10) {
+              fprintf(stderr, "Error: Program %u, release %d: 'seek(%u)' differs from 'sample()'.\n",
+                program, releaseStep == Envelope::never ? -1 : static_cast<int>(releaseStep), step);
+            }
+          }
+        }
+
+        reference.sample();
+      }
+    }
+  }
+
+  printf("programs  release points  seeks compared  mismatches\n");
+  printf("%8u  %14zu  %14llu  %10u\n", numPrograms, sizeof(releaseSteps) / sizeof(releaseSteps[0]),
+    static_cast<unsigned long long>(numSeeks), numMismatches);
+
+  return numMismatches == 0 ? 0 : 1;
+}
@@ -0,0 +1,445 @@
+/*
+    Instrument table generator
+    https://github.com/DLehenbauer/arduino-midi-sound-module
+
+    Generates 'instruments_generated.h' from the source description in 'instruments.txt' (see the
+    comment at the top of that file for the format).
+
+    Usage: instgen <instruments.txt> <instruments_generated.h>
+
+    Envelope programs frequently share stages (e.g., most programs end with the same release stages,
+    and nearly all end with '{ 0, -64 }').  Because each program only references its first stage, a
+    program whose stages appear as a contiguous run elsewhere in 'EnvelopeStages' (e.g., as a suffix
+    of a longer program) can simply point into that run.  Programs are placed longest first, and each
+    is either found within the stages already placed, overlapped with the tail of the table, or
+    appended.
+
+    Each instrument is emitted as a self-contained 'InstrumentRecord' (see 'instruments.h') holding
+    the wave offset, flags, and the start of all three envelope programs (including their first stage),
+    so that 'Synth::noteOn()' reads everything it needs with a single contiguous copy from PROGMEM.
+    Instruments with identical records share a single record, and 'instruments' maps each MIDI program
+    (and percussion instrument) to its record.  The alternate amplitude envelopes of instruments with
+    'InstrumentFlags_SelectAmplitude' are stored separately in 'AmpModVariants'.  ('EnvelopePrograms'
+    is only emitted for host and Emscripten builds, where it is used by tools.)
+
+    After generating, the size of each table is reported along with the savings relative to the tables
+    currently compiled into the tool (i.e., the previous 'instruments_generated.h').  If the wavetable
+    changed, rebuild and rerun 'wavepack' to regenerate 'wavetable_generated.h'.
+*/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "../instruments.h"
+
+#ifdef WAVETABLE_SEGMENTS
+#error "instgen must be built against the uncompressed wavetable (i.e., without WAVETABLE_SEGMENTS)."
+#endif
+
+// Sizes of the generated types on AVR (i.e., packed, with 16-bit pointers).
+static constexpr size_t avrStageSize = 3;
+static constexpr size_t avrStartSize = 7;
+static constexpr size_t avrRecordSize = 5 + 3 * avrStartSize;
+
+static constexpr size_t numPrograms = 256;
+static constexpr size_t waveSize = 256;
+static constexpr size_t numAmpModVariants = 3;           // Alternate amplitude envelopes for InstrumentFlags_SelectAmplitude
+static constexpr uint8_t selectAmplitude = 1 << 2;      // InstrumentFlags_SelectAmplitude
+
+struct Stage {
+  int16_t slope;
+  int8_t limit;
+
+  bool operator==(const Stage& other) const { return slope == other.slope && limit == other.limit; }
+};
+
+struct Program {
+  bool isDefined = false;
+  uint8_t initialValue = 0;
+  uint8_t loopStart = 0;
+  uint8_t loopEnd = 0;
+  std::vector<Stage> stages;
+  size_t start = 0;                                     // Index of the first stage in the generated 'EnvelopeStages'.
+};
+
+struct InstrumentSource {
+  uint16_t wave;
+  uint8_t ampMod;
+  uint8_t freqMod;
+  uint8_t waveMod;
+  uint8_t xorBits;
+  uint8_t flags;
+  std::string name;
+
+  // True if the given instrument would be emitted as an identical 'InstrumentRecord'.
+  bool hasSameRecord(const InstrumentSource& other) const {
+    return wave == other.wave && ampMod == other.ampMod && freqMod == other.freqMod
+      && waveMod == other.waveMod && xorBits == other.xorBits && flags == other.flags;
+  }
+};
+
+struct PercussionSource {
+  uint8_t note;
+  uint8_t playbackNote;
+  std::string name;
+};
+
+class Source final {
+  private:
+    std::string _path;
+    size_t _lineNumber = 0;
+    bool _ok = true;
+
+    void error(const char* message) {
+      fprintf(stderr, "%s(%zu): Error: %s\n", _path.c_str(), _lineNumber, message);
+      _ok = false;
+    }
+
+    // Reads an integer in the range [min .. max] from 'line'.
+    bool read(std::istringstream& line, long min, long max, long& value) {
+      if (!(line >> value)) {
+        error("Expected a number.");
+        return false;
+      }
+      if (value < min || value > max) {
+        error("Value out of range.");
+        return false;
+      }
+      return true;
+    }
+
+    // Returns the remainder of 'line' (less leading whitespace), used for names.
+    static std::string rest(std::istringstream& line) {
+      std::string name;
+      std::getline(line >> std::ws, name);
+      return name;
+    }
+
+  public:
+    Program programs[numPrograms];
+    std::vector<int8_t> waves;
+    std::vector<InstrumentSource> instruments;
+    std::vector<PercussionSource> percussion;
+
+    bool load(const char* path) {
+      _path = path;
+      std::ifstream file(path);
+      if (!file) {
+        fprintf(stderr, "Error: Unable to read '%s'.\n", path);
+        return false;
+      }
+
+      enum { None, InEnvelope, InWave } section = None;
+      Program* pProgram = nullptr;
+      size_t waveEnd = 0;
+
+      std::string text;
+      while (std::getline(file, text)) {
+        _lineNumber++;
+        if (!text.empty() && text.back() == '\r') { text.pop_back(); }
+
+        std::istringstream line(text);
+        std::string keyword;
+        if (!(line >> keyword) || keyword[0] == '#') {
+          continue;
+        }
+
+        long a, b, c, d, e, f, g;
+        if (keyword == "envelope") {
+          if (!read(line, 0, numPrograms - 1, a) || !read(line, 0, 255, b) || !read(line, 0, 15, c) || !read(line, 0, 15, d)) { continue; }
+          pProgram = &programs[a];
+          if (pProgram->isDefined) { error("Envelope program defined more than once."); }
+          pProgram->isDefined = true;
+          pProgram->initialValue = b;
+          pProgram->loopStart = c;
+          pProgram->loopEnd = d;
+          section = InEnvelope;
+        } else if (keyword == "wave") {
+          if (!read(line, 0, 255, a)) { continue; }
+          if (static_cast<size_t>(a) * waveSize != waves.size()) { error("Waves must be defined in order."); }
+          waveEnd = waves.size() + waveSize;
+          section = InWave;
+        } else if (keyword == "instrument") {
+          if (!read(line, 0, 255, a) || !read(line, 0, 0xFFFF, b) || !read(line, 0, 255, c) || !read(line, 0, 255, d)
+            || !read(line, 0, 255, e) || !read(line, 0, 255, f) || !read(line, 0, 255, g)) { continue; }
+          if (static_cast<size_t>(a) != instruments.size()) { error("Instruments must be defined in order."); }
+          instruments.push_back({
+            static_cast<uint16_t>(b), static_cast<uint8_t>(c), static_cast<uint8_t>(d), static_cast<uint8_t>(e),
+            static_cast<uint8_t>(f), static_cast<uint8_t>(g), rest(line) });
+          section = None;
+        } else if (keyword == "percussion") {
+          if (!read(line, 0, 127, a) || !read(line, 0, 127, b)) { continue; }
+          percussion.push_back({ static_cast<uint8_t>(a), static_cast<uint8_t>(b), rest(line) });
+          section = None;
+        } else if (section == InEnvelope) {
+          line.str(text);
+          line.clear();
+          if (!read(line, INT16_MIN, INT16_MAX, a) || !read(line, INT8_MIN, INT8_MAX, b)) { continue; }
+          pProgram->stages.push_back({ static_cast<int16_t>(a), static_cast<int8_t>(b) });
+        } else if (section == InWave) {
+          line.str(text);
+          line.clear();
+          while (line >> std::ws, !line.eof()) {
+            if (!read(line, INT8_MIN, INT8_MAX, a)) { break; }
+            if (waves.size() == waveEnd) { error("Too many samples in wave."); break; }
+            waves.push_back(static_cast<int8_t>(a));
+          }
+        } else {
+          error("Unexpected line.");
+        }
+      }
+
+      if (waves.size() != waveEnd) { error("Too few samples in wave."); }
+
+      for (size_t i = 0; i < numPrograms; i++) {
+        if (!programs[i].isDefined || programs[i].stages.empty()) {
+          fprintf(stderr, "%s: Error: Envelope program %zu is undefined or has no stages.\n", path, i);
+          _ok = false;
+        }
+      }
+
+      for (const InstrumentSource& instrument : instruments) {
+        if (instrument.wave >= waves.size()) {
+          fprintf(stderr, "%s: Error: Instrument '%s' wave offset is outside the wavetable.\n", path, instrument.name.c_str());
+          _ok = false;
+        }
+      }
+
+      return _ok;
+    }
+};
+
+// Returns the number of characters in the given UTF-8 string (for aligning names in comments).
+static size_t utf8Length(const std::string& str) {
+  size_t length = 0;
+  for (unsigned char ch : str) {
+    if ((ch & 0xC0) != 0x80) { length++; }
+  }
+  return length;
+}
+
+static std::string padLeft(const std::string& str, size_t width) {
+  const size_t length = utf8Length(str);
+  return length < width
+    ? std::string(width - length, ' ') + str
+    : str;
+}
+
+// Places each program's stages in 'table', sharing stages between programs where possible.
+static void layoutStages(Program programs[], std::vector<Stage>& table) {
+  std::vector<Program*> order;
+  for (size_t i = 0; i < numPrograms; i++) { order.push_back(&programs[i]); }
+
+  // Place longer programs first, so that shorter programs are more likely to be found within them.
+  std::stable_sort(order.begin(), order.end(), [](const Program* left, const Program* right) {
+    return left->stages.size() > right->stages.size();
+  });
+
+  for (Program* pProgram : order) {
+    const std::vector<Stage>& stages = pProgram->stages;
+    const size_t length = stages.size();
+
+    // If the program's stages already appear in the table, point into the existing run.
+    auto found = std::search(table.begin(), table.end(), stages.begin(), stages.end());
+    if (found != table.end()) {
+      pProgram->start = found - table.begin();
+      continue;
+    }
+
+    // Otherwise, overlap the longest prefix of the program that matches the tail of the table.
+    size_t overlap = std::min(length - 1, table.size());
+    while (overlap > 0 && !std::equal(stages.begin(), stages.begin() + overlap, table.end() - overlap)) {
+      overlap--;
+    }
+
+    pProgram->start = table.size() - overlap;
+    table.insert(table.end(), stages.begin() + overlap, stages.end());
+  }
+}
+
+// Emits the 'EnvelopeStart' initializer for the given program.
+static void printStart(FILE* file, const Program programs[], uint8_t index) {
+  const Program& program = programs[index];
+  fprintf(file, "{ &EnvelopeStages[0x%04zx], %4d, 0x%02x, { %6d, %4d } },   /* program %02x */",
+    program.start, program.initialValue, (program.loopStart << 4) | program.loopEnd,
+    program.stages[0].slope, program.stages[0].limit, index);
+}
+
+static void report(const char* table, size_t before, size_t after) {
+  printf("  %-18s %6zu -> %6zu bytes", table, before, after);
+  if (after <= before) {
+    printf(" (saves %zu bytes)\n", before - after);
+  } else {
+    printf(" (+%zu bytes)\n", after - before);
+  }
+}
+
+int main(int argc, char* argv[]) {
+  if (argc != 3) {
+    fprintf(stderr, "Usage: %s <instruments.txt> <instruments_generated.h>\n", argv[0]);
+    return 1;
+  }
+
+  Source source;
+  if (!source.load(argv[1])) {
+    return 1;
+  }
+
+  std::vector<Stage> stages;
+  layoutStages(source.programs, stages);
+
+  if (stages.size() > 0xFFFF) {
+    fprintf(stderr, "Error: Too many envelope stages.\n");
+    return 1;
+  }
+
+  std::vector<size_t> records;                          // Index in 'source.instruments' of the first instrument using each record.
+  std::vector<uint8_t> recordIndex;                     // Record for each instrument.
+  std::vector<size_t> variants;                         // Index of the first of each record's 'AmpModVariants' (if any).
+  size_t numVariants = 0;
+
+  for (const InstrumentSource& instrument : source.instruments) {
+    size_t record = 0;
+    while (record < records.size() && !source.instruments[records[record]].hasSameRecord(instrument)) {
+      record++;
+    }
+
+    if (record == records.size()) {
+      records.push_back(&instrument - &source.instruments[0]);
+      variants.push_back(numVariants);
+      if (instrument.flags & selectAmplitude) {
+        numVariants += numAmpModVariants;
+      }
+    }
+
+    recordIndex.push_back(static_cast<uint8_t>(record));
+  }
+
+  if (records.size() > 0x100 || numVariants > 0x100) {
+    fprintf(stderr, "Error: Too many unique instruments.\n");
+    return 1;
+  }
+
+  FILE* file = fopen(argv[2], "w");
+  if (file == nullptr) {
+    fprintf(stderr, "Error: Unable to write '%s'.\n", argv[2]);
+    return 1;
+  }
+
+  fprintf(file, "/*\n");
+  fprintf(file, "    Instruments programs and wavetable\n");
+  fprintf(file, "    https://github.com/DLehenbauer/arduino-midi-sound-module\n");
+  fprintf(file, "\n");
+  fprintf(file, "    Generated by 'host/instgen.cpp' from 'instruments.txt'.  Do not edit.\n");
+  fprintf(file, "*/\n\n");
+
+  fprintf(file, "static constexpr EnvelopeStage EnvelopeStages[] PROGMEM = {\n");
+  for (size_t i = 0; i < stages.size(); i++) {
+    fprintf(file, "\t/* %04zx: */ { %6d, %4d },\n", i, stages[i].slope, stages[i].limit);
+  }
+  fprintf(file, "};\n\n");
+
+  fprintf(file, "#ifndef __AVR__\n");
+  fprintf(file, "static constexpr EnvelopeProgram EnvelopePrograms[] PROGMEM = {\n");
+  for (size_t i = 0; i < numPrograms; i++) {
+    const Program& program = source.programs[i];
+    fprintf(file, "\t/* %02zx: */ { &EnvelopeStages[0x%04zx], %4d, 0x%02x },\n",
+      i, program.start, program.initialValue, (program.loopStart << 4) | program.loopEnd);
+  }
+  fprintf(file, "};\n");
+  fprintf(file, "#endif // !__AVR__\n\n");
+
+  fprintf(file, "#ifndef WAVETABLE_SEGMENTS\n");
+  fprintf(file, "static constexpr int8_t Waveforms[] PROGMEM = {\n");
+  for (size_t offset = 0; offset < source.waves.size(); offset += 32) {
+    if (offset % waveSize == 0) {
+      fprintf(file, offset == 0 ? "\t/* Wave %zu */\n" : "\t\n\t/* Wave %zu */\n", offset / waveSize);
+    }
+    fprintf(file, "\t/* %04zx: */", offset);
+    for (size_t i = offset; i < offset + 32 && i < source.waves.size(); i++) {
+      fprintf(file, " %4d,", source.waves[i]);
+    }
+    fprintf(file, "\n");
+  }
+  fprintf(file, "};\n");
+  fprintf(file, "#endif // !WAVETABLE_SEGMENTS\n\n");
+
+  fprintf(file, "static constexpr EnvelopeStart AmpModVariants[] PROGMEM = {\n");
+  if (numVariants == 0) {
+    fprintf(file, "\t/* (unused) */ { &EnvelopeStages[0], 0, 0x00, { 0, -64 } },\n");
+  }
+  for (size_t record = 0; record < records.size(); record++) {
+    const InstrumentSource& instrument = source.instruments[records[record]];
+    if (instrument.flags & selectAmplitude) {
+      for (size_t i = 0; i < numAmpModVariants; i++) {
+        fprintf(file, "\t/* %02zx: */ ", variants[record] + i);
+        printStart(file, source.programs, instrument.ampMod + i + 1);
+        fprintf(file, "\n");
+      }
+    }
+  }
+  fprintf(file, "};\n\n");
+
+  fprintf(file, "static constexpr InstrumentRecord InstrumentRecords[] PROGMEM = {\n");
+  for (size_t record = 0; record < records.size(); record++) {
+    const InstrumentSource& instrument = source.instruments[records[record]];
+    fprintf(file, "\t/* %02zx: %s */ {\n", record, padLeft(instrument.name, 28).c_str());
+    fprintf(file, "\t\t/* waveOffset: */ %u,\n", instrument.wave);
+    fprintf(file, "\t\t/* xor:        */ %u,\n", instrument.xorBits);
+    fprintf(file, "\t\t/* flags:      */ static_cast<InstrumentFlags>(%u),\n", instrument.flags);
+    fprintf(file, "\t\t/* variants:   */ 0x%02zx,\n", (instrument.flags & selectAmplitude) ? variants[record] : 0);
+    fprintf(file, "\t\t/* ampMod:     */ ");
+    printStart(file, source.programs, instrument.ampMod);
+    fprintf(file, "\n\t\t/* freqMod:    */ ");
+    printStart(file, source.programs, instrument.freqMod);
+    fprintf(file, "\n\t\t/* waveMod:    */ ");
+    printStart(file, source.programs, instrument.waveMod);
+    fprintf(file, "\n\t},\n");
+  }
+  fprintf(file, "};\n\n");
+
+  fprintf(file, "static constexpr uint8_t instruments[] PROGMEM = {\n");
+  for (size_t i = 0; i < source.instruments.size(); i++) {
+    fprintf(file, "\t/* %3zu: %s */ 0x%02x,\n", i, padLeft(source.instruments[i].name, 28).c_str(), recordIndex[i]);
+  }
+  fprintf(file, "};\n\n");
+
+  fprintf(file, "static constexpr uint8_t percussionNotes[] PROGMEM = {\n");
+  for (const PercussionSource& percussion : source.percussion) {
+    fprintf(file, "\t/* %2u: %s */ 0x%02x,\n", percussion.note, padLeft(percussion.name, 18).c_str(), percussion.playbackNote);
+  }
+  fprintf(file, "};");
+
+  const bool ok = !ferror(file);
+  if (fclose(file) != 0 || !ok) {
+    fprintf(stderr, "Error: Unable to write '%s'.\n", argv[2]);
+    return 1;
+  }
+
+  // Report the size of each generated table relative to the tables compiled into this tool.
+  const HeapRegion<EnvelopeStage> oldStages = Instruments::getEnvelopeStages();
+  const HeapRegion<int8_t> oldWaves = Instruments::getWavetable();
+  const HeapRegion<EnvelopeStart> oldVariants = Instruments::getAmpModVariants();
+  const HeapRegion<InstrumentRecord> oldRecords = Instruments::getInstrumentRecords();
+  const HeapRegion<uint8_t> oldInstruments = Instruments::getInstruments();
+  const HeapRegion<uint8_t> oldPercussion = Instruments::getPercussionNotes();
+
+  size_t unshared = 0;
+  for (size_t i = 0; i < numPrograms; i++) { unshared += source.programs[i].stages.size(); }
+
+  printf("%s: %zu envelope stages (%zu before sharing), %zu programs, %zu waves, %zu instruments (%zu unique)\n",
+    argv[2], stages.size(), unshared, numPrograms, source.waves.size() / waveSize, source.instruments.size(), records.size());
+
+  report("EnvelopeStages", (oldStages.end - oldStages.start) / oldStages.itemSize * avrStageSize, stages.size() * avrStageSize);
+  report("Waveforms", oldWaves.end - oldWaves.start, source.waves.size());
+  report("AmpModVariants", (oldVariants.end - oldVariants.start) / oldVariants.itemSize * avrStartSize, std::max<size_t>(numVariants, 1) * avrStartSize);
+  report("InstrumentRecords", (oldRecords.end - oldRecords.start) / oldRecords.itemSize * avrRecordSize, records.size() * avrRecordSize);
+  report("instruments", oldInstruments.end - oldInstruments.start, source.instruments.size());
+  report("percussionNotes", oldPercussion.end - oldPercussion.start, source.percussion.size());
+
+  return 0;
+}
@@ -0,0 +1,186 @@
+/*
+    Standard MIDI File reader (host only)
+    https://github.com/DLehenbauer/arduino-midi-sound-module
+
+    Loads a format 0 or 1 Standard MIDI File and flattens all tracks into a single list of channel
+    and sysex messages sorted by time (in seconds).
+
+    Running status is expanded so that each message begins with its status byte, as expected by
+    'Midi::decode()'.  Meta events are not emitted, but tempo changes are applied to event times.
+*/
+
+#ifndef __MIDIFILE_H__
+#define __MIDIFILE_H__
+
+#include <stdint.h>
+#include <stdio.h>
+#include <algorithm>
+#include <vector>
+
+struct MidiEvent {
+  double time;                                          // Seconds from the start of the song.
+  std::vector<uint8_t> bytes;                           // Message bytes, beginning with the status byte.
+};
+
+class MidiFile final {
+  private:
+    struct TickEvent {
+      uint32_t tick;
+      uint32_t order;                                   // Preserves file order for events on the same tick.
+      std::vector<uint8_t> bytes;
+    };
+
+    struct Tempo {
+      uint32_t tick;
+      uint32_t usPerQuarter;
+    };
+
+    std::vector<uint8_t> _data;
+    size_t _pos = 0;
+    std::vector<MidiEvent> _events;
+
+    bool has(size_t length) const { return _pos + length <= _data.size(); }
+
+    uint32_t readBE(uint8_t length) {
+      uint32_t value = 0;
+      while (length--) { value = (value << 8) | _data[_pos++]; }
+      return value;
+    }
+
+    bool readVarLen(uint32_t& value) {
+      value = 0;
+      for (uint8_t i = 0; i < 4; i++) {
+        if (!has(1)) { return false; }
+        const uint8_t b = _data[_pos++];
+        value = (value << 7) | (b & 0x7F);
+        if (!(b & 0x80)) { return true; }
+      }
+      return false;
+    }
+
+    bool readTrack(size_t end, uint32_t& order, std::vector<TickEvent>& events, std::vector<Tempo>& tempos) {
+      uint32_t tick = 0;
+      uint8_t status = 0;
+
+      while (_pos < end) {
+        uint32_t delta;
+        if (!readVarLen(delta) || !has(1)) { return false; }
+        tick += delta;
+
+        uint8_t b = _data[_pos];
+        if (b & 0x80) { _pos++; }                       // New status byte,
+        else if (status != 0) { b = status; }           // otherwise reuse the running status.
+        else { return false; }
+
+        if (b == 0xFF) {                                // Meta event
+          status = 0;
+          if (!has(1)) { return false; }
+          const uint8_t type = _data[_pos++];
+          uint32_t length;
+          if (!readVarLen(length) || !has(length)) { return false; }
+          if (type == 0x51 && length == 3) {            // Set Tempo
+            tempos.push_back({ tick, readBE(3) });
+          } else {
+            _pos += length;
+            if (type == 0x2F) { break; }                // End of Track
+          }
+        } else if (b == 0xF0 || b == 0xF7) {            // Sysex (F0) or escaped bytes (F7)
+          status = 0;
+          uint32_t length;
+          if (!readVarLen(length) || !has(length)) { return false; }
+          TickEvent event = { tick, order++, {} };
+          if (b == 0xF0) { event.bytes.push_back(0xF0); }
+          event.bytes.insert(event.bytes.end(), _data.begin() + _pos, _data.begin() + _pos + length);
+          _pos += length;
+          events.push_back(event);
+        } else {                                        // Channel message
+          status = b;
+          const uint8_t length = ((b & 0xE0) == 0xC0) ? 1 : 2;
+          if (!has(length)) { return false; }
+          TickEvent event = { tick, order++, { b } };
+          for (uint8_t i = 0; i < length; i++) { event.bytes.push_back(_data[_pos++]); }
+          events.push_back(event);
+        }
+      }
+
+      _pos = end;
+      return true;
+    }
+
+  public:
+    // Loads the given file.  Returns false if the file could not be read or is not a valid SMF.
+    bool load(const char* path) {
+      FILE* file = fopen(path, "rb");
+      if (file == nullptr) { return false; }
+      _data.clear();
+      uint8_t buffer[4096];
+      size_t count;
+      while ((count = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+        _data.insert(_data.end(), buffer, buffer + count);
+      }
+      fclose(file);
+      _pos = 0;
+
+      if (!has(14) || readBE(4) != 0x4D546864 || readBE(4) != 6) { return false; }  // "MThd"
+      readBE(2);                                        // Format (0 and 1 are handled identically.)
+      const uint16_t numTracks = readBE(2);
+      const uint16_t division = readBE(2);
+
+      std::vector<TickEvent> events;
+      std::vector<Tempo> tempos;
+      uint32_t order = 0;
+
+      for (uint16_t track = 0; track < numTracks && has(8); track++) {
+        const uint32_t id = readBE(4);
+        const uint32_t length = readBE(4);
+        if (!has(length)) { return false; }
+        const size_t end = _pos + length;
+        if (id != 0x4D54726B) { _pos = end; continue; } // Skip unknown chunks (not "MTrk")
+        if (!readTrack(end, order, events, tempos)) { return false; }
+      }
+
+      std::stable_sort(events.begin(), events.end(), [](const TickEvent& a, const TickEvent& b) {
+        return a.tick != b.tick ? a.tick < b.tick : a.order < b.order;
+      });
+      std::stable_sort(tempos.begin(), tempos.end(), [](const Tempo& a, const Tempo& b) {
+        return a.tick < b.tick;
+      });
+
+      // Convert ticks to seconds.  For SMPTE time division, ticks are a fixed fraction of a second.
+      // Otherwise, the duration of a tick is given by the tempo in effect (default 120 bpm).
+      const bool isSmpte = (division & 0x8000) != 0;
+      const double ticksPerSecond = -static_cast<int8_t>(division >> 8) * static_cast<double>(division & 0xFF);
+      const double ticksPerQuarter = division & 0x7FFF;
+
+      double usPerQuarter = 500000;
+      double baseTime = 0;
+      uint32_t baseTick = 0;
+      size_t nextTempo = 0;
+
+      _events.clear();
+      for (const TickEvent& event : events) {
+        double time;
+        if (isSmpte) {
+          time = event.tick / ticksPerSecond;
+        } else {
+          while (nextTempo < tempos.size() && tempos[nextTempo].tick <= event.tick) {
+            baseTime += (tempos[nextTempo].tick - baseTick) * usPerQuarter / ticksPerQuarter / 1e6;
+            baseTick = tempos[nextTempo].tick;
+            usPerQuarter = tempos[nextTempo].usPerQuarter;
+            nextTempo++;
+          }
+          time = baseTime + (event.tick - baseTick) * usPerQuarter / ticksPerQuarter / 1e6;
+        }
+        _events.push_back({ time, event.bytes });
+      }
+
+      return true;
+    }
+
+    const std::vector<MidiEvent>& events() const { return _events; }
+
+    // Time of the last event in seconds.
+    double duration() const { return _events.empty() ? 0 : _events.back().time; }
+};
+
+#endif //__MIDIFILE_H__
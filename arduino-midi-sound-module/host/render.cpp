@@ -0,0 +1,368 @@
+/*
+    Host renderer
+    https://github.com/DLehenbauer/arduino-midi-sound-module
+
+    Renders a Standard MIDI File to a 16-bit WAV file by running the firmware's MIDI decoder and
+    sample/mix ISR on the host against the mock AVR environment (see 'build-host.sh').
+
+    Usage: render [-j jobs] [-c seconds checkpoint.bin] [-r checkpoint.bin] <input.mid> <output.wav>
+
+    When built with -DVOICE_STATS (as by 'build-host.sh'), the voice usage counters collected while
+    rendering are printed afterwards (see 'voicestats.h').
+
+    MIDI messages are fed to 'Midi::decode()' at the first sample on or after their scheduled time,
+    and 'synth.isr()' is invoked once per output sample.  The output is captured by
+    'StereoCaptureDac' (or 'CaptureDac' when built with -DRENDER_MONO).
+
+    With '-j', the song is split into 'jobs' sections that are rendered in parallel by worker
+    processes.  The parent process runs through the song with 'synth.skip()', which advances the
+    control state (envelopes, phase, noise LFSR, etc.) without mixing, and forks a worker at the start
+    of each section.  The worker inherits a snapshot of the synth, decoder and player state, and
+    renders its section into a shared output buffer.  The output is identical to a sequential render.
+    (Sections are rendered by processes rather than threads because the MIDI decoder and the capture
+    DAC are static.)
+
+    With '-c', a checkpoint is saved when the render reaches the given time.  The checkpoint holds the
+    position in the song followed by a snapshot of the synth and decoder state (see 'snapshot.h').
+    With '-r', the render resumes from a checkpoint previously saved for the same MIDI file, and the
+    output begins at the checkpoint.  (For example, to listen to a glitch near the end of a long song
+    without rendering it from the start each time.)
+*/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <algorithm>
+#include <vector>
+#include "../capturedac.h"
+
+#ifdef RENDER_MONO
+#define DAC CaptureDac
+#else
+#define DAC StereoCaptureDac
+#endif
+
+#include "../midi.h"
+#include "../midisynth.h"
+#include "../snapshot.h"
+#include "midifile.h"
+#include "wavfile.h"
+
+MidiSynth synth;
+
+// The below thunks are invoked by Midi::decode() and forwarded to our MidiSynth.
+void noteOn(uint8_t channel, uint8_t note, uint8_t velocity)        { synth.midiNoteOn(channel, note, velocity); }
+void noteOff(uint8_t channel, uint8_t note)                         { synth.midiNoteOff(channel, note); }
+void sysex(uint8_t cbData, uint8_t data[])                          { synth.midiSysex(cbData, data, [](uint8_t) { /* discard replies */ }); }
+void controlChange(uint8_t channel, uint8_t control, uint8_t value) { synth.midiControlChange(channel, control, value); }
+void programChange(uint8_t channel, uint8_t value)                  { synth.midiProgramChange(channel, value); }
+void pitchBend(uint8_t channel, int16_t value)                      { synth.midiPitchBend(channel, value); }
+
+// Feeds the events of a MIDI file to 'Midi::decode()' as the song is rendered.
+class Player final {
+  private:
+    const std::vector<MidiEvent>& _events;
+    const double _sampleRate;
+    size_t _next = 0;                                   // Index of the next event to send.
+
+  public:
+    Player(const std::vector<MidiEvent>& events, double sampleRate)
+      : _events(events), _sampleRate(sampleRate) { }
+
+    // Skips the events that 'play()' would have sent before the given 'frame'.
+    void seek(uint32_t frame) {
+      _next = 0;
+      while (frame > 0 && _next < _events.size() && _events[_next].time <= (frame - 1) / _sampleRate) {
+        _next++;
+      }
+    }
+
+    // Sends the events scheduled on or before the given 'frame'.
+    void play(uint32_t frame) {
+      const double now = frame / _sampleRate;
+      while (_next < _events.size() && _events[_next].time <= now) {
+        for (uint8_t byte : _events[_next].bytes) {
+          Midi::decode(byte);
+        }
+        _next++;
+      }
+    }
+
+    // Returns the frame at which 'play()' will send the next event, or UINT32_MAX if none remain.
+    uint32_t nextFrame() const {
+      if (_next == _events.size()) {
+        return UINT32_MAX;
+      }
+
+      const double time = _events[_next].time;
+      uint32_t frame = static_cast<uint32_t>(time * _sampleRate);   // Correct for rounding by using the
+      while (frame > 0 && time <= (frame - 1) / _sampleRate) {      // same comparison as 'play()'.
+        frame--;
+      }
+      while (time > frame / _sampleRate) {
+        frame++;
+      }
+      return frame;
+    }
+};
+
+// The position at which to save a checkpoint (if any).
+struct Checkpoint {
+  const char* path = nullptr;
+  uint32_t frame = UINT32_MAX;
+};
+
+// Saves the given 'frame' (4 bytes, little endian) followed by a snapshot of the synth to 'path'.
+bool saveCheckpoint(const char* path, uint32_t frame) {
+  std::vector<uint8_t> bytes;
+  for (uint8_t i = 0; i < 4; i++) {
+    bytes.push_back(static_cast<uint8_t>(frame >> (8 * i)));
+  }
+  Snapshot::save(synth, [&](uint8_t byte) { bytes.push_back(byte); });
+
+  FILE* pFile = fopen(path, "wb");
+  if (pFile == nullptr) {
+    return false;
+  }
+  const bool succeeded = fwrite(bytes.data(), 1, bytes.size(), pFile) == bytes.size();
+  return (fclose(pFile) == 0) && succeeded;
+}
+
+// Restores the synth from the checkpoint saved at 'path', and sets 'frame' to its position.
+bool loadCheckpoint(const char* path, uint32_t& frame) {
+  FILE* pFile = fopen(path, "rb");
+  if (pFile == nullptr) {
+    return false;
+  }
+  std::vector<uint8_t> bytes;
+  int byte;
+  while ((byte = fgetc(pFile)) != EOF) {
+    bytes.push_back(static_cast<uint8_t>(byte));
+  }
+  fclose(pFile);
+
+  if (bytes.size() < 4) {
+    return false;
+  }
+  frame = bytes[0] | (bytes[1] << 8) | (bytes[2] << 16) | (static_cast<uint32_t>(bytes[3]) << 24);
+
+  size_t next = 4;
+  return Snapshot::restore(synth, [&](uint8_t& byte) {
+    if (next == bytes.size()) { return false; }
+    byte = bytes[next++];
+    return true;
+  });
+}
+
+// Renders the frames [first .. last) into the buffer passed to 'MidiSynth::Dac::begin()'.
+void render(Player& player, uint32_t first, uint32_t last) {
+  for (uint32_t frame = first; frame < last; frame++) {
+    player.play(frame);
+    synth.isr();
+    synth.updateStats();
+  }
+}
+
+// Renders the frames [start .. numFrames) into 'samples' using 'jobs' worker processes (see above), and
+// saves the 'checkpoint' if it is within the range.  Returns false if a worker could not be started or
+// failed, or the checkpoint could not be saved.
+bool renderParallel(Player& player, uint16_t* samples, uint32_t start, uint32_t numFrames, uint8_t numChannels,
+                    unsigned jobs, const Checkpoint& checkpoint) {
+  // 'VoiceStats' samples the amplitude of each voice when the frame counter advances.  The ISR only
+  // updates the amplitudes during 16 of every 256 samples, so skipping up to 240 samples between calls
+  // to 'updateStats()' collects the same stats as calling it after every sample.
+  constexpr uint32_t maxSkip = 240;
+
+  std::vector<pid_t> workers;
+  unsigned section = 0;
+  bool succeeded = true;
+
+  const uint32_t length = numFrames - start;
+  uint32_t first = start;                               // First frame of the next section.
+  for (uint32_t frame = start; frame < numFrames;) {
+    if (frame == checkpoint.frame && !saveCheckpoint(checkpoint.path, frame)) {
+      fprintf(stderr, "Error: Unable to write checkpoint '%s'.\n", checkpoint.path);
+      succeeded = false;
+      break;
+    }
+
+    while (section < jobs && frame == first) {          // (Loops if a section is empty.)
+      const uint32_t last = start + static_cast<uint64_t>(length) * (section + 1) / jobs;
+
+      fflush(stdout);                                   // (Avoid flushing buffered output twice.)
+      const pid_t pid = fork();
+      if (pid == 0) {                                   // Worker: render this section from the current state.
+        MidiSynth::Dac::begin(samples + static_cast<size_t>(first - start) * numChannels, last - first);
+        render(player, first, last);
+        _exit(0);
+      }
+
+      if (pid < 0) {
+        perror("fork");
+        succeeded = false;
+        break;
+      }
+
+      workers.push_back(pid);
+      section++;
+      first = last;
+    }
+
+    if (!succeeded) {
+      break;
+    }
+
+    player.play(frame);                                 // Fast forward to the next event or section.  (Also
+                                                        // collects the voice stats for the whole song.)
+    uint32_t next = std::min(std::min(player.nextFrame(), numFrames), frame + maxSkip);
+    if (section < jobs) {
+      next = std::min(next, first);
+    }
+    if (checkpoint.frame > frame) {
+      next = std::min(next, checkpoint.frame);
+    }
+    synth.skip(next - frame);
+    synth.updateStats();
+    frame = next;
+  }
+
+  for (pid_t pid : workers) {
+    int status;
+    if (waitpid(pid, &status, 0) != pid || !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+      succeeded = false;
+    }
+  }
+
+  return succeeded;
+}
+
+int main(int argc, char* argv[]) {
+  const char* inPath = nullptr;
+  const char* outPath = nullptr;
+  const char* resumePath = nullptr;
+  double checkpointTime = -1;
+  Checkpoint checkpoint;
+  int jobs = 1;
+
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "-j") == 0 && i + 1 < argc) {
+      jobs = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "-c") == 0 && i + 2 < argc) {
+      checkpointTime = atof(argv[++i]);
+      checkpoint.path = argv[++i];
+    } else if (strcmp(argv[i], "-r") == 0 && i + 1 < argc) {
+      resumePath = argv[++i];
+    } else if (inPath == nullptr && argv[i][0] != '-') {
+      inPath = argv[i];
+    } else if (outPath == nullptr && argv[i][0] != '-') {
+      outPath = argv[i];
+    } else {
+      outPath = nullptr;
+      break;
+    }
+  }
+
+  if (outPath == nullptr || jobs < 1) {
+    fprintf(stderr, "Usage: %s [-j jobs] [-c seconds checkpoint.bin] [-r checkpoint.bin] <input.mid> <output.wav>\n", argv[0]);
+    return 1;
+  }
+
+  MidiFile midiFile;
+  if (!midiFile.load(inPath)) {
+    fprintf(stderr, "Error: Unable to read MIDI file '%s'.\n", inPath);
+    return 1;
+  }
+
+  constexpr uint8_t numChannels = MidiSynth::Dac::isStereo ? 2 : 1;
+  constexpr double releaseTime = 2.0;                   // Seconds rendered after the last event to capture release.
+
+  const double sampleRate = MidiSynth::sampleRate;
+  const uint32_t numFrames = static_cast<uint32_t>((midiFile.duration() + releaseTime) * sampleRate);
+
+  synth.begin();
+
+  Player player(midiFile.events(), sampleRate);
+
+  uint32_t start = 0;                                   // First frame to render (non-zero if resuming.)
+  if (resumePath != nullptr) {
+    if (!loadCheckpoint(resumePath, start) || start >= numFrames) {
+      fprintf(stderr, "Error: Unable to resume from checkpoint '%s' (unreadable, past the end of the song, saved by\n"
+                      "       a different build, truncated, or holds an index outside of the instrument tables.)\n", resumePath);
+      return 1;
+    }
+    player.seek(start);
+  }
+
+  if (checkpoint.path != nullptr) {
+    checkpoint.frame = static_cast<uint32_t>(checkpointTime * sampleRate);
+    if (checkpointTime < 0 || checkpoint.frame < start || checkpoint.frame >= numFrames) {
+      fprintf(stderr, "Error: Checkpoint time %gs is outside of the render.\n", checkpointTime);
+      return 1;
+    }
+  }
+
+  // The output buffer is shared with the worker processes (if any).
+  const uint32_t length = numFrames - start;
+  const size_t bufferSize = static_cast<size_t>(length) * numChannels * sizeof(uint16_t);
+  void* const buffer = mmap(nullptr, bufferSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+  if (buffer == MAP_FAILED) {
+    perror("mmap");
+    return 1;
+  }
+  uint16_t* const samples = static_cast<uint16_t*>(buffer);
+
+  if (jobs == 1) {
+    MidiSynth::Dac::begin(samples, length);
+    if (checkpoint.path != nullptr) {
+      render(player, start, checkpoint.frame);
+      if (!saveCheckpoint(checkpoint.path, checkpoint.frame)) {
+        fprintf(stderr, "Error: Unable to write checkpoint '%s'.\n", checkpoint.path);
+        return 1;
+      }
+      start = checkpoint.frame;
+    }
+    render(player, start, numFrames);
+  } else if (!renderParallel(player, samples, start, numFrames, numChannels, jobs, checkpoint)) {
+    fprintf(stderr, "Error: Rendering '%s' failed.\n", inPath);
+    return 1;
+  }
+
+  if (!WavFile::write(outPath, samples, length, numChannels, static_cast<uint32_t>(sampleRate + 0.5))) {
+    fprintf(stderr, "Error: Unable to write WAV file '%s'.\n", outPath);
+    return 1;
+  }
+
+  printf("%s: %u samples (%.1fs) at %.0f Hz, %u channel(s)\n", outPath, length, length / sampleRate, sampleRate, numChannels);
+
+#ifdef VOICE_STATS
+  const MidiSynth::Stats& stats = MidiSynth::getStats();
+  static const char* const eventNames[] = { "note on", "note off", "control change", "program change", "pitch bend", "sysex" };
+
+  printf("\nMessages:\n");
+  for (uint8_t event = 0; event < VoiceStatsEvent_Count; event++) {
+    printf("  %-16s %8u\n", eventNames[event], stats.getEventCount(event));
+  }
+
+  const double frames = stats.getFrames();
+  printf("\nPolyphony: %.2f average, %u peak (over %.0f frames)\n",
+    frames > 0 ? stats.getPolyphonyFrames() / frames : 0.0, stats.getMaxPolyphony(), frames);
+
+  printf("\nVoice     Notes   Stolen   Active\n");
+  for (uint8_t voice = 0; voice < MidiSynth::numVoices; voice++) {
+    printf("  %2u   %8u %8u   %5.1f%%\n", voice, stats.getNoteCount(voice), stats.getStealCount(voice),
+      frames > 0 ? 100.0 * stats.getActiveFrames(voice) / frames : 0.0);
+  }
+
+  printf("\nAmplitude stage   Voice-frames\n");
+  for (uint8_t stage = 0; stage < MidiSynth::Stats::numStages; stage++) {
+    if (stats.getStageFrames(stage) != 0) {
+      printf("  %2u              %12u\n", stage, stats.getStageFrames(stage));
+    }
+  }
+#endif // VOICE_STATS
+  return 0;
+}
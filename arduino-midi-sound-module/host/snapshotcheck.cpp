@@ -0,0 +1,275 @@
+/*
+    Snapshot check
+    https://github.com/DLehenbauer/arduino-midi-sound-module
+
+    Checks that snapshots (see 'snapshot.h') restore the state they were saved from, and that a
+    snapshot holding an index or offset outside of the tables of this build fails to restore (leaving
+    the offending field reset rather than pointing outside of its table).  Also checks that each synth
+    has its own engine state on the host (see 'Synth::State'), e.g.:
+
+        snapshots restored  corrupt snapshots rejected  failures
+                      1024                           8         0
+
+    Usage: snapshotcheck [--events <n>]
+
+    The synth is driven by a pseudo-random stream of 'events' MIDI messages (default 1024), and a
+    snapshot saved after each message must restore successfully and save again byte-for-byte.  The
+    corrupt snapshots are the last of these with a single field of the MIDI decoder, MIDI channel
+    state, envelope generator or wave window replaced by an out-of-range value.  Exits with 1
+    if any check fails.
+*/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include "../capturedac.h"
+
+#define DAC CaptureDac
+
+#include "../midi.h"
+#include "../midisynth.h"
+#include "../snapshot.h"
+
+MidiSynth synth;
+
+// The below thunks are invoked by Midi::decode() and forwarded to our MidiSynth.
+void noteOn(uint8_t channel, uint8_t note, uint8_t velocity)        { synth.midiNoteOn(channel, note, velocity); }
+void noteOff(uint8_t channel, uint8_t note)                         { synth.midiNoteOff(channel, note); }
+void sysex(uint8_t cbData, uint8_t data[])                          { synth.midiSysex(cbData, data, [](uint8_t) { /* discard replies */ }); }
+void controlChange(uint8_t channel, uint8_t control, uint8_t value) { synth.midiControlChange(channel, control, value); }
+void programChange(uint8_t channel, uint8_t value)                  { synth.midiProgramChange(channel, value); }
+void pitchBend(uint8_t channel, int16_t value)                      { synth.midiPitchBend(channel, value); }
+
+static uint32_t numFailures = 0;
+
+static void fail(const char* message, uint32_t index) {
+  if (numFailures++ < 10) {
+    fprintf(stderr, "Error: %s (%u).\n", message, index);
+  }
+}
+
+// Returns the bytes saved by 'item.serialize()', where 'item' is the synth, an envelope generator, etc.
+template <typename T> static std::vector<uint8_t> save(T& item) {
+  std::vector<uint8_t> bytes;
+  auto write = [&](uint8_t byte) { bytes.push_back(byte); };
+  SnapshotWriter<decltype(write)> writer(write);
+  item.serialize(writer);
+  return bytes;
+}
+
+static std::vector<uint8_t> saveMidi() {
+  std::vector<uint8_t> bytes;
+  auto write = [&](uint8_t byte) { bytes.push_back(byte); };
+  SnapshotWriter<decltype(write)> writer(write);
+  Midi::serialize(writer);
+  return bytes;
+}
+
+// Restores 'item' from the given 'bytes' with 'serialize(archive)', and returns true if all bytes were
+// read and every restored field was within range.
+template <typename TSerialize> static bool restore(const std::vector<uint8_t>& bytes, TSerialize serialize) {
+  size_t next = 0;
+  auto read = [&](uint8_t& byte) {
+    if (next == bytes.size()) { return false; }
+    byte = bytes[next++];
+    return true;
+  };
+  SnapshotReader<decltype(read)> reader(read);
+  serialize(reader);
+  return reader.isComplete() && reader.isValid() && next == bytes.size();
+}
+
+static std::vector<uint8_t> saveSnapshot(MidiSynth& from = synth) {
+  std::vector<uint8_t> bytes;
+  Snapshot::save(from, [&](uint8_t byte) { bytes.push_back(byte); });
+  return bytes;
+}
+
+static bool restoreSnapshot(const std::vector<uint8_t>& bytes) {
+  size_t next = 0;
+  return Snapshot::restore(synth, [&](uint8_t& byte) {
+    if (next == bytes.size()) { return false; }
+    byte = bytes[next++];
+    return true;
+  });
+}
+
+// Checks that restoring 'corrupt' into 'item' fails, and that the restored item then saves 'expected'
+// (i.e., the out-of-range field was reset.)
+template <typename T> static void expectRejected(T& item, std::vector<uint8_t> corrupt,
+                                                 const std::vector<uint8_t>& expected, const char* message) {
+  if (restore(corrupt, [&](auto& archive) { item.serialize(archive); })) {
+    fail(message, 0);
+  } else if (save(item) != expected) {
+    fail("Rejected field was not reset", 0);
+  }
+}
+
+static void putUint16(std::vector<uint8_t>& bytes, size_t index, uint16_t value) {
+  bytes[index] = static_cast<uint8_t>(value);
+  bytes[index + 1] = static_cast<uint8_t>(value >> 8);
+}
+
+// Drives the synth with 'numEvents' pseudo-random MIDI messages, and checks that a snapshot saved after
+// each one restores and saves again byte-for-byte.  Returns the number of snapshots restored.
+static uint32_t checkRoundTrip(uint32_t numEvents) {
+  uint32_t random = 0x1234567;
+  auto next = [&](uint8_t max) {
+    random ^= random << 13; random ^= random >> 17; random ^= random << 5;
+    return static_cast<uint8_t>(random % (max + 1u));
+  };
+
+  uint32_t numRestored = 0;
+  for (uint32_t event = 0; event < numEvents; event++) {
+    const uint8_t channel = next(15);
+    switch (next(5)) {
+      case 0: Midi::decode(0xC0 | channel); Midi::decode(next(127)); break;
+      case 1: Midi::decode(0x80 | channel); Midi::decode(next(127)); Midi::decode(0x40); break;
+      case 2: Midi::decode(0xE0 | channel); Midi::decode(next(127)); Midi::decode(next(127)); break;
+      case 3: Midi::decode(0xB0 | channel); Midi::decode(0x40); Midi::decode(next(1) ? 0x7F : 0); break;
+      default: Midi::decode(0x90 | channel); Midi::decode(next(127)); Midi::decode(1 + next(126)); break;
+    }
+    if (next(3) == 0) {
+      Midi::decode(0x90 | channel);                     // Leave a partially received message in the decoder.
+    }
+    synth.skip(next(255) * 32u);
+
+    const std::vector<uint8_t> bytes = saveSnapshot();
+    if (!restoreSnapshot(bytes)) {
+      fail("Snapshot failed to restore after event", event);
+    } else if (saveSnapshot() != bytes) {
+      fail("Restored snapshot differs after event", event);
+    }
+    numRestored++;
+  }
+  return numRestored;
+}
+
+int main(int argc, char* argv[]) {
+  uint32_t numEvents = 1024;
+
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--events") == 0 && i + 1 < argc) {
+      numEvents = static_cast<uint32_t>(atol(argv[++i]));
+    } else {
+      fprintf(stderr, "Usage: %s [--events <n>]\n", argv[0]);
+      return 1;
+    }
+  }
+
+  synth.begin();
+  const uint32_t numRestored = checkRoundTrip(numEvents);
+  uint32_t numRejected = 0;
+
+  // Truncated snapshot.
+  {
+    std::vector<uint8_t> bytes = saveSnapshot();
+    bytes.pop_back();
+    numRejected++;
+    if (restoreSnapshot(bytes)) {
+      fail("Truncated snapshot restored", 0);
+    }
+  }
+
+  // MIDI program of channel 0 (follows the header and the voice -> note/channel maps.)
+  {
+    std::vector<uint8_t> bytes = saveSnapshot();
+    bytes[6 + 2 * MidiSynth::numVoices] = 128;
+    numRejected++;
+    if (restoreSnapshot(bytes)) {
+      fail("Snapshot with MIDI program 128 restored", 0);
+    }
+  }
+
+  // MIDI decoder: status, channel, data remaining, data index, data.
+  {
+    const std::vector<uint8_t> reset = (Midi::reset(), saveMidi());
+    const std::vector<uint8_t> corrupt[] = {
+      [&] { auto b = reset; b[0] = MidiStatus_Unknown + 1; return b; }(),
+      [&] { auto b = reset; b[0] = MidiStatus_NoteOn; b[1] = 16; b[2] = 1; return b; }(),
+      [&] { auto b = reset; b[0] = MidiStatus_Extended; b[1] = 0; b[2] = 1; b[3] = 32; return b; }(),
+    };
+    for (const std::vector<uint8_t>& bytes : corrupt) {
+      numRejected++;
+      if (restore(bytes, [](auto& archive) { Midi::serialize(archive); })) {
+        fail("Corrupt MIDI decoder state restored", bytes[0]);
+      } else if (saveMidi() != reset) {
+        fail("Rejected MIDI decoder state was not reset", bytes[0]);
+      }
+    }
+  }
+
+  // Envelope generator: first stage (2 bytes), loop start, loop end, stage index, ...
+  {
+    const HeapRegion<EnvelopeStage> stages = Instruments::getEnvelopeStages();
+    const uint16_t numStages = static_cast<uint16_t>((stages.end - stages.start) / stages.itemSize);
+    Envelope envelope;
+    envelope.reset();
+    const std::vector<uint8_t> reset = save(envelope);
+
+    EnvelopeStart start;
+    Instruments::getEnvelopeStart(0, start);
+    envelope.start(start);
+    std::vector<uint8_t> bytes = save(envelope);
+
+    putUint16(bytes, 0, numStages);
+    numRejected++;
+    expectRejected(envelope, bytes, reset, "Envelope with first stage past the end restored");
+
+    putUint16(bytes, 0, numStages - 1);
+    bytes[2] = bytes[3] = bytes[4] = 0;                     // Last stage is in range...
+    if (!restore(bytes, [&](auto& archive) { envelope.serialize(archive); })) {
+      fail("Envelope at the last stage failed to restore", 0);
+    }
+
+    bytes[4] = 1;                                           // ...but the stage after it is not.
+    numRejected++;
+    expectRejected(envelope, bytes, reset, "Envelope with stage index past the end restored");
+  }
+
+  // Wave window.
+  {
+    WaveWindow window;
+    window.reset();
+    const std::vector<uint8_t> reset = save(window);
+
+    uint16_t last = 0;
+    while (WaveWindow::isValidOffset(last + 1)) {
+      last++;
+    }
+    window.set(last);
+    std::vector<uint8_t> bytes = save(window);
+    if (!restore(bytes, [&](auto& archive) { window.serialize(archive); })) {
+      fail("Wave window at the end of the wavetable failed to restore", last);
+    }
+
+  #ifdef WAVETABLE_SEGMENTS
+    bytes[1] = 0xFF;                                        // 'page0' (the wavetable has fewer unique pages.)
+  #else
+    putUint16(bytes, 0, last + 1);
+  #endif
+    numRejected++;
+    expectRejected(window, bytes, reset, "Wave window past the end of the wavetable restored");
+  }
+
+  // A second synth has its own engine state: playing it leaves 'synth' unchanged.
+  {
+    const std::vector<uint8_t> before = saveSnapshot();
+    MidiSynth other;
+    const std::vector<uint8_t> initial = saveSnapshot(other);
+    other.midiNoteOn(0, 60, 127);
+    other.skip(4096);
+    if (saveSnapshot(other) == initial) {
+      fail("Second synth did not change", 0);
+    } else if (saveSnapshot() != before) {
+      fail("Second synth changed the state of the first", 0);
+    }
+  }
+
+  printf("snapshots restored  corrupt snapshots rejected  failures\n");
+  printf("%18u  %26u  %8u\n", numRestored, numRejected, numFailures);
+
+  return numFailures == 0 ? 0 : 1;
+}
@@ -0,0 +1,263 @@
+/*
+    Worst case stack depth analyzer
+    https://github.com/DLehenbauer/arduino-midi-sound-module
+
+    Reads the disassembly of the AVR firmware (i.e., 'avr-objdump -d firmware.elf') and calculates the
+    worst case stack depth of 'main' and each ISR from the call graph and the stack frame of each
+    function.
+
+    Usage: avr-objdump -d firmware.elf | stackdepth [sramAvailable [minHeadroom]]
+
+    The stack frame of a function is the number of registers it pushes plus the space it reserves by
+    moving the stack pointer (e.g., 'in r28, 0x3d / in r29, 0x3e / sbiw r28, N') or with 'rcall .+0'.
+    Each call adds a 2B return address, as does entering an ISR and the startup code's 'call main'.
+    Every push in the function is counted regardless of where it occurs, so the result is an upper bound.
+
+    Jumps ('jmp' / 'rjmp') to other functions push no return address:
+
+      - A jump to the entry of another function is a tail call, which avr-gcc emits only after the
+        epilogue has released the caller's frame.  The callee's depth therefore replaces the caller's
+        frame rather than adding to it.
+      - A jump into the middle of another function (e.g., a shared epilogue after cross-jumping) is
+        made with the caller's frame in place, so the target function's depth is added to it.
+
+    The Timer2 ISR ('Synth::isr()') re-enables interrupts so that the USART RX ISR can preempt it.  To
+    account for nesting, the worst case for the firmware is the depth of 'main' plus the depth of every
+    ISR (i.e., as if each ISR preempts the next.)  AVR interrupts do not otherwise nest.
+
+    Indirect calls ('icall' / 'ijmp') and recursion can not be bounded and are reported as errors.  If
+    'sramAvailable' (SRAM less .data and .bss) is given, the remaining headroom is reported and the exit
+    code is 2 if it is less than 'minHeadroom' (default 0).
+*/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <iostream>
+#include <map>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+struct Function {
+  size_t frame = 0;                                     // Bytes pushed / reserved by the function itself.
+  std::map<std::string, size_t> callees;                // Functions called (or jumped into) on top of the frame, and the
+                                                        // bytes pushed by the transfer (2 for a return address, else 0.)
+  std::set<std::string> tailCallees;                    // Functions jumped to after the frame is released (tail calls.)
+  bool isIndirect = false;                              // True if the function uses 'icall' / 'ijmp'.
+};
+
+class Analyzer final {
+  private:
+    std::map<std::string, Function> _functions;
+    std::map<std::string, size_t> _depth;               // Memoized worst case depth of each function.
+    std::set<std::string> _active;                      // Functions on the current path (to detect recursion.)
+    bool _ok = true;
+
+    // Returns the symbol name in a comment of the form '; 0x1234 <name+0x12>', or an empty string.  If
+    // 'pIsEntry' is given, sets it to true if the target is the symbol itself (i.e., has no offset.)
+    static std::string target(const std::string& line, bool* pIsEntry = nullptr) {
+      const size_t start = line.find('<');
+      const size_t end = line.find_first_of("+>", start);
+      if (start == std::string::npos || end == std::string::npos) {
+        return std::string();
+      }
+      if (pIsEntry != nullptr) {
+        *pIsEntry = line[end] == '>';
+      }
+      return line.substr(start + 1, end - start - 1);
+    }
+
+    static bool startsWith(const std::string& str, const char* prefix) {
+      return str.compare(0, strlen(prefix), prefix) == 0;
+    }
+
+    // Returns the immediate operand of an instruction such as 'sbiw r28, 0x08', or 0 if none.
+    static size_t immediate(const std::string& operands) {
+      const size_t comma = operands.find(',');
+      return comma == std::string::npos ? 0 : strtoul(operands.c_str() + comma + 1, nullptr, 0);
+    }
+
+  public:
+    void load(std::istream& in) {
+      Function* pFunction = nullptr;
+      std::string name;
+      bool isFramePointer = false;                      // True after 'in r28, 0x3d', where the frame is reserved.
+
+      std::string line;
+      while (std::getline(in, line)) {
+        // Function label, e.g.: '00000090 <__vector_7>:'
+        if (line.size() > 2 && line[0] != ' ' && line.compare(line.size() - 2, 2, ">:") == 0) {
+          name = target(line);
+          pFunction = &_functions[name];
+          isFramePointer = false;
+          continue;
+        }
+
+        // Instruction, e.g.: '  a0:	0e 94 45 02 	call	0x48a	; 0x48a <foo>'
+        std::istringstream fields(line);
+        std::string address, mnemonic, operands;
+        if (pFunction == nullptr
+          || !std::getline(fields, address, '\t')
+          || !std::getline(fields, mnemonic, '\t')          // (Skip the encoding)
+          || !std::getline(fields, mnemonic, '\t')) {
+          continue;
+        }
+        std::getline(fields, operands, '\t');
+        mnemonic.erase(mnemonic.find_last_not_of(' ') + 1);
+
+        if (mnemonic == "push") {
+          pFunction->frame++;
+        } else if (mnemonic == "in" && startsWith(operands, "r28, 0x3d")) {
+          isFramePointer = true;
+        } else if (isFramePointer && mnemonic == "sbiw" && startsWith(operands, "r28")) {
+          pFunction->frame += immediate(operands);
+          isFramePointer = false;
+        } else if (isFramePointer && mnemonic == "subi" && startsWith(operands, "r28")) {
+          pFunction->frame += immediate(operands);
+        } else if (isFramePointer && mnemonic == "sbci" && startsWith(operands, "r29")) {
+          pFunction->frame += immediate(operands) << 8;
+          isFramePointer = false;
+        } else if (mnemonic == "icall" || mnemonic == "ijmp" || mnemonic == "eicall" || mnemonic == "eijmp") {
+          pFunction->isIndirect = true;
+        } else if (mnemonic == "call" || mnemonic == "rcall" || mnemonic == "jmp" || mnemonic == "rjmp") {
+          const bool isCall = mnemonic == "call" || mnemonic == "rcall";
+          bool isEntry = false;
+          const std::string callee = target(line, &isEntry);
+          if (callee == name || callee.empty()) {
+            if (mnemonic == "rcall") { pFunction->frame += 2; }   // 'rcall .+0' reserves 2B of stack.
+          } else if (isCall) {
+            pFunction->callees[callee] = 2;
+          } else if (isEntry) {
+            pFunction->tailCallees.insert(callee);
+          } else {
+            pFunction->callees.emplace(callee, 0);                // (A call to the same function takes precedence.)
+          }
+        }
+      }
+    }
+
+    // Returns the worst case stack depth of the given function, including the return addresses of the
+    // calls it makes (but not its own.)
+    size_t depth(const std::string& name) {
+      const auto memo = _depth.find(name);
+      if (memo != _depth.end()) { return memo->second; }
+
+      const auto found = _functions.find(name);
+      if (found == _functions.end()) { return 0; }        // (e.g., jumps to local labels in libgcc)
+      const Function& function = found->second;
+
+      if (function.isIndirect) {
+        fprintf(stderr, "Error: '%s' makes an indirect call.\n", name.c_str());
+        _ok = false;
+      }
+
+      if (!_active.insert(name).second) {
+        fprintf(stderr, "Error: '%s' is recursive.\n", name.c_str());
+        _ok = false;
+        return 0;
+      }
+
+      size_t deepest = function.frame;
+      for (const auto& callee : function.callees) {
+        const size_t calleeDepth = function.frame + depth(callee.first) + callee.second;  // Frame, return address
+        if (calleeDepth > deepest) { deepest = calleeDepth; }                             // and the callee's depth.
+      }
+      for (const std::string& callee : function.tailCallees) {
+        const size_t calleeDepth = depth(callee);         // (The frame has been released.)
+        if (calleeDepth > deepest) { deepest = calleeDepth; }
+      }
+
+      _active.erase(name);
+      return _depth[name] = deepest;
+    }
+
+    // Prints the deepest call path beginning at the given function.
+    void printPath(const std::string& name) {
+      std::string current = name;
+      while (true) {
+        const Function& function = _functions[current];
+        const size_t total = depth(current);
+        std::string next;
+        bool isTail = false;
+        for (const auto& callee : function.callees) {
+          if (_functions.count(callee.first) && function.frame + depth(callee.first) + callee.second == total) {
+            next = callee.first;
+          }
+        }
+        for (const std::string& callee : function.tailCallees) {
+          if (next.empty() && _functions.count(callee) && depth(callee) == total) {
+            next = callee;
+            isTail = true;
+          }
+        }
+
+        if (isTail) {
+          printf("        -  %s (frame of %zu released before the tail call)\n", current.c_str(), function.frame);
+        } else {
+          printf("    %5zu  %s\n", function.frame, current.c_str());
+        }
+        if (next.empty()) { break; }
+        current = next;
+      }
+    }
+
+    std::vector<std::string> vectors() const {
+      std::vector<std::string> names;
+      for (const auto& entry : _functions) {
+        if (entry.first.compare(0, 9, "__vector_") == 0 && entry.first != "__vector_default") {
+          names.push_back(entry.first);
+        }
+      }
+      return names;
+    }
+
+    bool has(const std::string& name) const { return _functions.count(name) != 0; }
+    bool ok() const { return _ok; }
+};
+
+int main(int argc, char* argv[]) {
+  if (argc > 3) {
+    fprintf(stderr, "Usage: avr-objdump -d firmware.elf | %s [sramAvailable [minHeadroom]]\n", argv[0]);
+    return 1;
+  }
+
+  Analyzer analyzer;
+  analyzer.load(std::cin);
+
+  if (!analyzer.has("main")) {
+    fprintf(stderr, "Error: 'main' not found in the disassembly.\n");
+    return 1;
+  }
+
+  size_t total = analyzer.depth("main") + 2;           // Depth plus the return address of the startup code's 'call main'.
+  printf("Stack: %5zu  main\n", total);
+  analyzer.printPath("main");
+
+  for (const std::string& vector : analyzer.vectors()) {
+    const size_t depth = analyzer.depth(vector) + 2;    // ISR depth plus the interrupted PC.
+    printf("Stack: %5zu  %s\n", depth, vector.c_str());
+    analyzer.printPath(vector);
+    total += depth;
+  }
+
+  printf("Stack: %5zu  worst case (main + nested ISRs)\n", total);
+
+  if (!analyzer.ok()) {
+    return 1;
+  }
+
+  if (argc >= 2) {
+    const long headroom = atol(argv[1]) - static_cast<long>(total);
+    const long minHeadroom = argc == 3 ? atol(argv[2]) : 0;
+    printf("Stack: %5ld  headroom (minimum %ld)\n", headroom, minHeadroom);
+    if (headroom < minHeadroom) {
+      fprintf(stderr, "Error: Insufficient stack headroom.\n");
+      return 2;
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,74 @@
+/*
+    Telemetry decoder
+    https://github.com/DLehenbauer/arduino-midi-sound-module
+
+    Decodes a captured stream of telemetry reports sent by firmware built with -DTELEMETRY (see
+    'telemetry.h') to CSV, one row per report, e.g.:
+
+        stty -F /dev/ttyACM0 raw 31250 && cat /dev/ttyACM0 | telemetry > soak.csv
+        telemetry capture.bin > soak.csv
+
+    Usage: telemetry [capture.bin]
+
+    Reads from stdin if no file is given.  Bytes outside of telemetry reports (e.g., other sysex
+    replies) are ignored (see 'telemetryreport.h').  Columns:
+
+      report        - Index of the report, counting reports lost in transmission (~1 report/second).
+      lost          - Reports lost between this report and the previous one (from the sequence numbers).
+      activeVoices, rxHighWater, isrMaxCycles, isrOverruns, rxDropped
+                    - As described in 'telemetry.h'.
+
+    Rows are flushed as they are decoded, so the output can be followed live (e.g., 'tail -f').
+*/
+
+#include <stdint.h>
+#include <stdio.h>
+#include "telemetryreport.h"
+
+int main(int argc, char* argv[]) {
+  if (argc > 2) {
+    fprintf(stderr, "Usage: %s [capture.bin]\n", argv[0]);
+    return 1;
+  }
+
+  FILE* file = argc == 2 ? fopen(argv[1], "rb") : stdin;
+  if (file == nullptr) {
+    fprintf(stderr, "Error: Unable to read '%s'.\n", argv[1]);
+    return 1;
+  }
+
+  printf("report,lost,activeVoices,rxHighWater,isrMaxCycles,isrOverruns,rxDropped\n");
+  fflush(stdout);
+
+  TelemetryDecoder decoder;
+  bool isFirst = true;
+  uint8_t lastSequence = 0;
+  uint32_t index = 0;
+  size_t numReports = 0;
+
+  int ch;
+  while ((ch = fgetc(file)) != EOF) {
+    TelemetryReport report;
+    if (!decoder.decode(static_cast<uint8_t>(ch), report)) {
+      continue;
+    }
+
+    const uint8_t lost = isFirst ? 0 : ((report.sequence - lastSequence - 1) & 0x7F);
+    index += isFirst ? 0 : lost + 1;
+
+    printf("%u,%u,%u,%u,%u,%u,%u\n",
+      index, lost, report.activeVoices, report.rxHighWater, report.isrMaxCycles, report.isrOverruns, report.rxDropped);
+    fflush(stdout);
+
+    isFirst = false;
+    lastSequence = report.sequence;
+    numReports++;
+  }
+
+  if (file != stdin) {
+    fclose(file);
+  }
+
+  fprintf(stderr, "%zu report(s) decoded.\n", numReports);
+  return 0;
+}
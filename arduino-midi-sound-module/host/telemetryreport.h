@@ -0,0 +1,82 @@
+/*
+    Telemetry report decoder (host only)
+    https://github.com/DLehenbauer/arduino-midi-sound-module
+
+    Extracts the telemetry reports (see 'telemetry.h') from a stream of bytes transmitted by the
+    firmware.  Bytes outside of telemetry reports (e.g., other sysex replies) are ignored.  Used by
+    'telemetry.cpp' and 'avrsim.cpp'.
+*/
+
+#ifndef __TELEMETRYREPORT_H__
+#define __TELEMETRYREPORT_H__
+
+#include <stdint.h>
+#include <vector>
+#include "../sysex.h"
+
+struct TelemetryReport {
+  uint8_t  sequence;
+  uint8_t  activeVoices;
+  uint8_t  rxHighWater;
+  uint32_t isrMaxCycles;
+  uint32_t isrOverruns;
+  uint32_t rxDropped;
+};
+
+class TelemetryDecoder final {
+  public:
+    static constexpr size_t reportLength = 16;
+
+  private:
+    std::vector<uint8_t> _message;                      // Bytes of the current sysex message (from F0 to F7).
+
+    // Returns the value stored 7 bits per byte (least significant first) at 'pBytes'.
+    static uint32_t read7(const uint8_t* pBytes, uint8_t numBytes) {
+      uint32_t value = 0;
+      for (uint8_t i = 0; i < numBytes; i++) {
+        value |= static_cast<uint32_t>(pBytes[i]) << (7 * i);
+      }
+      return value;
+    }
+
+  public:
+    // Consumes the next transmitted 'byte'.  Returns true and stores the report in 'report' if the
+    // byte completed a well formed telemetry report.
+    bool decode(uint8_t byte, TelemetryReport& report) {
+      if (byte == 0xF0) {                               // Start of a new sysex message.
+        _message.assign(1, byte);
+        return false;
+      }
+
+      if (_message.empty()) {                           // Not inside a sysex message.
+        return false;
+      }
+
+      _message.push_back(byte);
+      if (byte < 0x80) {                                // Data byte.  (Discard overlong messages.)
+        if (_message.size() > reportLength) { _message.clear(); }
+        return false;
+      }
+
+      // Any status byte ends the message.  Only well formed telemetry reports are decoded.
+      const bool isReport = byte == 0xF7
+        && _message.size() == reportLength
+        && _message[1] == Sysex_Id
+        && _message[2] == Sysex_Telemetry;
+
+      if (isReport) {
+        const uint8_t* const p = _message.data();
+        report.sequence     = p[3];
+        report.activeVoices = p[4];
+        report.rxHighWater  = p[5];
+        report.isrMaxCycles = read7(p + 6, 3);
+        report.isrOverruns  = read7(p + 9, 3);
+        report.rxDropped    = read7(p + 12, 3);
+      }
+
+      _message.clear();
+      return isReport;
+    }
+};
+
+#endif //__TELEMETRYREPORT_H__
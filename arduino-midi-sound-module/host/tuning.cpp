@@ -0,0 +1,111 @@
+/*
+    Tuning check
+    https://github.com/DLehenbauer/arduino-midi-sound-module
+
+    Compares the Q8.16 sampling intervals used by 'Synth::noteOn()' and 'Synth::pitchBend()' (see
+    'Synth::getSamplingInterval()') with the exact frequency of every MIDI note at every pitch bend
+    value, and prints the worst error (in cents) for each octave, e.g.:
+
+        octave  notes       interval              max error  max excess
+             0    0 .. 11   0x001B0F .. 0x003314       0.94        0.03
+             ...
+            10  120 .. 127  0x6C3B00 .. 0xA22A00       0.81        0.03
+
+        max error: 0.94 cents (bound 3.00)
+
+    Usage: tuning [--tolerance <cents>]
+
+    The ISR advances the phase by the top 16 bits (Q8.8) of the interval, and adds the bottom 8 bits
+    on average (see 'carry' in 'synth.h'), so the pitch played is that of the Q8.16 interval.
+
+    The 'excess' is the error beyond what is unavoidable, i.e., rounding the interval to the nearest LSB
+    and the pitch bend to the nearest 1/64 semitone.  Exits with 1 if the excess exceeds the tolerance
+    (default 0.1 cents) for any pitch, or if the error exceeds 3 cents for any pitch of any MIDI note.
+*/
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../capturedac.h"
+
+#define DAC CaptureDac
+
+#include "../midisynth.h"
+
+// Returns the exact Q8.16 sampling interval of the given (fractional) MIDI 'note'.
+static double exactInterval(double note) {
+  return pow(2.0, (note - 69.0) / 12.0) * 440.0 / MidiSynth::sampleRate * static_cast<double>(0xFFFF) * 256.0;
+}
+
+static double cents(double ratio) {
+  return 1200.0 * log2(ratio);
+}
+
+int main(int argc, char* argv[]) {
+  double tolerance = 0.1;
+
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--tolerance") == 0 && i + 1 < argc) {
+      tolerance = atof(argv[++i]);
+    } else {
+      fprintf(stderr, "Usage: %s [--tolerance <cents>]\n", argv[0]);
+      return 1;
+    }
+  }
+
+  const double maxBendError = 100.0 / 128.0;              // Rounding 'value' to the nearest 1/64 semitone.
+  constexpr double bound = 3.0;                           // The error must be within 'bound' for every MIDI note.
+  double maxTotalError = 0;
+  bool succeeded = true;
+
+  printf("octave  notes       interval              max error  max excess\n");
+
+  for (int octave = 0; octave * 12 < 128; octave++) {
+    const int firstNote = octave * 12;
+    const int lastNote = firstNote + 11 < 127 ? firstNote + 11 : 127;
+    double maxError = 0;
+    double maxExcess = 0;
+
+    for (int note = firstNote; note <= lastNote; note++) {
+      for (int value = -8192; value <= 8191; value++) {
+        const int16_t pitch = (note << 6) + ((value + 0x20) >> 6);           // As calculated by 'pitchBend()'.
+        const double exact = exactInterval(note + value / 4096.0);
+        const double actual = MidiSynth::getSamplingInterval(pitch);
+
+        const double error = fabs(cents(actual / exact));
+        const double unavoidable = -cents((exact - 0.5) / exact) + maxBendError;
+
+        maxError = error > maxError ? error : maxError;
+        maxExcess = error - unavoidable > maxExcess ? error - unavoidable : maxExcess;
+      }
+    }
+
+    printf("%6d  %3d .. %-3d  0x%06X .. 0x%06X  %9.2f  %10.2f\n",
+      octave, firstNote, lastNote,
+      static_cast<unsigned>(MidiSynth::getSamplingInterval(firstNote << 6)),
+      static_cast<unsigned>(MidiSynth::getSamplingInterval(lastNote << 6)),
+      maxError, maxExcess);
+
+    maxTotalError = maxError > maxTotalError ? maxError : maxTotalError;
+
+    if (maxExcess > tolerance) {
+      succeeded = false;
+    }
+  }
+
+  printf("\nmax error: %.2f cents (bound %.2f)\n", maxTotalError, bound);
+
+  if (!succeeded) {
+    fprintf(stderr, "Error: Tuning error exceeds the tolerance of %.2f cents.\n", tolerance);
+    return 1;
+  }
+
+  if (maxTotalError > bound) {
+    fprintf(stderr, "Error: Tuning error exceeds %.2f cents.\n", bound);
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,122 @@
+/*
+    Wavetable packer
+    https://github.com/DLehenbauer/arduino-midi-sound-module
+
+    Generates 'wavetable_generated.h' (used when building with -DWAVETABLE_SEGMENTS) by splitting the
+    wavetable in 'instruments_generated.h' into 256B pages and storing each unique page once, along
+    with an index mapping each page of the original wavetable to its unique page.
+
+    Usage: wavepack <output.h>
+
+    The tool must be rebuilt and rerun whenever 'instruments_generated.h' changes.
+*/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <vector>
+#include "../instruments.h"
+
+#ifdef WAVETABLE_SEGMENTS
+#error "wavepack must be built against the uncompressed wavetable (i.e., without WAVETABLE_SEGMENTS)."
+#endif
+
+static constexpr size_t pageSize = 256;
+
+int main(int argc, char* argv[]) {
+  if (argc != 2) {
+    fprintf(stderr, "Usage: %s <output.h>\n", argv[0]);
+    return 1;
+  }
+
+  const HeapRegion<int8_t> region = Instruments::getWavetable();
+  const int8_t* const pWavetable = reinterpret_cast<const int8_t*>(region.start);
+  const size_t length = region.end - region.start;
+  const size_t numPages = (length + pageSize - 1) / pageSize;
+
+  // Returns the sample at 'offset' within the given 'page' (zero padding the last page, if partial.)
+  auto sampleAt = [=](size_t page, size_t offset) -> int8_t {
+    offset += page * pageSize;
+    return offset < length ? pWavetable[offset] : 0;
+  };
+
+  auto isSamePage = [=](size_t left, size_t right) {
+    for (size_t i = 0; i < pageSize; i++) {
+      if (sampleAt(left, i) != sampleAt(right, i)) { return false; }
+    }
+    return true;
+  };
+
+  std::vector<size_t> uniquePages;                      // Page number (in the original wavetable) of each unique page.
+  std::vector<uint8_t> index;                           // Unique page for each page of the original wavetable.
+
+  for (size_t page = 0; page < numPages; page++) {
+    size_t unique = 0;
+    while (unique < uniquePages.size() && !isSamePage(uniquePages[unique], page)) {
+      unique++;
+    }
+
+    if (unique == uniquePages.size()) {
+      uniquePages.push_back(page);
+    }
+
+    if (unique > 0xFF) {
+      fprintf(stderr, "Error: More than 256 unique pages.\n");
+      return 1;
+    }
+
+    index.push_back(static_cast<uint8_t>(unique));
+  }
+
+  // A window beginning in the last page may extend one page beyond the end of the wavetable.  (As with
+  // the uncompressed wavetable, the samples read there are not meaningful.)
+  index.push_back(index.back());
+
+  FILE* file = fopen(argv[1], "w");
+  if (file == nullptr) {
+    fprintf(stderr, "Error: Unable to write '%s'.\n", argv[1]);
+    return 1;
+  }
+
+  fprintf(file, "/*\n");
+  fprintf(file, "    Deduplicated wavetable pages (generated by 'host/wavepack.cpp' from 'instruments_generated.h')\n");
+  fprintf(file, "    https://github.com/DLehenbauer/arduino-midi-sound-module\n");
+  fprintf(file, "*/\n\n");
+
+  fprintf(file, "static constexpr uint8_t WavePageIndex[] PROGMEM = {\n");
+  for (size_t page = 0; page < index.size(); page += 16) {
+    fprintf(file, "\t/* %02zx: */", page);
+    for (size_t i = page; i < index.size() && i < page + 16; i++) {
+      fprintf(file, " 0x%02x,", index[i]);
+    }
+    fprintf(file, "\n");
+  }
+  fprintf(file, "};\n\n");
+
+  fprintf(file, "static constexpr int8_t WavePages[][256] PROGMEM = {\n");
+  for (size_t unique = 0; unique < uniquePages.size(); unique++) {
+    const size_t page = uniquePages[unique];
+    fprintf(file, "\t/* Page %02zx (wavetable offset %04zx) */ {\n", unique, page * pageSize);
+    for (size_t row = 0; row < pageSize; row += 32) {
+      fprintf(file, "\t\t/* %02zx: */", row);
+      for (size_t i = row; i < row + 32; i++) {
+        fprintf(file, " %4d,", sampleAt(page, i));
+      }
+      fprintf(file, "\n");
+    }
+    fprintf(file, "\t},\n");
+  }
+  fprintf(file, "};\n");
+
+  const bool ok = !ferror(file);
+  if (fclose(file) != 0 || !ok) {
+    fprintf(stderr, "Error: Unable to write '%s'.\n", argv[1]);
+    return 1;
+  }
+
+  const size_t before = length;
+  const size_t after = uniquePages.size() * pageSize + index.size();
+  printf("%s: %zu of %zu pages unique, %zu -> %zu bytes (saves %zu bytes)\n",
+    argv[1], uniquePages.size(), numPages, before, after, before - after);
+
+  return 0;
+}
@@ -0,0 +1,62 @@
+/*
+    WAV file writer (host only)
+    https://github.com/DLehenbauer/arduino-midi-sound-module
+
+    Writes 16-bit PCM WAV files from samples captured by 'CaptureDac' / 'StereoCaptureDac'.  Captured
+    samples are unsigned with a DC offset of 0x8000 (the midpoint of the DAC's range), whereas 16-bit
+    WAV samples are signed, so the offset is removed when writing.
+*/
+
+#ifndef __WAVFILE_H__
+#define __WAVFILE_H__
+
+#include <stdint.h>
+#include <stdio.h>
+
+class WavFile final {
+  private:
+    static void write16(FILE* file, uint16_t value) {
+      fputc(value & 0xFF, file);
+      fputc(value >> 8, file);
+    }
+
+    static void write32(FILE* file, uint32_t value) {
+      write16(file, value & 0xFFFF);
+      write16(file, value >> 16);
+    }
+
+  public:
+    // Writes 'numFrames' frames of 'numChannels' interleaved samples to the given file.  Returns false
+    // if the file could not be written.
+    static bool write(const char* path, const uint16_t* samples, uint32_t numFrames, uint8_t numChannels, uint32_t sampleRate) {
+      FILE* file = fopen(path, "wb");
+      if (file == nullptr) { return false; }
+
+      const uint16_t blockAlign = numChannels * sizeof(int16_t);
+      const uint32_t dataSize = numFrames * blockAlign;
+
+      fwrite("RIFF", 1, 4, file);
+      write32(file, 36 + dataSize);
+      fwrite("WAVE", 1, 4, file);
+
+      fwrite("fmt ", 1, 4, file);
+      write32(file, 16);                                // Size of 'fmt ' chunk
+      write16(file, 1);                                 // PCM
+      write16(file, numChannels);
+      write32(file, sampleRate);
+      write32(file, sampleRate * blockAlign);           // Bytes per second
+      write16(file, blockAlign);
+      write16(file, 16);                                // Bits per sample
+
+      fwrite("data", 1, 4, file);
+      write32(file, dataSize);
+      for (uint32_t i = 0; i < numFrames * numChannels; i++) {
+        write16(file, samples[i] ^ 0x8000);             // Offset binary -> two's complement
+      }
+
+      const bool ok = !ferror(file);
+      return (fclose(file) == 0) && ok;
+    }
+};
+
+#endif //__WAVFILE_H__
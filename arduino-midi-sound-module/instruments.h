@@ -1,6 +1,33 @@
 /*
     Instrument type definitions
     https://github.com/DLehenbauer/arduino-midi-sound-module
+
+    Wavetable compression:
+
+    By default, the wavetable ('Waveforms' in 'instruments_generated.h') is stored contiguously, and
+    each voice samples a 256B window beginning at an arbitrary offset within it.
+
+    If 'WAVETABLE_SEGMENTS' is defined, the wavetable is instead stored as the set of unique 256B pages
+    in 'wavetable_generated.h' (produced from 'Waveforms' by 'host/wavepack.cpp'), plus an index that
+    maps each page of the original wavetable to its unique page.  For the current instruments, 34 of
+    the 81 pages are duplicates, saving ~8.5KB of flash.
+
+    A voice's 256B window spans at most two pages.  'WaveWindow' resolves both pages through the index
+    when the window moves (on note on, and when wave modulation advances every 256 samples), so that
+    sampling only selects between the two pages with the carry out of 'window offset + phase'.  The
+    cost in Timer2 ISR cycles, compared with sampling the contiguous wavetable, is measured in
+    simulation by the 'segments-avr' test (see 'cmake/avr-isrcompare.sh'.)
+
+    Instrument records:
+
+    Each instrument is stored in PROGMEM as an 'InstrumentRecord' that holds everything needed to begin
+    playing a note, including the start of all three envelope programs and a copy of each program's
+    first stage.  The record is read with a single contiguous 26B copy (one 'memcpy_P') into a stack
+    local before 'Synth::noteOn()' suspends the ISR, rather than reading three
+    'EnvelopePrograms' and their first 'EnvelopeStages' from six separate locations while suspended.
+    Instruments with identical records share the record, and the MIDI program number maps to its record
+    via 'instruments'.  (The AVR cycles per note-on, over every record, are reported by
+    'avrsim -f _Z6noteOnhhh', see 'host/avrsim.cpp'.)
 */
 
 #ifndef __INSTRUMENT_H__
@@ -19,6 +46,14 @@ struct EnvelopeProgram {
   uint8_t loopStartAndEnd;        // loop start and end indexes nibbles packed into a byte.
 };
 
+// The state needed to start an envelope generator (see 'Envelope::start()').
+struct EnvelopeStart {
+  const EnvelopeStage* stages;    // Pointer to first EnvelopeStage in Instruments::EnvelopeStages
+  uint8_t initialValue;           // Initial value of the envelope generator
+  uint8_t loopStartAndEnd;        // loop start and end indexes nibbles packed into a byte.
+  EnvelopeStage first;            // Copy of the first EnvelopeStage (avoids a second read from PROGMEM)
+};
+
 enum InstrumentFlags : uint8_t {
   InstrumentFlags_None				      = 0,
   InstrumentFlags_Noise				      = (1 << 0),   // Instrument XOR is periodically clobbered with a random value (white noise)
@@ -27,13 +62,14 @@ enum InstrumentFlags : uint8_t {
   InstrumentFlags_SelectWave			  = (1 << 3),   // +0-196 offset to the wavetable pointer depending on the note played.
 };
 
-struct Instrument {
-  const int8_t* wave;       // Pointer into the wavetable for the instrument
-  uint8_t ampMod;           // Index of EnvelopeProgram for amplitude modulation
-  uint8_t freqMod;          // Index of EnvelopeProgram for frequency modulation
-  uint8_t waveMod;          // Index of EnvelopeProgram for wavetable offset modulation
+struct InstrumentRecord {
+  uint16_t wave;            // Offset of the instrument's wave in the wavetable (see 'WaveWindow')
   uint8_t xorBits;          // Xor applied to each wavetable sample
   InstrumentFlags flags;    // Instrument flags, per above.
+  uint8_t variants;         // Index of the first of 3 alternate 'ampMod' in AmpModVariants (if InstrumentFlags_SelectAmplitude)
+  EnvelopeStart ampMod;     // Start of the amplitude modulation EnvelopeProgram
+  EnvelopeStart freqMod;    // Start of the frequency modulation EnvelopeProgram
+  EnvelopeStart waveMod;    // Start of the wavetable offset modulation EnvelopeProgram
 };
 
 // Convenience wrapper around memcpy_P that infers the copy size for the src/dest type.
@@ -45,12 +81,24 @@ class Instruments {
   private:
     #include "instruments_generated.h"
 
+  #ifdef WAVETABLE_SEGMENTS
+    #include "wavetable_generated.h"
+  #endif
+
+    friend class WaveWindow;
+
   public:
-    static void getInstrument(uint8_t index, Instrument& instrument) {
-      PROGMEM_copy(&instruments[index], instrument);
+    static void getInstrumentRecord(uint8_t index, InstrumentRecord& record) {
+      PROGMEM_copy(&InstrumentRecords[pgm_read_byte(&instruments[index])], record);
+    }
+
+    static void getAmpModVariant(uint8_t index, EnvelopeStart& start) {
+      PROGMEM_copy(&AmpModVariants[index], start);
     }
 
-    static uint8_t getPercussiveInstrument(uint8_t note, Instrument& instrument) {
+    // Sets 'instrument' to the index of the percussion instrument for the given 'note' (see
+    // 'getInstrumentRecord()'), and returns the note at which to play it.
+    static uint8_t getPercussiveInstrument(uint8_t note, uint8_t& instrument) {
       /* TODO: Support additional GS/GM2 percussion
     
         27 High Q
@@ -73,28 +121,51 @@ class Instruments {
       uint8_t index = note - 35;							        // Calculate the the index of the percussion instrument relative
       if (index > 45) { index = 45; }					        // to the beginning of the percussion instruments (i.e., less 128).
 
-      Instruments::getInstrument(0x80 + index,			  // Load the percussion instrument
-        instrument);		                              // (Note: percussion instruments begin at 128)
+      instrument = 0x80 + index;                      // Percussion instruments begin at 128.
 
       return pgm_read_byte(&percussionNotes[index]);  // Return the frequency (i.e., midi note) to play the instrument.
     }
 
-    static void getEnvelopeProgram(uint8_t programIndex, EnvelopeProgram& program) {
-      PROGMEM_copy(&EnvelopePrograms[programIndex], program);
-    }
-
     static void getEnvelopeStage(const EnvelopeStage* pStart, EnvelopeStage& stage) {
       PROGMEM_copy(pStart, stage);
     }
 
-  #ifdef __EMSCRIPTEN__
+    // Converts a pointer into 'EnvelopeStages' to an index and back (used by snapshots, see 'snapshot.h').
+    // A null pointer is converted to 'noStage'.
+    static constexpr uint16_t noStage = 0xFFFF;
+
+    static uint16_t getEnvelopeStageIndex(const EnvelopeStage* pStage) {
+      return pStage == nullptr ? noStage : pStage - &EnvelopeStages[0];
+    }
+
+    static const EnvelopeStage* getEnvelopeStageAt(uint16_t index) {
+      return index == noStage ? nullptr : &EnvelopeStages[index];
+    }
+
+    // Returns true if 'index' is within 'EnvelopeStages' (used to validate restored snapshots.)
+    static bool isEnvelopeStageIndex(uint16_t index) {
+      return index < sizeof(EnvelopeStages) / sizeof(EnvelopeStages[0]);
+    }
+
+  #ifndef __AVR__
+    // Returns the start of the EnvelopeProgram at the given 'programIndex' (used by tools.)
+    static void getEnvelopeStart(uint8_t programIndex, EnvelopeStart& start) {
+      const EnvelopeProgram& program = EnvelopePrograms[programIndex];
+      start.stages = program.start;
+      start.initialValue = program.initialValue;
+      start.loopStartAndEnd = program.loopStartAndEnd;
+      start.first = *program.start;
+    }
+
     static const HeapRegion<uint8_t> getPercussionNotes() {
       return HeapRegion<uint8_t>(&percussionNotes[0], sizeof(percussionNotes));
     }
 
+  #ifndef WAVETABLE_SEGMENTS
     static const HeapRegion<int8_t> getWavetable() {
       return HeapRegion<int8_t>(&Waveforms[0], sizeof(Waveforms));
     }
+  #endif // !WAVETABLE_SEGMENTS
 
     static const HeapRegion<EnvelopeProgram> getEnvelopePrograms() {
       return HeapRegion<EnvelopeProgram>(&EnvelopePrograms[0], sizeof(EnvelopePrograms));
@@ -104,16 +175,112 @@ class Instruments {
       return HeapRegion<EnvelopeStage>(&EnvelopeStages[0], sizeof(EnvelopeStages));
     }
 
-    static const HeapRegion<Instrument> getInstruments() {
-      return HeapRegion<Instrument>(&instruments[0], sizeof(instruments));
+    static const HeapRegion<EnvelopeStart> getAmpModVariants() {
+      return HeapRegion<EnvelopeStart>(&AmpModVariants[0], sizeof(AmpModVariants));
+    }
+
+    static const HeapRegion<InstrumentRecord> getInstrumentRecords() {
+      return HeapRegion<InstrumentRecord>(&InstrumentRecords[0], sizeof(InstrumentRecords));
+    }
+
+    static const HeapRegion<uint8_t> getInstruments() {
+      return HeapRegion<uint8_t>(&instruments[0], sizeof(instruments));
+    }
+  #endif // !__AVR__
+};
+
+// The 256B window of the wavetable sampled by a voice.
+class WaveWindow final {
+  private:
+  #ifdef WAVETABLE_SEGMENTS
+    uint8_t offsetLo = 0;                               // Low byte of the window's offset in the (uncompressed) wavetable.
+    uint8_t page0 = 0;                                  // Unique page containing the start of the window.
+    uint8_t page1 = 0;                                  // Unique page containing the remainder of the window.
+  #else
+    const int8_t* pStart = &Instruments::Waveforms[0];  // Start of the window in 'Instruments::Waveforms'.
+  #endif
+
+  public:
+    // Moves the window to the given 'offset' in the wavetable.
+    void set(uint16_t offset) volatile {
+    #ifdef WAVETABLE_SEGMENTS
+      const uint8_t page = offset >> 8;
+      offsetLo = static_cast<uint8_t>(offset);
+      page0 = pgm_read_byte(&Instruments::WavePageIndex[page]);
+      page1 = pgm_read_byte(&Instruments::WavePageIndex[page + 1]);
+    #else
+      pStart = &Instruments::Waveforms[offset];
+    #endif
+    }
+
+    // Returns true if the window can be moved to the given 'offset', i.e., the 256 samples starting
+    // at 'offset' are within the wavetable (used to validate restored snapshots.)
+    static bool isValidOffset(uint16_t offset) {
+    #ifdef WAVETABLE_SEGMENTS
+      return (offset >> 8) + 1u < sizeof(Instruments::WavePageIndex);
+    #else
+      return offset <= sizeof(Instruments::Waveforms) - 256u;
+    #endif
+    }
+
+    // Returns the window to its initial position at the start of the wavetable.
+    void reset() volatile {
+    #ifdef WAVETABLE_SEGMENTS
+      offsetLo = 0;
+      page0 = 0;
+      page1 = 0;
+    #else
+      pStart = &Instruments::Waveforms[0];
+    #endif
+    }
+
+    // Returns the wavetable sample at the given 'phase' [0 .. 255] within the window.
+    int8_t sample(uint8_t phase) const volatile __attribute__((always_inline)) {
+    #ifdef WAVETABLE_SEGMENTS
+      const uint16_t sum = offsetLo + phase;
+      const uint8_t page = (sum >> 8) ? page1 : page0;
+      return pgm_read_byte(&Instruments::WavePages[page][static_cast<uint8_t>(sum)]);
+    #else
+      return pgm_read_byte(pStart + phase);
+    #endif
+    }
+
+    // Saves or restores the window (see 'snapshot.h').  A restored window outside of the wavetable
+    // fails the restore and is reset.
+    template <typename TArchive> void serialize(TArchive& archive) volatile {
+    #ifdef WAVETABLE_SEGMENTS
+      static constexpr uint8_t numPages = sizeof(Instruments::WavePages) / sizeof(Instruments::WavePages[0]);
+      archive.io(offsetLo);
+      archive.io(page0);
+      archive.io(page1);
+      if (!archive.check(page0 < numPages && page1 < numPages)) {
+        reset();
+      }
+    #else
+      uint16_t offset = pStart - &Instruments::Waveforms[0];
+      archive.io(offset);
+      if (archive.check(isValidOffset(offset))) {
+        pStart = &Instruments::Waveforms[offset];
+      } else {
+        reset();
+      }
+    #endif
     }
-  #endif // __EMSCRIPTEN__
 };
 
 constexpr EnvelopeStage Instruments::EnvelopeStages[] PROGMEM;
+#ifndef __AVR__
 constexpr EnvelopeProgram Instruments::EnvelopePrograms[] PROGMEM;
-constexpr Instrument Instruments::instruments[] PROGMEM;
+#endif
+constexpr EnvelopeStart Instruments::AmpModVariants[] PROGMEM;
+constexpr InstrumentRecord Instruments::InstrumentRecords[] PROGMEM;
+constexpr uint8_t Instruments::instruments[] PROGMEM;
+#ifdef WAVETABLE_SEGMENTS
+constexpr uint8_t Instruments::WavePageIndex[] PROGMEM;
+constexpr int8_t Instruments::WavePages[][256] PROGMEM;
+#else
 constexpr int8_t Instruments::Waveforms[] PROGMEM;
+#endif
 constexpr uint8_t Instruments::percussionNotes[] PROGMEM;
 
 #endif // __INSTRUMENT_H__
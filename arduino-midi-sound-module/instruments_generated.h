@@ -1,39 +1,41 @@
 /*
     Instruments programs and wavetable
     https://github.com/DLehenbauer/arduino-midi-sound-module
+
+    Generated by 'host/instgen.cpp' from 'instruments.txt'.  Do not edit.
 */
 
 static constexpr EnvelopeStage EnvelopeStages[] PROGMEM = {
-	/* 0000: */ {      0,  -64 },
-	/* 0001: */ {  29332,   96 },
-	/* 0002: */ {   -656,   48 },
-	/* 0003: */ {   -284,   16 },
-	/* 0004: */ {    -18,    0 },
-	/* 0005: */ {   -788,    0 },
+	/* 0000: */ {  32512,   65 },
+	/* 0001: */ { -32512,   63 },
+	/* 0002: */ {      0,  -64 },
+	/* 0003: */ {      0,  -64 },
+	/* 0004: */ {      0,  -64 },
+	/* 0005: */ {      0,  -64 },
 	/* 0006: */ {      0,  -64 },
-	/* 0007: */ {  29332,   96 },
-	/* 0008: */ {   -886,   48 },
-	/* 0009: */ {   -358,   12 },
-	/* 000a: */ {    -18,    0 },
-	/* 000b: */ {   -788,    0 },
+	/* 0007: */ {      0,  -64 },
+	/* 0008: */ {      0,  -64 },
+	/* 0009: */ {      0,  -64 },
+	/* 000a: */ {      0,  -64 },
+	/* 000b: */ {      0,  -64 },
 	/* 000c: */ {      0,  -64 },
-	/* 000d: */ {  29332,   96 },
-	/* 000e: */ {  -1098,   48 },
-	/* 000f: */ {   -372,   12 },
-	/* 0010: */ {    -26,    0 },
-	/* 0011: */ {   -788,    0 },
+	/* 000d: */ {      0,  -64 },
+	/* 000e: */ {      0,  -64 },
+	/* 000f: */ {      0,  -64 },
+	/* 0010: */ {      0,  -64 },
+	/* 0011: */ {      0,  -64 },
 	/* 0012: */ {      0,  -64 },
-	/* 0013: */ {  29332,   96 },
-	/* 0014: */ {  -1576,   48 },
-	/* 0015: */ {   -632,   12 },
-	/* 0016: */ {    -54,    0 },
-	/* 0017: */ {   -788,    0 },
+	/* 0013: */ {      0,  -64 },
+	/* 0014: */ {      0,  -64 },
+	/* 0015: */ {      0,  -64 },
+	/* 0016: */ {      0,  -64 },
+	/* 0017: */ {      0,  -64 },
 	/* 0018: */ {      0,  -64 },
-	/* 0019: */ {   4885,   84 },
-	/* 001a: */ {   -667,   64 },
-	/* 001b: */ {   -186,   24 },
-	/* 001c: */ {     -9,    0 },
-	/* 001d: */ {  -4885,    0 },
+	/* 0019: */ {      0,  -64 },
+	/* 001a: */ {      0,  -64 },
+	/* 001b: */ {      0,  -64 },
+	/* 001c: */ {      0,  -64 },
+	/* 001d: */ {      0,  -64 },
 	/* 001e: */ {      0,  -64 },
 	/* 001f: */ {      0,  -64 },
 	/* 0020: */ {      0,  -64 },
@@ -92,102 +94,102 @@ static constexpr EnvelopeStage EnvelopeStages[] PROGMEM = {
 	/* 0055: */ {      0,  -64 },
 	/* 0056: */ {      0,  -64 },
 	/* 0057: */ {      0,  -64 },
-	/* 0058: */ {  14666,   72 },
-	/* 0059: */ {   -352,   48 },
-	/* 005a: */ {  -3661,    8 },
-	/* 005b: */ {   -462,    4 },
-	/* 005c: */ {  -1910,    0 },
+	/* 0058: */ {      0,  -64 },
+	/* 0059: */ {      0,  -64 },
+	/* 005a: */ {      0,  -64 },
+	/* 005b: */ {      0,  -64 },
+	/* 005c: */ {      0,  -64 },
 	/* 005d: */ {      0,  -64 },
-	/* 005e: */ {  14662,   80 },
-	/* 005f: */ {  -2218,   48 },
-	/* 0060: */ {   2218,   53 },
-	/* 0061: */ {  -1910,   16 },
-	/* 0062: */ {   -260,    0 },
+	/* 005e: */ {      0,  -64 },
+	/* 005f: */ {      0,  -64 },
+	/* 0060: */ {      0,  -64 },
+	/* 0061: */ {      0,  -64 },
+	/* 0062: */ {      0,  -64 },
 	/* 0063: */ {      0,  -64 },
-	/* 0064: */ {  32512,   84 },
-	/* 0065: */ {  -1334,   53 },
-	/* 0066: */ {  -2218,   48 },
-	/* 0067: */ {   -820,   16 },
-	/* 0068: */ {   -400,    0 },
+	/* 0064: */ {      0,  -64 },
+	/* 0065: */ {      0,  -64 },
+	/* 0066: */ {      0,  -64 },
+	/* 0067: */ {      0,  -64 },
+	/* 0068: */ {      0,  -64 },
 	/* 0069: */ {      0,  -64 },
-	/* 006a: */ {  29332,   72 },
-	/* 006b: */ {  -7322,   53 },
-	/* 006c: */ {  -4872,   48 },
-	/* 006d: */ {  -3232,    8 },
-	/* 006e: */ {   -446,    0 },
+	/* 006a: */ {      0,  -64 },
+	/* 006b: */ {      0,  -64 },
+	/* 006c: */ {      0,  -64 },
+	/* 006d: */ {      0,  -64 },
+	/* 006e: */ {      0,  -64 },
 	/* 006f: */ {      0,  -64 },
 	/* 0070: */ {      0,  -64 },
 	/* 0071: */ {      0,  -64 },
 	/* 0072: */ {      0,  -64 },
 	/* 0073: */ {      0,  -64 },
-	/* 0074: */ {   2926,   72 },
-	/* 0075: */ {   -426,   58 },
-	/* 0076: */ {    -69,   56 },
-	/* 0077: */ {     98,   60 },
-	/* 0078: */ {   -667,    0 },
+	/* 0074: */ {      0,  -64 },
+	/* 0075: */ {      0,  -64 },
+	/* 0076: */ {      0,  -64 },
+	/* 0077: */ {      0,  -64 },
+	/* 0078: */ {      0,  -64 },
 	/* 0079: */ {      0,  -64 },
-	/* 007a: */ {    955,   72 },
-	/* 007b: */ {   -305,   58 },
-	/* 007c: */ {  -1317,   16 },
-	/* 007d: */ {  -2436,    8 },
-	/* 007e: */ { -14666,    0 },
+	/* 007a: */ {      0,  -64 },
+	/* 007b: */ {      0,  -64 },
+	/* 007c: */ {      0,  -64 },
+	/* 007d: */ {      0,  -64 },
+	/* 007e: */ {      0,  -64 },
 	/* 007f: */ {      0,  -64 },
-	/* 0080: */ {   1204,   72 },
-	/* 0081: */ {   -352,   58 },
-	/* 0082: */ {    -41,   56 },
-	/* 0083: */ {     50,   60 },
-	/* 0084: */ {  -1109,    0 },
+	/* 0080: */ {      0,  -64 },
+	/* 0081: */ {      0,  -64 },
+	/* 0082: */ {      0,  -64 },
+	/* 0083: */ {      0,  -64 },
+	/* 0084: */ {      0,  -64 },
 	/* 0085: */ {      0,  -64 },
-	/* 0086: */ {   1452,   40 },
-	/* 0087: */ {    256,   50 },
-	/* 0088: */ {     31,   54 },
-	/* 0089: */ {    -31,   50 },
-	/* 008a: */ {   -549,    0 },
+	/* 0086: */ {      0,  -64 },
+	/* 0087: */ {      0,  -64 },
+	/* 0088: */ {      0,  -64 },
+	/* 0089: */ {      0,  -64 },
+	/* 008a: */ {      0,  -64 },
 	/* 008b: */ {      0,  -64 },
-	/* 008c: */ {    160,   40 },
-	/* 008d: */ {     69,   62 },
-	/* 008e: */ {    -83,   54 },
-	/* 008f: */ {     41,   64 },
-	/* 0090: */ {   -275,    0 },
+	/* 008c: */ {      0,  -64 },
+	/* 008d: */ {      0,  -64 },
+	/* 008e: */ {      0,  -64 },
+	/* 008f: */ {      0,  -64 },
+	/* 0090: */ {      0,  -64 },
 	/* 0091: */ {      0,  -64 },
 	/* 0092: */ {      0,  -64 },
 	/* 0093: */ {      0,  -64 },
 	/* 0094: */ {      0,  -64 },
 	/* 0095: */ {      0,  -64 },
-	/* 0096: */ {   2085,   72 },
-	/* 0097: */ {   -549,   52 },
-	/* 0098: */ {   -340,   48 },
-	/* 0099: */ {    481,   52 },
-	/* 009a: */ {  -1317,    0 },
+	/* 0096: */ {      0,  -64 },
+	/* 0097: */ {      0,  -64 },
+	/* 0098: */ {      0,  -64 },
+	/* 0099: */ {      0,  -64 },
+	/* 009a: */ {      0,  -64 },
 	/* 009b: */ {      0,  -64 },
-	/* 009c: */ {    893,   72 },
-	/* 009d: */ {   -837,   52 },
-	/* 009e: */ {   -634,   46 },
-	/* 009f: */ {    703,   59 },
-	/* 00a0: */ {   -788,    0 },
+	/* 009c: */ {      0,  -64 },
+	/* 009d: */ {      0,  -64 },
+	/* 009e: */ {      0,  -64 },
+	/* 009f: */ {      0,  -64 },
+	/* 00a0: */ {      0,  -64 },
 	/* 00a1: */ {      0,  -64 },
 	/* 00a2: */ {      0,  -64 },
 	/* 00a3: */ {      0,  -64 },
 	/* 00a4: */ {      0,  -64 },
 	/* 00a5: */ {      0,  -64 },
 	/* 00a6: */ {      0,  -64 },
-	/* 00a7: */ {  14666,   84 },
-	/* 00a8: */ {   -462,   62 },
-	/* 00a9: */ {    316,   66 },
-	/* 00aa: */ {  -1822,   16 },
-	/* 00ab: */ {  -2926,    0 },
+	/* 00a7: */ {      0,  -64 },
+	/* 00a8: */ {      0,  -64 },
+	/* 00a9: */ {      0,  -64 },
+	/* 00aa: */ {      0,  -64 },
+	/* 00ab: */ {      0,  -64 },
 	/* 00ac: */ {      0,  -64 },
-	/* 00ad: */ {   3661,   72 },
-	/* 00ae: */ {   -703,   49 },
-	/* 00af: */ {     31,   50 },
-	/* 00b0: */ {   -703,    8 },
-	/* 00b1: */ {   -743,    0 },
+	/* 00ad: */ {      0,  -64 },
+	/* 00ae: */ {      0,  -64 },
+	/* 00af: */ {      0,  -64 },
+	/* 00b0: */ {      0,  -64 },
+	/* 00b1: */ {      0,  -64 },
 	/* 00b2: */ {      0,  -64 },
-	/* 00b3: */ {   2926,   80 },
-	/* 00b4: */ {   -703,   49 },
-	/* 00b5: */ {     31,   50 },
-	/* 00b6: */ {   -703,    8 },
-	/* 00b7: */ {  -1616,    0 },
+	/* 00b3: */ {      0,  -64 },
+	/* 00b4: */ {      0,  -64 },
+	/* 00b5: */ {      0,  -64 },
+	/* 00b6: */ {      0,  -64 },
+	/* 00b7: */ {      0,  -64 },
 	/* 00b8: */ {      0,  -64 },
 	/* 00b9: */ {      0,  -64 },
 	/* 00ba: */ {      0,  -64 },
@@ -211,11 +213,11 @@ static constexpr EnvelopeStage EnvelopeStages[] PROGMEM = {
 	/* 00cc: */ {      0,  -64 },
 	/* 00cd: */ {      0,  -64 },
 	/* 00ce: */ {      0,  -64 },
-	/* 00cf: */ { -32512,    0 },
-	/* 00d0: */ {    179,    8 },
-	/* 00d1: */ {    179,   16 },
-	/* 00d2: */ {    179,   48 },
-	/* 00d3: */ {  -2926,    0 },
+	/* 00cf: */ {      0,  -64 },
+	/* 00d0: */ {      0,  -64 },
+	/* 00d1: */ {      0,  -64 },
+	/* 00d2: */ {      0,  -64 },
+	/* 00d3: */ {      0,  -64 },
 	/* 00d4: */ {      0,  -64 },
 	/* 00d5: */ {      0,  -64 },
 	/* 00d6: */ {      0,  -64 },
@@ -232,36 +234,36 @@ static constexpr EnvelopeStage EnvelopeStages[] PROGMEM = {
 	/* 00e1: */ {      0,  -64 },
 	/* 00e2: */ {      0,  -64 },
 	/* 00e3: */ {      0,  -64 },
-	/* 00e4: */ {  32512,  127 },
-	/* 00e5: */ {    -54,  126 },
-	/* 00e6: */ {  -9770,   64 },
-	/* 00e7: */ {   -760,   16 },
-	/* 00e8: */ {   -146,    0 },
+	/* 00e4: */ {      0,  -64 },
+	/* 00e5: */ {      0,  -64 },
+	/* 00e6: */ {      0,  -64 },
+	/* 00e7: */ {      0,  -64 },
+	/* 00e8: */ {      0,  -64 },
 	/* 00e9: */ {      0,  -64 },
-	/* 00ea: */ {  -5852,   96 },
-	/* 00eb: */ {  -3232,   48 },
-	/* 00ec: */ {  -1098,   24 },
-	/* 00ed: */ {   -494,    8 },
-	/* 00ee: */ {    -82,    0 },
+	/* 00ea: */ {      0,  -64 },
+	/* 00eb: */ {      0,  -64 },
+	/* 00ec: */ {      0,  -64 },
+	/* 00ed: */ {      0,  -64 },
+	/* 00ee: */ {      0,  -64 },
 	/* 00ef: */ {      0,  -64 },
-	/* 00f0: */ {  32512,   96 },
-	/* 00f1: */ {  -3232,   32 },
-	/* 00f2: */ {  -1334,   16 },
-	/* 00f3: */ {   -852,    8 },
-	/* 00f4: */ {   -238,    0 },
+	/* 00f0: */ {      0,  -64 },
+	/* 00f1: */ {      0,  -64 },
+	/* 00f2: */ {      0,  -64 },
+	/* 00f3: */ {      0,  -64 },
+	/* 00f4: */ {      0,  -64 },
 	/* 00f5: */ {      0,  -64 },
-	/* 00f6: */ {   7331,   68 },
-	/* 00f7: */ {  -7331,   16 },
-	/* 00f8: */ {   2926,   32 },
-	/* 00f9: */ {  -1822,   10 },
-	/* 00fa: */ {   -179,    0 },
+	/* 00f6: */ {      0,  -64 },
+	/* 00f7: */ {      0,  -64 },
+	/* 00f8: */ {      0,  -64 },
+	/* 00f9: */ {      0,  -64 },
+	/* 00fa: */ {      0,  -64 },
 	/* 00fb: */ {      0,  -64 },
-	/* 00fc: */ {   4885,   64 },
-	/* 00fd: */ {  -3661,   16 },
-	/* 00fe: */ {   4885,   32 },
-	/* 00ff: */ {  -1204,   12 },
-	/* 0100: */ {   -328,    0 },
-	/* 0101: */ {      0,  -64 },
+	/* 00fc: */ {      0,  -64 },
+	/* 00fd: */ {      0,  -64 },
+	/* 00fe: */ {      0,  -64 },
+	/* 00ff: */ {      0,  -64 },
+	/* 0100: */ {     31,    2 },
+	/* 0101: */ {    -36,    0 },
 	/* 0102: */ {      0,  -64 },
 	/* 0103: */ {      0,  -64 },
 	/* 0104: */ {      0,  -64 },
@@ -273,17 +275,17 @@ static constexpr EnvelopeStage EnvelopeStages[] PROGMEM = {
 	/* 010a: */ {      0,  -64 },
 	/* 010b: */ {      0,  -64 },
 	/* 010c: */ {      0,  -64 },
-	/* 010d: */ {    160,  100 },
-	/* 010e: */ {  -1452,   48 },
-	/* 010f: */ {   -426,   16 },
-	/* 0110: */ {   -142,    8 },
-	/* 0111: */ {    -18,    0 },
-	/* 0112: */ {      0,  -64 },
-	/* 0113: */ {    148,   96 },
-	/* 0114: */ {  -2436,   48 },
-	/* 0115: */ {  -1204,   16 },
-	/* 0116: */ {   -462,    8 },
-	/* 0117: */ {    -98,    0 },
+	/* 010d: */ {      0,  -64 },
+	/* 010e: */ {      0,  -64 },
+	/* 010f: */ {      0,  -64 },
+	/* 0110: */ {      0,  -64 },
+	/* 0111: */ {   2085,   70 },
+	/* 0112: */ {   -667,   60 },
+	/* 0113: */ {    305,   64 },
+	/* 0114: */ {      0,  -64 },
+	/* 0115: */ {    703,   20 },
+	/* 0116: */ {   -703,    0 },
+	/* 0117: */ {      0,  -64 },
 	/* 0118: */ {      0,  -64 },
 	/* 0119: */ {      0,  -64 },
 	/* 011a: */ {      0,  -64 },
@@ -298,1319 +300,522 @@ static constexpr EnvelopeStage EnvelopeStages[] PROGMEM = {
 	/* 0123: */ {      0,  -64 },
 	/* 0124: */ {      0,  -64 },
 	/* 0125: */ {      0,  -64 },
-	/* 0126: */ {      0,  -64 },
-	/* 0127: */ {      0,  -64 },
+	/* 0126: */ {    305,  127 },
+	/* 0127: */ {   -247,   96 },
 	/* 0128: */ {      0,  -64 },
-	/* 0129: */ {      0,  -64 },
-	/* 012a: */ {      0,  -64 },
-	/* 012b: */ {      0,  -64 },
+	/* 0129: */ {    549,   64 },
+	/* 012a: */ {   -200,   32 },
+	/* 012b: */ {    154,   48 },
 	/* 012c: */ {      0,  -64 },
-	/* 012d: */ {      0,  -64 },
-	/* 012e: */ {      0,  -64 },
-	/* 012f: */ {      0,  -64 },
+	/* 012d: */ {    549,   64 },
+	/* 012e: */ {    -69,   61 },
+	/* 012f: */ {    200,   64 },
 	/* 0130: */ {      0,  -64 },
-	/* 0131: */ {      0,  -64 },
-	/* 0132: */ {      0,  -64 },
-	/* 0133: */ {      0,  -64 },
+	/* 0131: */ {   4885,  127 },
+	/* 0132: */ {   -160,  120 },
+	/* 0133: */ {    173,  127 },
 	/* 0134: */ {      0,  -64 },
-	/* 0135: */ {      0,  -64 },
-	/* 0136: */ {      0,  -64 },
+	/* 0135: */ {   2926,   65 },
+	/* 0136: */ {   -125,   63 },
 	/* 0137: */ {      0,  -64 },
-	/* 0138: */ {      0,  -64 },
-	/* 0139: */ {      0,  -64 },
-	/* 013a: */ {      0,  -64 },
+	/* 0138: */ {    549,   64 },
+	/* 0139: */ {   -200,   32 },
+	/* 013a: */ {    154,   48 },
 	/* 013b: */ {      0,  -64 },
-	/* 013c: */ {      0,  -64 },
-	/* 013d: */ {      0,  -64 },
-	/* 013e: */ {      0,  -64 },
+	/* 013c: */ {   4885,  127 },
+	/* 013d: */ {   -160,  120 },
+	/* 013e: */ {    173,  127 },
 	/* 013f: */ {      0,  -64 },
-	/* 0140: */ {      0,  -64 },
-	/* 0141: */ {      0,  -64 },
+	/* 0140: */ {    634,  127 },
+	/* 0141: */ {   -634,    0 },
 	/* 0142: */ {      0,  -64 },
-	/* 0143: */ {      0,  -64 },
-	/* 0144: */ {      0,  -64 },
-	/* 0145: */ {      0,  -64 },
-	/* 0146: */ {  14662,   34 },
-	/* 0147: */ {      0,  -64 },
-	/* 0148: */ {   9770,   64 },
-	/* 0149: */ {      0,  -64 },
-	/* 014a: */ {  32512,    0 },
-	/* 014b: */ { -32512,    0 },
-	/* 014c: */ {      0,  -64 },
-	/* 014d: */ {     54,   32 },
-	/* 014e: */ {      0,    0 },
-	/* 014f: */ {      0,  -64 },
-	/* 0150: */ {  29332,   72 },
-	/* 0151: */ {  -1098,   63 },
-	/* 0152: */ {  32512,   65 },
-	/* 0153: */ {      0,  -64 },
-	/* 0154: */ {  32512,   66 },
-	/* 0155: */ { -32512,   62 },
-	/* 0156: */ {      0,  -64 },
-	/* 0157: */ {  32512,   64 },
-	/* 0158: */ {      0,  -64 },
-	/* 0159: */ {  32512,   63 },
-	/* 015a: */ {  32512,   65 },
-	/* 015b: */ {      0,  -64 },
-	/* 015c: */ {  -7331,   67 },
-	/* 015d: */ {  -7331,   61 },
-	/* 015e: */ {      0,  -64 },
-	/* 015f: */ {    340,   64 },
-	/* 0160: */ {   -294,   48 },
-	/* 0161: */ {      0,  -64 },
-	/* 0162: */ {   7331,   64 },
-	/* 0163: */ {      0,  -64 },
-	/* 0164: */ {   2436,   64 },
-	/* 0165: */ {      0,  -64 },
-	/* 0166: */ {    525,   16 },
-	/* 0167: */ {   -256,   15 },
-	/* 0168: */ {      0,  -64 },
-	/* 0169: */ {   2926,   65 },
-	/* 016a: */ {   -125,   63 },
-	/* 016b: */ {      0,  -64 },
-	/* 016c: */ {    549,   64 },
-	/* 016d: */ {   -200,   32 },
-	/* 016e: */ {    154,   48 },
-	/* 016f: */ {      0,  -64 },
-	/* 0170: */ {    549,   64 },
-	/* 0171: */ {    -69,   61 },
-	/* 0172: */ {    200,   64 },
-	/* 0173: */ {      0,  -64 },
-	/* 0174: */ {   4885,  127 },
-	/* 0175: */ {   -160,  120 },
-	/* 0176: */ {    173,  127 },
-	/* 0177: */ {      0,  -64 },
-	/* 0178: */ {    634,  127 },
-	/* 0179: */ {   -634,    0 },
-	/* 017a: */ {      0,  -64 },
-	/* 017b: */ {    703,   20 },
-	/* 017c: */ {   -703,    0 },
-	/* 017d: */ {      0,  -64 },
+	/* 0143: */ {  29332,   96 },
+	/* 0144: */ {   -656,   48 },
+	/* 0145: */ {   -284,   16 },
+	/* 0146: */ {    -18,    0 },
+	/* 0147: */ {   -788,    0 },
+	/* 0148: */ {      0,  -64 },
+	/* 0149: */ {  29332,   96 },
+	/* 014a: */ {   -886,   48 },
+	/* 014b: */ {   -358,   12 },
+	/* 014c: */ {    -18,    0 },
+	/* 014d: */ {   -788,    0 },
+	/* 014e: */ {      0,  -64 },
+	/* 014f: */ {  29332,   96 },
+	/* 0150: */ {  -1098,   48 },
+	/* 0151: */ {   -372,   12 },
+	/* 0152: */ {    -26,    0 },
+	/* 0153: */ {   -788,    0 },
+	/* 0154: */ {      0,  -64 },
+	/* 0155: */ {  29332,   96 },
+	/* 0156: */ {  -1576,   48 },
+	/* 0157: */ {   -632,   12 },
+	/* 0158: */ {    -54,    0 },
+	/* 0159: */ {   -788,    0 },
+	/* 015a: */ {      0,  -64 },
+	/* 015b: */ {   4885,   84 },
+	/* 015c: */ {   -667,   64 },
+	/* 015d: */ {   -186,   24 },
+	/* 015e: */ {     -9,    0 },
+	/* 015f: */ {  -4885,    0 },
+	/* 0160: */ {      0,  -64 },
+	/* 0161: */ {  14666,   72 },
+	/* 0162: */ {   -352,   48 },
+	/* 0163: */ {  -3661,    8 },
+	/* 0164: */ {   -462,    4 },
+	/* 0165: */ {  -1910,    0 },
+	/* 0166: */ {      0,  -64 },
+	/* 0167: */ {  14662,   80 },
+	/* 0168: */ {  -2218,   48 },
+	/* 0169: */ {   2218,   53 },
+	/* 016a: */ {  -1910,   16 },
+	/* 016b: */ {   -260,    0 },
+	/* 016c: */ {      0,  -64 },
+	/* 016d: */ {  32512,   84 },
+	/* 016e: */ {  -1334,   53 },
+	/* 016f: */ {  -2218,   48 },
+	/* 0170: */ {   -820,   16 },
+	/* 0171: */ {   -400,    0 },
+	/* 0172: */ {      0,  -64 },
+	/* 0173: */ {  29332,   72 },
+	/* 0174: */ {  -7322,   53 },
+	/* 0175: */ {  -4872,   48 },
+	/* 0176: */ {  -3232,    8 },
+	/* 0177: */ {   -446,    0 },
+	/* 0178: */ {      0,  -64 },
+	/* 0179: */ {   2926,   72 },
+	/* 017a: */ {   -426,   58 },
+	/* 017b: */ {    -69,   56 },
+	/* 017c: */ {     98,   60 },
+	/* 017d: */ {   -667,    0 },
 	/* 017e: */ {      0,  -64 },
-	/* 017f: */ {      0,  -64 },
-	/* 0180: */ {      0,  -64 },
-	/* 0181: */ {      0,  -64 },
-	/* 0182: */ {      0,  -64 },
-	/* 0183: */ {      0,  -64 },
+	/* 017f: */ {    955,   72 },
+	/* 0180: */ {   -305,   58 },
+	/* 0181: */ {  -1317,   16 },
+	/* 0182: */ {  -2436,    8 },
+	/* 0183: */ { -14666,    0 },
 	/* 0184: */ {      0,  -64 },
-	/* 0185: */ {      0,  -64 },
-	/* 0186: */ {      0,  -64 },
-	/* 0187: */ {      0,  -64 },
-	/* 0188: */ {      0,  -64 },
-	/* 0189: */ {      0,  -64 },
+	/* 0185: */ {   1204,   72 },
+	/* 0186: */ {   -352,   58 },
+	/* 0187: */ {    -41,   56 },
+	/* 0188: */ {     50,   60 },
+	/* 0189: */ {  -1109,    0 },
 	/* 018a: */ {      0,  -64 },
-	/* 018b: */ {      0,  -64 },
-	/* 018c: */ {    305,  127 },
-	/* 018d: */ {   -247,   96 },
-	/* 018e: */ {      0,  -64 },
-	/* 018f: */ {     31,    2 },
-	/* 0190: */ {    -36,    0 },
-	/* 0191: */ {      0,  -64 },
-	/* 0192: */ {      0,  -64 },
-	/* 0193: */ {      0,  -64 },
-	/* 0194: */ {      0,  -64 },
-	/* 0195: */ {      0,  -64 },
+	/* 018b: */ {   1452,   40 },
+	/* 018c: */ {    256,   50 },
+	/* 018d: */ {     31,   54 },
+	/* 018e: */ {    -31,   50 },
+	/* 018f: */ {   -549,    0 },
+	/* 0190: */ {      0,  -64 },
+	/* 0191: */ {    160,   40 },
+	/* 0192: */ {     69,   62 },
+	/* 0193: */ {    -83,   54 },
+	/* 0194: */ {     41,   64 },
+	/* 0195: */ {   -275,    0 },
 	/* 0196: */ {      0,  -64 },
-	/* 0197: */ {      0,  -64 },
-	/* 0198: */ {      0,  -64 },
-	/* 0199: */ {      0,  -64 },
-	/* 019a: */ {      0,  -64 },
-	/* 019b: */ {      0,  -64 },
+	/* 0197: */ {   2085,   72 },
+	/* 0198: */ {   -549,   52 },
+	/* 0199: */ {   -340,   48 },
+	/* 019a: */ {    481,   52 },
+	/* 019b: */ {  -1317,    0 },
 	/* 019c: */ {      0,  -64 },
-	/* 019d: */ {      0,  -64 },
-	/* 019e: */ {      0,  -64 },
-	/* 019f: */ {      0,  -64 },
-	/* 01a0: */ {   2085,   70 },
-	/* 01a1: */ {   -667,   60 },
-	/* 01a2: */ {    305,   64 },
-	/* 01a3: */ {      0,  -64 },
-	/* 01a4: */ {      0,  -64 },
-	/* 01a5: */ {      0,  -64 },
-	/* 01a6: */ {      0,  -64 },
-	/* 01a7: */ {      0,  -64 },
+	/* 019d: */ {    893,   72 },
+	/* 019e: */ {   -837,   52 },
+	/* 019f: */ {   -634,   46 },
+	/* 01a0: */ {    703,   59 },
+	/* 01a1: */ {   -788,    0 },
+	/* 01a2: */ {      0,  -64 },
+	/* 01a3: */ {  14666,   84 },
+	/* 01a4: */ {   -462,   62 },
+	/* 01a5: */ {    316,   66 },
+	/* 01a6: */ {  -1822,   16 },
+	/* 01a7: */ {  -2926,    0 },
 	/* 01a8: */ {      0,  -64 },
-	/* 01a9: */ {      0,  -64 },
-	/* 01aa: */ {      0,  -64 },
-	/* 01ab: */ {      0,  -64 },
-	/* 01ac: */ {      0,  -64 },
-	/* 01ad: */ {      0,  -64 },
+	/* 01a9: */ {   3661,   72 },
+	/* 01aa: */ {   -703,   49 },
+	/* 01ab: */ {     31,   50 },
+	/* 01ac: */ {   -703,    8 },
+	/* 01ad: */ {   -743,    0 },
 	/* 01ae: */ {      0,  -64 },
-	/* 01af: */ {  32512,   67 },
-	/* 01b0: */ { -32512,   61 },
-	/* 01b1: */ {      0,  -64 },
-	/* 01b2: */ {  32512,   66 },
-	/* 01b3: */ { -32512,   62 },
+	/* 01af: */ {   2926,   80 },
+	/* 01b0: */ {   -703,   49 },
+	/* 01b1: */ {     31,   50 },
+	/* 01b2: */ {   -703,    8 },
+	/* 01b3: */ {  -1616,    0 },
 	/* 01b4: */ {      0,  -64 },
-	/* 01b5: */ {  32512,   65 },
-	/* 01b6: */ { -32512,   63 },
-	/* 01b7: */ {      0,  -64 },
-	/* 01b8: */ {      0,  -64 },
-	/* 01b9: */ {      0,  -64 },
+	/* 01b5: */ { -32512,    0 },
+	/* 01b6: */ {    179,    8 },
+	/* 01b7: */ {    179,   16 },
+	/* 01b8: */ {    179,   48 },
+	/* 01b9: */ {  -2926,    0 },
 	/* 01ba: */ {      0,  -64 },
-	/* 01bb: */ {      0,  -64 },
-	/* 01bc: */ {      0,  -64 },
-	/* 01bd: */ {      0,  -64 },
-	/* 01be: */ {      0,  -64 },
-	/* 01bf: */ {      0,  -64 },
+	/* 01bb: */ {  32512,  127 },
+	/* 01bc: */ {    -54,  126 },
+	/* 01bd: */ {  -9770,   64 },
+	/* 01be: */ {   -760,   16 },
+	/* 01bf: */ {   -146,    0 },
 	/* 01c0: */ {      0,  -64 },
-	/* 01c1: */ {      0,  -64 },
-	/* 01c2: */ {      0,  -64 },
-	/* 01c3: */ {      0,  -64 },
-	/* 01c4: */ {      0,  -64 },
-	/* 01c5: */ {      0,  -64 },
+	/* 01c1: */ {  -5852,   96 },
+	/* 01c2: */ {  -3232,   48 },
+	/* 01c3: */ {  -1098,   24 },
+	/* 01c4: */ {   -494,    8 },
+	/* 01c5: */ {    -82,    0 },
 	/* 01c6: */ {      0,  -64 },
-	/* 01c7: */ {      0,  -64 },
-	/* 01c8: */ {      0,  -64 },
-	/* 01c9: */ {      0,  -64 },
-	/* 01ca: */ {      0,  -64 },
-	/* 01cb: */ {      0,  -64 },
+	/* 01c7: */ {  32512,   96 },
+	/* 01c8: */ {  -3232,   32 },
+	/* 01c9: */ {  -1334,   16 },
+	/* 01ca: */ {   -852,    8 },
+	/* 01cb: */ {   -238,    0 },
 	/* 01cc: */ {      0,  -64 },
-	/* 01cd: */ {      0,  -64 },
-	/* 01ce: */ {      0,  -64 },
-	/* 01cf: */ {      0,  -64 },
-	/* 01d0: */ {      0,  -64 },
-	/* 01d1: */ {      0,  -64 },
+	/* 01cd: */ {   7331,   68 },
+	/* 01ce: */ {  -7331,   16 },
+	/* 01cf: */ {   2926,   32 },
+	/* 01d0: */ {  -1822,   10 },
+	/* 01d1: */ {   -179,    0 },
 	/* 01d2: */ {      0,  -64 },
-	/* 01d3: */ {      0,  -64 },
-	/* 01d4: */ {      0,  -64 },
-	/* 01d5: */ {      0,  -64 },
-	/* 01d6: */ {      0,  -64 },
-	/* 01d7: */ {      0,  -64 },
+	/* 01d3: */ {   4885,   64 },
+	/* 01d4: */ {  -3661,   16 },
+	/* 01d5: */ {   4885,   32 },
+	/* 01d6: */ {  -1204,   12 },
+	/* 01d7: */ {   -328,    0 },
 	/* 01d8: */ {      0,  -64 },
-	/* 01d9: */ {      0,  -64 },
-	/* 01da: */ {      0,  -64 },
-	/* 01db: */ {      0,  -64 },
-	/* 01dc: */ {      0,  -64 },
-	/* 01dd: */ {      0,  -64 },
+	/* 01d9: */ {    160,  100 },
+	/* 01da: */ {  -1452,   48 },
+	/* 01db: */ {   -426,   16 },
+	/* 01dc: */ {   -142,    8 },
+	/* 01dd: */ {    -18,    0 },
 	/* 01de: */ {      0,  -64 },
-	/* 01df: */ {      0,  -64 },
-	/* 01e0: */ {      0,  -64 },
-	/* 01e1: */ {      0,  -64 },
-	/* 01e2: */ {      0,  -64 },
-	/* 01e3: */ {      0,  -64 },
+	/* 01df: */ {    148,   96 },
+	/* 01e0: */ {  -2436,   48 },
+	/* 01e1: */ {  -1204,   16 },
+	/* 01e2: */ {   -462,    8 },
+	/* 01e3: */ {    -98,    0 },
 	/* 01e4: */ {      0,  -64 },
-	/* 01e5: */ {      0,  -64 },
-	/* 01e6: */ {      0,  -64 },
+	/* 01e5: */ {  32512,   63 },
+	/* 01e6: */ {  32512,   65 },
 	/* 01e7: */ {      0,  -64 },
-	/* 01e8: */ {      0,  -64 },
-	/* 01e9: */ {      0,  -64 },
+	/* 01e8: */ {  -7331,   67 },
+	/* 01e9: */ {  -7331,   61 },
 	/* 01ea: */ {      0,  -64 },
-	/* 01eb: */ {      0,  -64 },
-	/* 01ec: */ {      0,  -64 },
+	/* 01eb: */ {    340,   64 },
+	/* 01ec: */ {   -294,   48 },
 	/* 01ed: */ {      0,  -64 },
-	/* 01ee: */ {      0,  -64 },
-	/* 01ef: */ {      0,  -64 },
+	/* 01ee: */ {    525,   16 },
+	/* 01ef: */ {   -256,   15 },
 	/* 01f0: */ {      0,  -64 },
-	/* 01f1: */ {      0,  -64 },
-	/* 01f2: */ {      0,  -64 },
+	/* 01f1: */ {   2926,   65 },
+	/* 01f2: */ {   -125,   63 },
 	/* 01f3: */ {      0,  -64 },
-	/* 01f4: */ {      0,  -64 },
-	/* 01f5: */ {      0,  -64 },
+	/* 01f4: */ {    634,  127 },
+	/* 01f5: */ {   -634,    0 },
 	/* 01f6: */ {      0,  -64 },
-	/* 01f7: */ {      0,  -64 },
-	/* 01f8: */ {      0,  -64 },
+	/* 01f7: */ {    703,   20 },
+	/* 01f8: */ {   -703,    0 },
 	/* 01f9: */ {      0,  -64 },
-	/* 01fa: */ {      0,  -64 },
-	/* 01fb: */ {      0,  -64 },
+	/* 01fa: */ {    305,  127 },
+	/* 01fb: */ {   -247,   96 },
 	/* 01fc: */ {      0,  -64 },
-	/* 01fd: */ {      0,  -64 },
-	/* 01fe: */ {      0,  -64 },
+	/* 01fd: */ {     31,    2 },
+	/* 01fe: */ {    -36,    0 },
 	/* 01ff: */ {      0,  -64 },
-	/* 0200: */ {      0,  -64 },
-	/* 0201: */ {      0,  -64 },
+	/* 0200: */ {  32512,   67 },
+	/* 0201: */ { -32512,   61 },
 	/* 0202: */ {      0,  -64 },
-	/* 0203: */ {      0,  -64 },
-	/* 0204: */ {      0,  -64 },
+	/* 0203: */ {  32512,   66 },
+	/* 0204: */ { -32512,   62 },
 	/* 0205: */ {      0,  -64 },
-	/* 0206: */ {      0,  -64 },
-	/* 0207: */ {      0,  -64 },
+	/* 0206: */ {  32512,   65 },
+	/* 0207: */ { -32512,   63 },
 	/* 0208: */ {      0,  -64 },
-	/* 0209: */ {      0,  -64 },
-	/* 020a: */ {      0,  -64 },
+	/* 0209: */ {  32512,    0 },
+	/* 020a: */ { -32512,    0 },
 	/* 020b: */ {      0,  -64 },
-	/* 020c: */ {      0,  -64 },
-	/* 020d: */ {      0,  -64 },
-	/* 020e: */ {      0,  -64 },
-	/* 020f: */ {      0,  -64 },
+	/* 020c: */ {     54,   32 },
+	/* 020d: */ {      0,    0 },
+	/* 020e: */ {  32512,   66 },
+	/* 020f: */ { -32512,   62 },
 	/* 0210: */ {      0,  -64 },
-	/* 0211: */ {      0,  -64 },
+	/* 0211: */ {  32512,   64 },
 	/* 0212: */ {      0,  -64 },
-	/* 0213: */ {      0,  -64 },
-	/* 0214: */ {      0,  -64 },
+	/* 0213: */ {    340,   64 },
+	/* 0214: */ {   -294,   48 },
 	/* 0215: */ {      0,  -64 },
-	/* 0216: */ {      0,  -64 },
+	/* 0216: */ {   7331,   64 },
 	/* 0217: */ {      0,  -64 },
-	/* 0218: */ {      0,  -64 },
-	/* 0219: */ {      0,  -64 },
-	/* 021a: */ {      0,  -64 },
+	/* 0218: */ {  29332,   72 },
+	/* 0219: */ {  -1098,   63 },
+	/* 021a: */ {  32512,   65 },
 	/* 021b: */ {      0,  -64 },
-	/* 021c: */ {      0,  -64 },
+	/* 021c: */ {  14662,   34 },
 	/* 021d: */ {      0,  -64 },
-	/* 021e: */ {      0,  -64 },
+	/* 021e: */ {   9770,   64 },
 	/* 021f: */ {      0,  -64 },
-	/* 0220: */ {      0,  -64 },
+	/* 0220: */ {   2436,   64 },
 	/* 0221: */ {      0,  -64 },
-	/* 0222: */ {      0,  -64 },
-	/* 0223: */ {      0,  -64 },
-	/* 0224: */ {      0,  -64 },
-	/* 0225: */ {      0,  -64 },
-	/* 0226: */ {      0,  -64 },
-	/* 0227: */ {      0,  -64 },
-	/* 0228: */ {      0,  -64 },
-	/* 0229: */ {      0,  -64 },
-	/* 022a: */ {      0,  -64 },
-	/* 022b: */ {      0,  -64 },
-	/* 022c: */ {      0,  -64 },
-	/* 022d: */ {      0,  -64 },
-	/* 022e: */ {      0,  -64 },
-	/* 022f: */ {      0,  -64 },
-	/* 0230: */ {      0,  -64 },
-	/* 0231: */ {      0,  -64 },
-	/* 0232: */ {      0,  -64 },
-	/* 0233: */ {      0,  -64 },
-	/* 0234: */ {      0,  -64 },
-	/* 0235: */ {      0,  -64 },
-	/* 0236: */ {      0,  -64 },
-	/* 0237: */ {      0,  -64 },
-	/* 0238: */ {      0,  -64 },
-	/* 0239: */ {      0,  -64 },
-	/* 023a: */ {      0,  -64 },
-	/* 023b: */ {      0,  -64 },
-	/* 023c: */ {      0,  -64 },
-	/* 023d: */ {      0,  -64 },
-	/* 023e: */ {      0,  -64 },
-	/* 023f: */ {      0,  -64 },
-	/* 0240: */ {      0,  -64 },
-	/* 0241: */ {      0,  -64 },
-	/* 0242: */ {      0,  -64 },
-	/* 0243: */ {      0,  -64 },
-	/* 0244: */ {      0,  -64 },
-	/* 0245: */ {      0,  -64 },
-	/* 0246: */ {      0,  -64 },
-	/* 0247: */ {      0,  -64 },
-	/* 0248: */ {      0,  -64 },
-	/* 0249: */ {      0,  -64 },
-	/* 024a: */ {      0,  -64 },
-	/* 024b: */ {      0,  -64 },
-	/* 024c: */ {      0,  -64 },
-	/* 024d: */ {      0,  -64 },
-	/* 024e: */ {      0,  -64 },
-	/* 024f: */ {      0,  -64 },
-	/* 0250: */ {      0,  -64 },
-	/* 0251: */ {      0,  -64 },
-	/* 0252: */ {      0,  -64 },
-	/* 0253: */ {      0,  -64 },
-	/* 0254: */ {      0,  -64 },
-	/* 0255: */ {      0,  -64 },
-	/* 0256: */ {      0,  -64 },
-	/* 0257: */ {      0,  -64 },
-	/* 0258: */ {      0,  -64 },
-	/* 0259: */ {      0,  -64 },
-	/* 025a: */ {      0,  -64 },
-	/* 025b: */ {      0,  -64 },
-	/* 025c: */ {      0,  -64 },
-	/* 025d: */ {      0,  -64 },
-	/* 025e: */ {      0,  -64 },
-	/* 025f: */ {      0,  -64 },
-	/* 0260: */ {      0,  -64 },
-	/* 0261: */ {      0,  -64 },
-	/* 0262: */ {      0,  -64 },
-	/* 0263: */ {      0,  -64 },
-	/* 0264: */ {      0,  -64 },
-	/* 0265: */ {      0,  -64 },
-	/* 0266: */ {      0,  -64 },
-	/* 0267: */ {      0,  -64 },
-	/* 0268: */ {      0,  -64 },
-	/* 0269: */ {      0,  -64 },
-	/* 026a: */ {      0,  -64 },
-	/* 026b: */ {      0,  -64 },
-	/* 026c: */ {      0,  -64 },
-	/* 026d: */ {      0,  -64 },
-	/* 026e: */ {      0,  -64 },
-	/* 026f: */ {      0,  -64 },
-	/* 0270: */ {      0,  -64 },
-	/* 0271: */ {      0,  -64 },
-	/* 0272: */ {      0,  -64 },
-	/* 0273: */ {      0,  -64 },
-	/* 0274: */ {      0,  -64 },
-	/* 0275: */ {      0,  -64 },
-	/* 0276: */ {      0,  -64 },
-	/* 0277: */ {      0,  -64 },
-	/* 0278: */ {      0,  -64 },
-	/* 0279: */ {      0,  -64 },
-	/* 027a: */ {      0,  -64 },
-	/* 027b: */ {      0,  -64 },
-	/* 027c: */ {      0,  -64 },
-	/* 027d: */ {      0,  -64 },
-	/* 027e: */ {      0,  -64 },
-	/* 027f: */ {      0,  -64 },
-	/* 0280: */ {      0,  -64 },
-	/* 0281: */ {      0,  -64 },
-	/* 0282: */ {      0,  -64 },
-	/* 0283: */ {      0,  -64 },
-	/* 0284: */ {      0,  -64 },
-	/* 0285: */ {      0,  -64 },
-	/* 0286: */ {      0,  -64 },
-	/* 0287: */ {      0,  -64 },
-	/* 0288: */ {      0,  -64 },
-	/* 0289: */ {      0,  -64 },
-	/* 028a: */ {      0,  -64 },
-	/* 028b: */ {      0,  -64 },
-	/* 028c: */ {      0,  -64 },
-	/* 028d: */ {      0,  -64 },
-	/* 028e: */ {      0,  -64 },
-	/* 028f: */ {      0,  -64 },
-	/* 0290: */ {      0,  -64 },
-	/* 0291: */ {      0,  -64 },
-	/* 0292: */ {      0,  -64 },
-	/* 0293: */ {      0,  -64 },
-	/* 0294: */ {      0,  -64 },
-	/* 0295: */ {      0,  -64 },
-	/* 0296: */ {      0,  -64 },
-	/* 0297: */ {      0,  -64 },
-	/* 0298: */ {      0,  -64 },
-	/* 0299: */ {      0,  -64 },
-	/* 029a: */ {      0,  -64 },
-	/* 029b: */ {      0,  -64 },
-	/* 029c: */ {      0,  -64 },
-	/* 029d: */ {      0,  -64 },
-	/* 029e: */ {      0,  -64 },
-	/* 029f: */ {      0,  -64 },
-	/* 02a0: */ {      0,  -64 },
-	/* 02a1: */ {      0,  -64 },
-	/* 02a2: */ {      0,  -64 },
-	/* 02a3: */ {      0,  -64 },
-	/* 02a4: */ {      0,  -64 },
-	/* 02a5: */ {      0,  -64 },
-	/* 02a6: */ {      0,  -64 },
-	/* 02a7: */ {      0,  -64 },
-	/* 02a8: */ {      0,  -64 },
-	/* 02a9: */ {      0,  -64 },
-	/* 02aa: */ {      0,  -64 },
-	/* 02ab: */ {      0,  -64 },
-	/* 02ac: */ {      0,  -64 },
-	/* 02ad: */ {      0,  -64 },
-	/* 02ae: */ {      0,  -64 },
-	/* 02af: */ {      0,  -64 },
-	/* 02b0: */ {      0,  -64 },
-	/* 02b1: */ {      0,  -64 },
-	/* 02b2: */ {      0,  -64 },
-	/* 02b3: */ {      0,  -64 },
-	/* 02b4: */ {      0,  -64 },
-	/* 02b5: */ {      0,  -64 },
-	/* 02b6: */ {      0,  -64 },
-	/* 02b7: */ {      0,  -64 },
-	/* 02b8: */ {      0,  -64 },
-	/* 02b9: */ {      0,  -64 },
-	/* 02ba: */ {      0,  -64 },
-	/* 02bb: */ {      0,  -64 },
-	/* 02bc: */ {      0,  -64 },
-	/* 02bd: */ {      0,  -64 },
-	/* 02be: */ {      0,  -64 },
-	/* 02bf: */ {      0,  -64 },
-	/* 02c0: */ {      0,  -64 },
-	/* 02c1: */ {      0,  -64 },
-	/* 02c2: */ {      0,  -64 },
-	/* 02c3: */ {      0,  -64 },
-	/* 02c4: */ {      0,  -64 },
-	/* 02c5: */ {      0,  -64 },
-	/* 02c6: */ {      0,  -64 },
-	/* 02c7: */ {      0,  -64 },
-	/* 02c8: */ {      0,  -64 },
-	/* 02c9: */ {      0,  -64 },
-	/* 02ca: */ {      0,  -64 },
-	/* 02cb: */ {      0,  -64 },
-	/* 02cc: */ {      0,  -64 },
-	/* 02cd: */ {      0,  -64 },
-	/* 02ce: */ {      0,  -64 },
-	/* 02cf: */ {      0,  -64 },
-	/* 02d0: */ {      0,  -64 },
-	/* 02d1: */ {      0,  -64 },
-	/* 02d2: */ {      0,  -64 },
-	/* 02d3: */ {      0,  -64 },
-	/* 02d4: */ {      0,  -64 },
-	/* 02d5: */ {      0,  -64 },
-	/* 02d6: */ {      0,  -64 },
-	/* 02d7: */ {      0,  -64 },
-	/* 02d8: */ {      0,  -64 },
-	/* 02d9: */ {      0,  -64 },
-	/* 02da: */ {      0,  -64 },
-	/* 02db: */ {      0,  -64 },
-	/* 02dc: */ {      0,  -64 },
-	/* 02dd: */ {      0,  -64 },
-	/* 02de: */ {      0,  -64 },
-	/* 02df: */ {      0,  -64 },
-	/* 02e0: */ {      0,  -64 },
-	/* 02e1: */ {      0,  -64 },
-	/* 02e2: */ {      0,  -64 },
-	/* 02e3: */ {      0,  -64 },
-	/* 02e4: */ {      0,  -64 },
-	/* 02e5: */ {      0,  -64 },
-	/* 02e6: */ {      0,  -64 },
-	/* 02e7: */ {      0,  -64 },
-	/* 02e8: */ {      0,  -64 },
-	/* 02e9: */ {      0,  -64 },
-	/* 02ea: */ {      0,  -64 },
-	/* 02eb: */ {      0,  -64 },
-	/* 02ec: */ {      0,  -64 },
-	/* 02ed: */ {      0,  -64 },
-	/* 02ee: */ {      0,  -64 },
-	/* 02ef: */ {      0,  -64 },
-	/* 02f0: */ {      0,  -64 },
-	/* 02f1: */ {      0,  -64 },
-	/* 02f2: */ {      0,  -64 },
-	/* 02f3: */ {      0,  -64 },
-	/* 02f4: */ {      0,  -64 },
-	/* 02f5: */ {      0,  -64 },
-	/* 02f6: */ {      0,  -64 },
-	/* 02f7: */ {      0,  -64 },
-	/* 02f8: */ {      0,  -64 },
-	/* 02f9: */ {      0,  -64 },
-	/* 02fa: */ {      0,  -64 },
-	/* 02fb: */ {      0,  -64 },
-	/* 02fc: */ {      0,  -64 },
-	/* 02fd: */ {      0,  -64 },
-	/* 02fe: */ {      0,  -64 },
-	/* 02ff: */ {      0,  -64 },
-	/* 0300: */ {      0,  -64 },
-	/* 0301: */ {      0,  -64 },
-	/* 0302: */ {      0,  -64 },
-	/* 0303: */ {      0,  -64 },
-	/* 0304: */ {      0,  -64 },
-	/* 0305: */ {      0,  -64 },
-	/* 0306: */ {      0,  -64 },
-	/* 0307: */ {      0,  -64 },
-	/* 0308: */ {      0,  -64 },
-	/* 0309: */ {      0,  -64 },
-	/* 030a: */ {      0,  -64 },
-	/* 030b: */ {      0,  -64 },
-	/* 030c: */ {      0,  -64 },
-	/* 030d: */ {      0,  -64 },
-	/* 030e: */ {      0,  -64 },
-	/* 030f: */ {      0,  -64 },
-	/* 0310: */ {      0,  -64 },
-	/* 0311: */ {      0,  -64 },
-	/* 0312: */ {      0,  -64 },
-	/* 0313: */ {      0,  -64 },
-	/* 0314: */ {      0,  -64 },
-	/* 0315: */ {      0,  -64 },
-	/* 0316: */ {      0,  -64 },
-	/* 0317: */ {      0,  -64 },
-	/* 0318: */ {      0,  -64 },
-	/* 0319: */ {      0,  -64 },
-	/* 031a: */ {      0,  -64 },
-	/* 031b: */ {      0,  -64 },
-	/* 031c: */ {      0,  -64 },
-	/* 031d: */ {      0,  -64 },
-	/* 031e: */ {      0,  -64 },
-	/* 031f: */ {      0,  -64 },
-	/* 0320: */ {      0,  -64 },
-	/* 0321: */ {      0,  -64 },
-	/* 0322: */ {      0,  -64 },
-	/* 0323: */ {      0,  -64 },
-	/* 0324: */ {      0,  -64 },
-	/* 0325: */ {      0,  -64 },
-	/* 0326: */ {      0,  -64 },
-	/* 0327: */ {      0,  -64 },
-	/* 0328: */ {      0,  -64 },
-	/* 0329: */ {      0,  -64 },
-	/* 032a: */ {      0,  -64 },
-	/* 032b: */ {      0,  -64 },
-	/* 032c: */ {      0,  -64 },
-	/* 032d: */ {      0,  -64 },
-	/* 032e: */ {      0,  -64 },
-	/* 032f: */ {      0,  -64 },
-	/* 0330: */ {      0,  -64 },
-	/* 0331: */ {      0,  -64 },
-	/* 0332: */ {      0,  -64 },
-	/* 0333: */ {      0,  -64 },
-	/* 0334: */ {      0,  -64 },
-	/* 0335: */ {      0,  -64 },
-	/* 0336: */ {      0,  -64 },
-	/* 0337: */ {      0,  -64 },
-	/* 0338: */ {      0,  -64 },
-	/* 0339: */ {      0,  -64 },
-	/* 033a: */ {      0,  -64 },
-	/* 033b: */ {      0,  -64 },
-	/* 033c: */ {      0,  -64 },
-	/* 033d: */ {      0,  -64 },
-	/* 033e: */ {      0,  -64 },
-	/* 033f: */ {      0,  -64 },
-	/* 0340: */ {      0,  -64 },
-	/* 0341: */ {      0,  -64 },
-	/* 0342: */ {      0,  -64 },
-	/* 0343: */ {      0,  -64 },
-	/* 0344: */ {      0,  -64 },
-	/* 0345: */ {      0,  -64 },
-	/* 0346: */ {      0,  -64 },
-	/* 0347: */ {      0,  -64 },
-	/* 0348: */ {      0,  -64 },
-	/* 0349: */ {      0,  -64 },
-	/* 034a: */ {      0,  -64 },
-	/* 034b: */ {      0,  -64 },
-	/* 034c: */ {      0,  -64 },
-	/* 034d: */ {      0,  -64 },
-	/* 034e: */ {      0,  -64 },
-	/* 034f: */ {      0,  -64 },
-	/* 0350: */ {      0,  -64 },
-	/* 0351: */ {      0,  -64 },
-	/* 0352: */ {      0,  -64 },
-	/* 0353: */ {      0,  -64 },
-	/* 0354: */ {      0,  -64 },
-	/* 0355: */ {      0,  -64 },
-	/* 0356: */ {      0,  -64 },
-	/* 0357: */ {      0,  -64 },
-	/* 0358: */ {      0,  -64 },
-	/* 0359: */ {      0,  -64 },
-	/* 035a: */ {      0,  -64 },
-	/* 035b: */ {      0,  -64 },
-	/* 035c: */ {      0,  -64 },
-	/* 035d: */ {      0,  -64 },
-	/* 035e: */ {      0,  -64 },
-	/* 035f: */ {      0,  -64 },
-	/* 0360: */ {      0,  -64 },
-	/* 0361: */ {      0,  -64 },
-	/* 0362: */ {      0,  -64 },
-	/* 0363: */ {      0,  -64 },
-	/* 0364: */ {      0,  -64 },
-	/* 0365: */ {      0,  -64 },
-	/* 0366: */ {      0,  -64 },
-	/* 0367: */ {      0,  -64 },
-	/* 0368: */ {      0,  -64 },
-	/* 0369: */ {      0,  -64 },
-	/* 036a: */ {      0,  -64 },
-	/* 036b: */ {      0,  -64 },
-	/* 036c: */ {      0,  -64 },
-	/* 036d: */ {      0,  -64 },
-	/* 036e: */ {      0,  -64 },
-	/* 036f: */ {      0,  -64 },
-	/* 0370: */ {      0,  -64 },
-	/* 0371: */ {      0,  -64 },
-	/* 0372: */ {      0,  -64 },
-	/* 0373: */ {      0,  -64 },
-	/* 0374: */ {      0,  -64 },
-	/* 0375: */ {      0,  -64 },
-	/* 0376: */ {      0,  -64 },
-	/* 0377: */ {      0,  -64 },
-	/* 0378: */ {      0,  -64 },
-	/* 0379: */ {      0,  -64 },
-	/* 037a: */ {      0,  -64 },
-	/* 037b: */ {      0,  -64 },
-	/* 037c: */ {      0,  -64 },
-	/* 037d: */ {      0,  -64 },
-	/* 037e: */ {      0,  -64 },
-	/* 037f: */ {      0,  -64 },
-	/* 0380: */ {      0,  -64 },
-	/* 0381: */ {      0,  -64 },
-	/* 0382: */ {      0,  -64 },
-	/* 0383: */ {      0,  -64 },
-	/* 0384: */ {      0,  -64 },
-	/* 0385: */ {      0,  -64 },
-	/* 0386: */ {      0,  -64 },
-	/* 0387: */ {      0,  -64 },
-	/* 0388: */ {      0,  -64 },
-	/* 0389: */ {      0,  -64 },
-	/* 038a: */ {      0,  -64 },
-	/* 038b: */ {      0,  -64 },
-	/* 038c: */ {      0,  -64 },
-	/* 038d: */ {      0,  -64 },
-	/* 038e: */ {      0,  -64 },
-	/* 038f: */ {      0,  -64 },
-	/* 0390: */ {      0,  -64 },
-	/* 0391: */ {      0,  -64 },
-	/* 0392: */ {      0,  -64 },
-	/* 0393: */ {      0,  -64 },
-	/* 0394: */ {      0,  -64 },
-	/* 0395: */ {      0,  -64 },
-	/* 0396: */ {      0,  -64 },
-	/* 0397: */ {      0,  -64 },
-	/* 0398: */ {      0,  -64 },
-	/* 0399: */ {      0,  -64 },
-	/* 039a: */ {      0,  -64 },
-	/* 039b: */ {      0,  -64 },
-	/* 039c: */ {      0,  -64 },
-	/* 039d: */ {      0,  -64 },
-	/* 039e: */ {      0,  -64 },
-	/* 039f: */ {      0,  -64 },
-	/* 03a0: */ {      0,  -64 },
-	/* 03a1: */ {      0,  -64 },
-	/* 03a2: */ {      0,  -64 },
-	/* 03a3: */ {      0,  -64 },
-	/* 03a4: */ {      0,  -64 },
-	/* 03a5: */ {      0,  -64 },
-	/* 03a6: */ {      0,  -64 },
-	/* 03a7: */ {      0,  -64 },
-	/* 03a8: */ {      0,  -64 },
-	/* 03a9: */ {      0,  -64 },
-	/* 03aa: */ {      0,  -64 },
-	/* 03ab: */ {      0,  -64 },
-	/* 03ac: */ {      0,  -64 },
-	/* 03ad: */ {      0,  -64 },
-	/* 03ae: */ {      0,  -64 },
-	/* 03af: */ {      0,  -64 },
-	/* 03b0: */ {      0,  -64 },
-	/* 03b1: */ {      0,  -64 },
-	/* 03b2: */ {      0,  -64 },
-	/* 03b3: */ {      0,  -64 },
-	/* 03b4: */ {      0,  -64 },
-	/* 03b5: */ {      0,  -64 },
-	/* 03b6: */ {      0,  -64 },
-	/* 03b7: */ {      0,  -64 },
-	/* 03b8: */ {      0,  -64 },
-	/* 03b9: */ {      0,  -64 },
-	/* 03ba: */ {      0,  -64 },
-	/* 03bb: */ {      0,  -64 },
-	/* 03bc: */ {      0,  -64 },
-	/* 03bd: */ {      0,  -64 },
-	/* 03be: */ {      0,  -64 },
-	/* 03bf: */ {      0,  -64 },
-	/* 03c0: */ {      0,  -64 },
-	/* 03c1: */ {      0,  -64 },
-	/* 03c2: */ {      0,  -64 },
-	/* 03c3: */ {      0,  -64 },
-	/* 03c4: */ {      0,  -64 },
-	/* 03c5: */ {      0,  -64 },
-	/* 03c6: */ {      0,  -64 },
-	/* 03c7: */ {      0,  -64 },
-	/* 03c8: */ {      0,  -64 },
-	/* 03c9: */ {      0,  -64 },
-	/* 03ca: */ {      0,  -64 },
-	/* 03cb: */ {      0,  -64 },
-	/* 03cc: */ {      0,  -64 },
-	/* 03cd: */ {      0,  -64 },
-	/* 03ce: */ {      0,  -64 },
-	/* 03cf: */ {      0,  -64 },
-	/* 03d0: */ {      0,  -64 },
-	/* 03d1: */ {      0,  -64 },
-	/* 03d2: */ {      0,  -64 },
-	/* 03d3: */ {      0,  -64 },
-	/* 03d4: */ {      0,  -64 },
-	/* 03d5: */ {      0,  -64 },
-	/* 03d6: */ {      0,  -64 },
-	/* 03d7: */ {      0,  -64 },
-	/* 03d8: */ {      0,  -64 },
-	/* 03d9: */ {      0,  -64 },
-	/* 03da: */ {      0,  -64 },
-	/* 03db: */ {      0,  -64 },
-	/* 03dc: */ {      0,  -64 },
-	/* 03dd: */ {      0,  -64 },
-	/* 03de: */ {      0,  -64 },
-	/* 03df: */ {      0,  -64 },
-	/* 03e0: */ {      0,  -64 },
-	/* 03e1: */ {      0,  -64 },
-	/* 03e2: */ {      0,  -64 },
-	/* 03e3: */ {      0,  -64 },
-	/* 03e4: */ {      0,  -64 },
-	/* 03e5: */ {      0,  -64 },
-	/* 03e6: */ {      0,  -64 },
-	/* 03e7: */ {      0,  -64 },
-	/* 03e8: */ {      0,  -64 },
-	/* 03e9: */ {      0,  -64 },
-	/* 03ea: */ {      0,  -64 },
-	/* 03eb: */ {      0,  -64 },
-	/* 03ec: */ {      0,  -64 },
-	/* 03ed: */ {      0,  -64 },
-	/* 03ee: */ {      0,  -64 },
-	/* 03ef: */ {      0,  -64 },
-	/* 03f0: */ {      0,  -64 },
-	/* 03f1: */ {      0,  -64 },
-	/* 03f2: */ {      0,  -64 },
-	/* 03f3: */ {      0,  -64 },
-	/* 03f4: */ {      0,  -64 },
-	/* 03f5: */ {      0,  -64 },
-	/* 03f6: */ {      0,  -64 },
-	/* 03f7: */ {      0,  -64 },
-	/* 03f8: */ {      0,  -64 },
-	/* 03f9: */ {      0,  -64 },
-	/* 03fa: */ {      0,  -64 },
-	/* 03fb: */ {      0,  -64 },
-	/* 03fc: */ {      0,  -64 },
-	/* 03fd: */ {      0,  -64 },
-	/* 03fe: */ {      0,  -64 },
-	/* 03ff: */ {      0,  -64 },
-	/* 0400: */ {      0,  -64 },
-	/* 0401: */ {      0,  -64 },
-	/* 0402: */ {      0,  -64 },
-	/* 0403: */ {      0,  -64 },
-	/* 0404: */ {      0,  -64 },
-	/* 0405: */ {      0,  -64 },
-	/* 0406: */ {      0,  -64 },
-	/* 0407: */ {      0,  -64 },
-	/* 0408: */ {      0,  -64 },
-	/* 0409: */ {      0,  -64 },
-	/* 040a: */ {      0,  -64 },
-	/* 040b: */ {      0,  -64 },
-	/* 040c: */ {      0,  -64 },
-	/* 040d: */ {      0,  -64 },
-	/* 040e: */ {      0,  -64 },
-	/* 040f: */ {      0,  -64 },
-	/* 0410: */ {      0,  -64 },
-	/* 0411: */ {      0,  -64 },
-	/* 0412: */ {      0,  -64 },
-	/* 0413: */ {      0,  -64 },
-	/* 0414: */ {      0,  -64 },
-	/* 0415: */ {      0,  -64 },
-	/* 0416: */ {      0,  -64 },
-	/* 0417: */ {      0,  -64 },
-	/* 0418: */ {      0,  -64 },
-	/* 0419: */ {      0,  -64 },
-	/* 041a: */ {      0,  -64 },
-	/* 041b: */ {      0,  -64 },
-	/* 041c: */ {      0,  -64 },
-	/* 041d: */ {      0,  -64 },
-	/* 041e: */ {      0,  -64 },
-	/* 041f: */ {      0,  -64 },
-	/* 0420: */ {      0,  -64 },
-	/* 0421: */ {      0,  -64 },
-	/* 0422: */ {      0,  -64 },
-	/* 0423: */ {      0,  -64 },
-	/* 0424: */ {      0,  -64 },
-	/* 0425: */ {      0,  -64 },
-	/* 0426: */ {      0,  -64 },
-	/* 0427: */ {      0,  -64 },
-	/* 0428: */ {      0,  -64 },
-	/* 0429: */ {      0,  -64 },
-	/* 042a: */ {      0,  -64 },
-	/* 042b: */ {      0,  -64 },
-	/* 042c: */ {      0,  -64 },
-	/* 042d: */ {      0,  -64 },
-	/* 042e: */ {      0,  -64 },
-	/* 042f: */ {      0,  -64 },
-	/* 0430: */ {      0,  -64 },
-	/* 0431: */ {      0,  -64 },
-	/* 0432: */ {      0,  -64 },
-	/* 0433: */ {      0,  -64 },
-	/* 0434: */ {      0,  -64 },
-	/* 0435: */ {      0,  -64 },
-	/* 0436: */ {      0,  -64 },
-	/* 0437: */ {      0,  -64 },
-	/* 0438: */ {      0,  -64 },
-	/* 0439: */ {      0,  -64 },
-	/* 043a: */ {      0,  -64 },
-	/* 043b: */ {      0,  -64 },
-	/* 043c: */ {      0,  -64 },
-	/* 043d: */ {      0,  -64 },
-	/* 043e: */ {      0,  -64 },
-	/* 043f: */ {      0,  -64 },
-	/* 0440: */ {      0,  -64 },
-	/* 0441: */ {      0,  -64 },
-	/* 0442: */ {      0,  -64 },
-	/* 0443: */ {      0,  -64 },
-	/* 0444: */ {      0,  -64 },
-	/* 0445: */ {      0,  -64 },
-	/* 0446: */ {      0,  -64 },
-	/* 0447: */ {      0,  -64 },
-	/* 0448: */ {      0,  -64 },
-	/* 0449: */ {      0,  -64 },
-	/* 044a: */ {      0,  -64 },
-	/* 044b: */ {      0,  -64 },
-	/* 044c: */ {      0,  -64 },
-	/* 044d: */ {      0,  -64 },
-	/* 044e: */ {      0,  -64 },
-	/* 044f: */ {      0,  -64 },
-	/* 0450: */ {      0,  -64 },
-	/* 0451: */ {      0,  -64 },
-	/* 0452: */ {      0,  -64 },
-	/* 0453: */ {      0,  -64 },
-	/* 0454: */ {      0,  -64 },
-	/* 0455: */ {      0,  -64 },
-	/* 0456: */ {      0,  -64 },
-	/* 0457: */ {      0,  -64 },
-	/* 0458: */ {      0,  -64 },
-	/* 0459: */ {      0,  -64 },
-	/* 045a: */ {      0,  -64 },
-	/* 045b: */ {      0,  -64 },
-	/* 045c: */ {      0,  -64 },
-	/* 045d: */ {      0,  -64 },
-	/* 045e: */ {      0,  -64 },
-	/* 045f: */ {      0,  -64 },
-	/* 0460: */ {      0,  -64 },
-	/* 0461: */ {      0,  -64 },
-	/* 0462: */ {      0,  -64 },
-	/* 0463: */ {      0,  -64 },
-	/* 0464: */ {      0,  -64 },
-	/* 0465: */ {      0,  -64 },
-	/* 0466: */ {      0,  -64 },
-	/* 0467: */ {      0,  -64 },
-	/* 0468: */ {      0,  -64 },
-	/* 0469: */ {      0,  -64 },
-	/* 046a: */ {      0,  -64 },
-	/* 046b: */ {      0,  -64 },
-	/* 046c: */ {      0,  -64 },
-	/* 046d: */ {      0,  -64 },
-	/* 046e: */ {      0,  -64 },
-	/* 046f: */ {      0,  -64 },
-	/* 0470: */ {      0,  -64 },
-	/* 0471: */ {      0,  -64 },
-	/* 0472: */ {      0,  -64 },
-	/* 0473: */ {      0,  -64 },
-	/* 0474: */ {      0,  -64 },
-	/* 0475: */ {      0,  -64 },
-	/* 0476: */ {      0,  -64 },
-	/* 0477: */ {      0,  -64 },
-	/* 0478: */ {      0,  -64 },
-	/* 0479: */ {      0,  -64 },
-	/* 047a: */ {      0,  -64 },
-	/* 047b: */ {      0,  -64 },
-	/* 047c: */ {      0,  -64 },
-	/* 047d: */ {      0,  -64 },
-	/* 047e: */ {      0,  -64 },
-	/* 047f: */ {      0,  -64 },
-	/* 0480: */ {      0,  -64 },
-	/* 0481: */ {      0,  -64 },
-	/* 0482: */ {      0,  -64 },
-	/* 0483: */ {      0,  -64 },
-	/* 0484: */ {      0,  -64 },
-	/* 0485: */ {      0,  -64 },
-	/* 0486: */ {      0,  -64 },
-	/* 0487: */ {      0,  -64 },
-	/* 0488: */ {      0,  -64 },
-	/* 0489: */ {      0,  -64 },
-	/* 048a: */ {      0,  -64 },
-	/* 048b: */ {      0,  -64 },
-	/* 048c: */ {      0,  -64 },
-	/* 048d: */ {      0,  -64 },
-	/* 048e: */ {      0,  -64 },
-	/* 048f: */ {      0,  -64 },
-	/* 0490: */ {      0,  -64 },
-	/* 0491: */ {      0,  -64 },
-	/* 0492: */ {      0,  -64 },
-	/* 0493: */ {      0,  -64 },
-	/* 0494: */ {      0,  -64 },
-	/* 0495: */ {      0,  -64 },
-	/* 0496: */ {      0,  -64 },
-	/* 0497: */ {      0,  -64 },
-	/* 0498: */ {      0,  -64 },
-	/* 0499: */ {      0,  -64 },
-	/* 049a: */ {      0,  -64 },
-	/* 049b: */ {      0,  -64 },
-	/* 049c: */ {      0,  -64 },
-	/* 049d: */ {      0,  -64 },
-	/* 049e: */ {      0,  -64 },
-	/* 049f: */ {      0,  -64 },
-	/* 04a0: */ {      0,  -64 },
-	/* 04a1: */ {      0,  -64 },
-	/* 04a2: */ {      0,  -64 },
-	/* 04a3: */ {      0,  -64 },
-	/* 04a4: */ {      0,  -64 },
-	/* 04a5: */ {      0,  -64 },
-	/* 04a6: */ {      0,  -64 },
-	/* 04a7: */ {      0,  -64 },
-	/* 04a8: */ {      0,  -64 },
-	/* 04a9: */ {      0,  -64 },
-	/* 04aa: */ {      0,  -64 },
-	/* 04ab: */ {      0,  -64 },
-	/* 04ac: */ {      0,  -64 },
-	/* 04ad: */ {      0,  -64 },
-	/* 04ae: */ {      0,  -64 },
-	/* 04af: */ {      0,  -64 },
-	/* 04b0: */ {      0,  -64 },
-	/* 04b1: */ {      0,  -64 },
-	/* 04b2: */ {      0,  -64 },
-	/* 04b3: */ {      0,  -64 },
-	/* 04b4: */ {      0,  -64 },
-	/* 04b5: */ {      0,  -64 },
-	/* 04b6: */ {      0,  -64 },
-	/* 04b7: */ {      0,  -64 },
-	/* 04b8: */ {      0,  -64 },
-	/* 04b9: */ {      0,  -64 },
-	/* 04ba: */ {      0,  -64 },
-	/* 04bb: */ {      0,  -64 },
-	/* 04bc: */ {      0,  -64 },
-	/* 04bd: */ {      0,  -64 },
-	/* 04be: */ {      0,  -64 },
-	/* 04bf: */ {      0,  -64 },
-	/* 04c0: */ {      0,  -64 },
-	/* 04c1: */ {      0,  -64 },
-	/* 04c2: */ {      0,  -64 },
-	/* 04c3: */ {      0,  -64 },
-	/* 04c4: */ {      0,  -64 },
-	/* 04c5: */ {      0,  -64 },
-	/* 04c6: */ {      0,  -64 },
-	/* 04c7: */ {      0,  -64 },
-	/* 04c8: */ {      0,  -64 },
-	/* 04c9: */ {      0,  -64 },
-	/* 04ca: */ {      0,  -64 },
-	/* 04cb: */ {      0,  -64 },
-	/* 04cc: */ {      0,  -64 },
-	/* 04cd: */ {      0,  -64 },
-	/* 04ce: */ {      0,  -64 },
-	/* 04cf: */ {      0,  -64 },
-	/* 04d0: */ {      0,  -64 },
-	/* 04d1: */ {      0,  -64 },
-	/* 04d2: */ {      0,  -64 },
-	/* 04d3: */ {      0,  -64 },
-	/* 04d4: */ {      0,  -64 },
-	/* 04d5: */ {      0,  -64 },
-	/* 04d6: */ {      0,  -64 },
-	/* 04d7: */ {      0,  -64 },
-	/* 04d8: */ {      0,  -64 },
-	/* 04d9: */ {      0,  -64 },
-	/* 04da: */ {      0,  -64 },
-	/* 04db: */ {      0,  -64 },
-	/* 04dc: */ {      0,  -64 },
-	/* 04dd: */ {      0,  -64 },
-	/* 04de: */ {      0,  -64 },
-	/* 04df: */ {      0,  -64 },
-	/* 04e0: */ {      0,  -64 },
-	/* 04e1: */ {      0,  -64 },
-	/* 04e2: */ {      0,  -64 },
-	/* 04e3: */ {      0,  -64 },
-	/* 04e4: */ {      0,  -64 },
-	/* 04e5: */ {      0,  -64 },
-	/* 04e6: */ {      0,  -64 },
-	/* 04e7: */ {      0,  -64 },
-	/* 04e8: */ {      0,  -64 },
-	/* 04e9: */ {      0,  -64 },
-	/* 04ea: */ {      0,  -64 },
-	/* 04eb: */ {      0,  -64 },
-	/* 04ec: */ {      0,  -64 },
-	/* 04ed: */ {      0,  -64 },
-	/* 04ee: */ {      0,  -64 },
-	/* 04ef: */ {      0,  -64 },
-	/* 04f0: */ {      0,  -64 },
-	/* 04f1: */ {      0,  -64 },
-	/* 04f2: */ {      0,  -64 },
-	/* 04f3: */ {      0,  -64 },
-	/* 04f4: */ {      0,  -64 },
-	/* 04f5: */ {      0,  -64 },
-	/* 04f6: */ {      0,  -64 },
-	/* 04f7: */ {      0,  -64 },
-	/* 04f8: */ {      0,  -64 },
-	/* 04f9: */ {      0,  -64 },
-	/* 04fa: */ {      0,  -64 },
-	/* 04fb: */ {      0,  -64 },
-	/* 04fc: */ {      0,  -64 },
-	/* 04fd: */ {      0,  -64 },
-	/* 04fe: */ {      0,  -64 },
-	/* 04ff: */ {      0,  -64 },
-	/* 0500: */ {      0,  -64 },
-	/* 0501: */ {      0,  -64 },
-	/* 0502: */ {      0,  -64 },
-	/* 0503: */ {      0,  -64 },
-	/* 0504: */ {      0,  -64 },
-	/* 0505: */ {      0,  -64 },
-	/* 0506: */ {      0,  -64 },
-	/* 0507: */ {      0,  -64 },
-	/* 0508: */ {      0,  -64 },
-	/* 0509: */ {      0,  -64 },
-	/* 050a: */ {      0,  -64 },
-	/* 050b: */ {      0,  -64 },
-	/* 050c: */ {      0,  -64 },
-	/* 050d: */ {      0,  -64 },
-	/* 050e: */ {      0,  -64 },
-	/* 050f: */ {      0,  -64 },
-	/* 0510: */ {      0,  -64 },
-	/* 0511: */ {      0,  -64 },
-	/* 0512: */ {      0,  -64 },
-	/* 0513: */ {      0,  -64 },
-	/* 0514: */ {      0,  -64 },
-	/* 0515: */ {      0,  -64 },
-	/* 0516: */ {      0,  -64 },
-	/* 0517: */ {      0,  -64 },
-	/* 0518: */ {      0,  -64 },
-	/* 0519: */ {      0,  -64 },
-	/* 051a: */ {      0,  -64 },
-	/* 051b: */ {      0,  -64 },
-	/* 051c: */ {      0,  -64 },
-	/* 051d: */ {      0,  -64 },
-	/* 051e: */ {      0,  -64 },
-	/* 051f: */ {      0,  -64 },
-	/* 0520: */ {      0,  -64 },
-	/* 0521: */ {      0,  -64 },
-	/* 0522: */ {      0,  -64 },
-	/* 0523: */ {      0,  -64 },
-	/* 0524: */ {      0,  -64 },
-	/* 0525: */ {      0,  -64 },
-	/* 0526: */ {      0,  -64 },
-	/* 0527: */ {      0,  -64 },
-	/* 0528: */ {      0,  -64 },
-	/* 0529: */ {      0,  -64 },
-	/* 052a: */ {      0,  -64 },
-	/* 052b: */ {      0,  -64 },
-	/* 052c: */ {      0,  -64 },
-	/* 052d: */ {      0,  -64 },
-	/* 052e: */ {      0,  -64 },
-	/* 052f: */ {      0,  -64 },
-	/* 0530: */ {      0,  -64 },
-	/* 0531: */ {      0,  -64 },
-	/* 0532: */ {      0,  -64 },
-	/* 0533: */ {      0,  -64 },
-	/* 0534: */ {      0,  -64 },
-	/* 0535: */ {      0,  -64 },
-	/* 0536: */ {      0,  -64 },
-	/* 0537: */ {      0,  -64 },
-	/* 0538: */ {      0,  -64 },
-	/* 0539: */ {      0,  -64 },
-	/* 053a: */ {      0,  -64 },
-	/* 053b: */ {      0,  -64 },
-	/* 053c: */ {      0,  -64 },
-	/* 053d: */ {      0,  -64 },
-	/* 053e: */ {      0,  -64 },
-	/* 053f: */ {      0,  -64 },
-	/* 0540: */ {      0,  -64 },
-	/* 0541: */ {      0,  -64 },
 };
 
+#ifndef __AVR__
 static constexpr EnvelopeProgram EnvelopePrograms[] PROGMEM = {
-	/* 00: */ { &EnvelopeStages[0x0000],    0, 0x10 },
-	/* 01: */ { &EnvelopeStages[0x0001],   48, 0x44 },
-	/* 02: */ { &EnvelopeStages[0x0007],   48, 0x44 },
-	/* 03: */ { &EnvelopeStages[0x000d],   48, 0x44 },
-	/* 04: */ { &EnvelopeStages[0x0013],   48, 0x44 },
-	/* 05: */ { &EnvelopeStages[0x0019],   36, 0x44 },
-	/* 06: */ { &EnvelopeStages[0x001f],    0, 0x00 },
-	/* 07: */ { &EnvelopeStages[0x0020],    0, 0x00 },
-	/* 08: */ { &EnvelopeStages[0x0021],    0, 0x00 },
-	/* 09: */ { &EnvelopeStages[0x0022],    0, 0x00 },
-	/* 0a: */ { &EnvelopeStages[0x0023],    0, 0x00 },
-	/* 0b: */ { &EnvelopeStages[0x0024],    0, 0x00 },
-	/* 0c: */ { &EnvelopeStages[0x0025],    0, 0x00 },
-	/* 0d: */ { &EnvelopeStages[0x0026],    0, 0x00 },
-	/* 0e: */ { &EnvelopeStages[0x0027],    0, 0x00 },
-	/* 0f: */ { &EnvelopeStages[0x0028],    0, 0x00 },
-	/* 10: */ { &EnvelopeStages[0x0029],    0, 0x00 },
-	/* 11: */ { &EnvelopeStages[0x002a],    0, 0x00 },
-	/* 12: */ { &EnvelopeStages[0x002b],    0, 0x00 },
-	/* 13: */ { &EnvelopeStages[0x002c],    0, 0x00 },
-	/* 14: */ { &EnvelopeStages[0x002d],    0, 0x00 },
-	/* 15: */ { &EnvelopeStages[0x002e],    0, 0x00 },
-	/* 16: */ { &EnvelopeStages[0x002f],    0, 0x00 },
-	/* 17: */ { &EnvelopeStages[0x0030],    0, 0x00 },
-	/* 18: */ { &EnvelopeStages[0x0031],    0, 0x00 },
-	/* 19: */ { &EnvelopeStages[0x0032],    0, 0x00 },
-	/* 1a: */ { &EnvelopeStages[0x0033],    0, 0x00 },
-	/* 1b: */ { &EnvelopeStages[0x0034],    0, 0x00 },
-	/* 1c: */ { &EnvelopeStages[0x0035],    0, 0x00 },
-	/* 1d: */ { &EnvelopeStages[0x0036],    0, 0x00 },
-	/* 1e: */ { &EnvelopeStages[0x0037],    0, 0x00 },
-	/* 1f: */ { &EnvelopeStages[0x0038],    0, 0x00 },
-	/* 20: */ { &EnvelopeStages[0x0039],    0, 0x00 },
-	/* 21: */ { &EnvelopeStages[0x003a],    0, 0x00 },
-	/* 22: */ { &EnvelopeStages[0x003b],    0, 0x00 },
-	/* 23: */ { &EnvelopeStages[0x003c],    0, 0x00 },
-	/* 24: */ { &EnvelopeStages[0x003d],    0, 0x00 },
-	/* 25: */ { &EnvelopeStages[0x003e],    0, 0x00 },
-	/* 26: */ { &EnvelopeStages[0x003f],    0, 0x00 },
-	/* 27: */ { &EnvelopeStages[0x0040],    0, 0x00 },
-	/* 28: */ { &EnvelopeStages[0x0041],    0, 0x00 },
-	/* 29: */ { &EnvelopeStages[0x0042],    0, 0x00 },
-	/* 2a: */ { &EnvelopeStages[0x0043],    0, 0x00 },
-	/* 2b: */ { &EnvelopeStages[0x0044],    0, 0x00 },
-	/* 2c: */ { &EnvelopeStages[0x0045],    0, 0x00 },
-	/* 2d: */ { &EnvelopeStages[0x0046],    0, 0x00 },
-	/* 2e: */ { &EnvelopeStages[0x0047],    0, 0x00 },
-	/* 2f: */ { &EnvelopeStages[0x0048],    0, 0x00 },
-	/* 30: */ { &EnvelopeStages[0x0049],    0, 0x00 },
-	/* 31: */ { &EnvelopeStages[0x004a],    0, 0x00 },
-	/* 32: */ { &EnvelopeStages[0x004b],    0, 0x00 },
-	/* 33: */ { &EnvelopeStages[0x004c],    0, 0x00 },
-	/* 34: */ { &EnvelopeStages[0x004d],    0, 0x00 },
-	/* 35: */ { &EnvelopeStages[0x004e],    0, 0x00 },
-	/* 36: */ { &EnvelopeStages[0x004f],    0, 0x00 },
-	/* 37: */ { &EnvelopeStages[0x0050],    0, 0x00 },
-	/* 38: */ { &EnvelopeStages[0x0051],    0, 0x00 },
-	/* 39: */ { &EnvelopeStages[0x0052],    0, 0x00 },
-	/* 3a: */ { &EnvelopeStages[0x0053],    0, 0x00 },
-	/* 3b: */ { &EnvelopeStages[0x0054],    0, 0x00 },
-	/* 3c: */ { &EnvelopeStages[0x0055],    0, 0x00 },
-	/* 3d: */ { &EnvelopeStages[0x0056],    0, 0x00 },
-	/* 3e: */ { &EnvelopeStages[0x0057],    0, 0x00 },
-	/* 3f: */ { &EnvelopeStages[0x0058],   36, 0x12 },
-	/* 40: */ { &EnvelopeStages[0x005e],   40, 0x13 },
-	/* 41: */ { &EnvelopeStages[0x0064],   42, 0x13 },
-	/* 42: */ { &EnvelopeStages[0x006a],   36, 0x12 },
-	/* 43: */ { &EnvelopeStages[0x0070],    0, 0x00 },
-	/* 44: */ { &EnvelopeStages[0x0071],    0, 0x00 },
-	/* 45: */ { &EnvelopeStages[0x0072],    0, 0x00 },
-	/* 46: */ { &EnvelopeStages[0x0073],    0, 0x00 },
-	/* 47: */ { &EnvelopeStages[0x0074],    0, 0x24 },
-	/* 48: */ { &EnvelopeStages[0x007a],    0, 0x12 },
-	/* 49: */ { &EnvelopeStages[0x0080],    0, 0x24 },
-	/* 4a: */ { &EnvelopeStages[0x0086],   10, 0x24 },
-	/* 4b: */ { &EnvelopeStages[0x008c],    0, 0x24 },
-	/* 4c: */ { &EnvelopeStages[0x0092],    0, 0x00 },
-	/* 4d: */ { &EnvelopeStages[0x0093],    0, 0x00 },
-	/* 4e: */ { &EnvelopeStages[0x0094],    0, 0x00 },
-	/* 4f: */ { &EnvelopeStages[0x0095],    0, 0x00 },
-	/* 50: */ { &EnvelopeStages[0x0096],    0, 0x24 },
-	/* 51: */ { &EnvelopeStages[0x009c],    0, 0x24 },
-	/* 52: */ { &EnvelopeStages[0x00a2],    0, 0x00 },
-	/* 53: */ { &EnvelopeStages[0x00a3],    0, 0x00 },
-	/* 54: */ { &EnvelopeStages[0x00a4],    0, 0x00 },
-	/* 55: */ { &EnvelopeStages[0x00a5],    0, 0x00 },
-	/* 56: */ { &EnvelopeStages[0x00a6],    0, 0x00 },
-	/* 57: */ { &EnvelopeStages[0x00a7],    0, 0x13 },
-	/* 58: */ { &EnvelopeStages[0x00ad],    0, 0x13 },
-	/* 59: */ { &EnvelopeStages[0x00b3],    0, 0x13 },
-	/* 5a: */ { &EnvelopeStages[0x00b9],    0, 0x00 },
-	/* 5b: */ { &EnvelopeStages[0x00ba],    0, 0x00 },
-	/* 5c: */ { &EnvelopeStages[0x00bb],    0, 0x00 },
-	/* 5d: */ { &EnvelopeStages[0x00bc],    0, 0x00 },
-	/* 5e: */ { &EnvelopeStages[0x00bd],    0, 0x00 },
-	/* 5f: */ { &EnvelopeStages[0x00be],    0, 0x00 },
-	/* 60: */ { &EnvelopeStages[0x00bf],    0, 0x00 },
-	/* 61: */ { &EnvelopeStages[0x00c0],    0, 0x00 },
-	/* 62: */ { &EnvelopeStages[0x00c1],    0, 0x00 },
-	/* 63: */ { &EnvelopeStages[0x00c2],    0, 0x00 },
-	/* 64: */ { &EnvelopeStages[0x00c3],    0, 0x00 },
-	/* 65: */ { &EnvelopeStages[0x00c4],    0, 0x00 },
-	/* 66: */ { &EnvelopeStages[0x00c5],    0, 0x00 },
-	/* 67: */ { &EnvelopeStages[0x00c6],    0, 0x00 },
-	/* 68: */ { &EnvelopeStages[0x00c7],    0, 0x00 },
-	/* 69: */ { &EnvelopeStages[0x00c8],    0, 0x00 },
-	/* 6a: */ { &EnvelopeStages[0x00c9],    0, 0x00 },
-	/* 6b: */ { &EnvelopeStages[0x00ca],    0, 0x00 },
-	/* 6c: */ { &EnvelopeStages[0x00cb],    0, 0x00 },
-	/* 6d: */ { &EnvelopeStages[0x00cc],    0, 0x00 },
-	/* 6e: */ { &EnvelopeStages[0x00cd],    0, 0x00 },
-	/* 6f: */ { &EnvelopeStages[0x00ce],    0, 0x00 },
-	/* 70: */ { &EnvelopeStages[0x00cf],    0, 0x00 },
-	/* 71: */ { &EnvelopeStages[0x00d5],    0, 0x00 },
-	/* 72: */ { &EnvelopeStages[0x00d6],    0, 0x00 },
-	/* 73: */ { &EnvelopeStages[0x00d7],    0, 0x00 },
-	/* 74: */ { &EnvelopeStages[0x00d8],    0, 0x00 },
-	/* 75: */ { &EnvelopeStages[0x00d9],    0, 0x00 },
-	/* 76: */ { &EnvelopeStages[0x00da],    0, 0x00 },
-	/* 77: */ { &EnvelopeStages[0x00db],    0, 0x00 },
-	/* 78: */ { &EnvelopeStages[0x00dc],    0, 0x00 },
-	/* 79: */ { &EnvelopeStages[0x00dd],    0, 0x00 },
-	/* 7a: */ { &EnvelopeStages[0x00de],    0, 0x00 },
-	/* 7b: */ { &EnvelopeStages[0x00df],    0, 0x00 },
-	/* 7c: */ { &EnvelopeStages[0x00e0],    0, 0x00 },
-	/* 7d: */ { &EnvelopeStages[0x00e1],    0, 0x00 },
-	/* 7e: */ { &EnvelopeStages[0x00e2],    0, 0x00 },
-	/* 7f: */ { &EnvelopeStages[0x00e3],    0, 0x00 },
-	/* 80: */ { &EnvelopeStages[0x00e4],  127, 0x00 },
-	/* 81: */ { &EnvelopeStages[0x00ea],   48, 0x00 },
-	/* 82: */ { &EnvelopeStages[0x00f0],   48, 0x00 },
-	/* 83: */ { &EnvelopeStages[0x00f6],    0, 0x00 },
-	/* 84: */ { &EnvelopeStages[0x00fc],    0, 0x00 },
-	/* 85: */ { &EnvelopeStages[0x0102],    0, 0x00 },
-	/* 86: */ { &EnvelopeStages[0x0103],    0, 0x00 },
-	/* 87: */ { &EnvelopeStages[0x0104],    0, 0x00 },
-	/* 88: */ { &EnvelopeStages[0x0105],    0, 0x00 },
-	/* 89: */ { &EnvelopeStages[0x0106],    0, 0x00 },
-	/* 8a: */ { &EnvelopeStages[0x0107],    0, 0x00 },
-	/* 8b: */ { &EnvelopeStages[0x0108],    0, 0x00 },
-	/* 8c: */ { &EnvelopeStages[0x0109],    0, 0x00 },
-	/* 8d: */ { &EnvelopeStages[0x010a],    0, 0x00 },
-	/* 8e: */ { &EnvelopeStages[0x010b],    0, 0x00 },
-	/* 8f: */ { &EnvelopeStages[0x010c],    0, 0x00 },
-	/* 90: */ { &EnvelopeStages[0x010d],   99, 0x00 },
-	/* 91: */ { &EnvelopeStages[0x0113],   95, 0x00 },
-	/* 92: */ { &EnvelopeStages[0x0119],    0, 0x00 },
-	/* 93: */ { &EnvelopeStages[0x011a],    0, 0x00 },
-	/* 94: */ { &EnvelopeStages[0x011b],    0, 0x00 },
-	/* 95: */ { &EnvelopeStages[0x011c],    0, 0x00 },
-	/* 96: */ { &EnvelopeStages[0x011d],    0, 0x00 },
-	/* 97: */ { &EnvelopeStages[0x011e],    0, 0x00 },
-	/* 98: */ { &EnvelopeStages[0x011f],    0, 0x00 },
-	/* 99: */ { &EnvelopeStages[0x0120],    0, 0x00 },
-	/* 9a: */ { &EnvelopeStages[0x0121],    0, 0x00 },
-	/* 9b: */ { &EnvelopeStages[0x0122],    0, 0x00 },
-	/* 9c: */ { &EnvelopeStages[0x0123],    0, 0x00 },
-	/* 9d: */ { &EnvelopeStages[0x0124],    0, 0x00 },
-	/* 9e: */ { &EnvelopeStages[0x0125],    0, 0x00 },
-	/* 9f: */ { &EnvelopeStages[0x0126],    0, 0x00 },
-	/* a0: */ { &EnvelopeStages[0x0127],    0, 0x00 },
-	/* a1: */ { &EnvelopeStages[0x0128],    0, 0x00 },
-	/* a2: */ { &EnvelopeStages[0x0129],    0, 0x00 },
-	/* a3: */ { &EnvelopeStages[0x012a],    0, 0x00 },
-	/* a4: */ { &EnvelopeStages[0x012b],    0, 0x00 },
-	/* a5: */ { &EnvelopeStages[0x012c],    0, 0x00 },
-	/* a6: */ { &EnvelopeStages[0x012d],    0, 0x00 },
-	/* a7: */ { &EnvelopeStages[0x012e],    0, 0x00 },
-	/* a8: */ { &EnvelopeStages[0x012f],    0, 0x00 },
-	/* a9: */ { &EnvelopeStages[0x0130],    0, 0x00 },
-	/* aa: */ { &EnvelopeStages[0x0131],    0, 0x00 },
-	/* ab: */ { &EnvelopeStages[0x0132],    0, 0x00 },
-	/* ac: */ { &EnvelopeStages[0x0133],    0, 0x00 },
-	/* ad: */ { &EnvelopeStages[0x0134],    0, 0x00 },
-	/* ae: */ { &EnvelopeStages[0x0135],    0, 0x00 },
-	/* af: */ { &EnvelopeStages[0x0136],    0, 0x00 },
-	/* b0: */ { &EnvelopeStages[0x0137],    0, 0x00 },
-	/* b1: */ { &EnvelopeStages[0x0138],    0, 0x00 },
-	/* b2: */ { &EnvelopeStages[0x0139],    0, 0x00 },
-	/* b3: */ { &EnvelopeStages[0x013a],    0, 0x00 },
-	/* b4: */ { &EnvelopeStages[0x013b],    0, 0x00 },
-	/* b5: */ { &EnvelopeStages[0x013c],    0, 0x00 },
-	/* b6: */ { &EnvelopeStages[0x013d],    0, 0x00 },
-	/* b7: */ { &EnvelopeStages[0x013e],    0, 0x00 },
-	/* b8: */ { &EnvelopeStages[0x013f],    0, 0x00 },
-	/* b9: */ { &EnvelopeStages[0x0140],    0, 0x00 },
-	/* ba: */ { &EnvelopeStages[0x0141],    0, 0x00 },
-	/* bb: */ { &EnvelopeStages[0x0142],    0, 0x00 },
-	/* bc: */ { &EnvelopeStages[0x0143],    0, 0x00 },
-	/* bd: */ { &EnvelopeStages[0x0144],    0, 0x00 },
-	/* be: */ { &EnvelopeStages[0x0145],    0, 0x00 },
-	/* bf: */ { &EnvelopeStages[0x0146],    0, 0x00 },
-	/* c0: */ { &EnvelopeStages[0x0148],    0, 0x00 },
-	/* c1: */ { &EnvelopeStages[0x014a],    0, 0x02 },
-	/* c2: */ { &EnvelopeStages[0x014d],    0, 0x00 },
-	/* c3: */ { &EnvelopeStages[0x0150],   80, 0x00 },
-	/* c4: */ { &EnvelopeStages[0x0154],   64, 0x02 },
-	/* c5: */ { &EnvelopeStages[0x0157],    0, 0x00 },
-	/* c6: */ { &EnvelopeStages[0x0159],   64, 0x02 },
-	/* c7: */ { &EnvelopeStages[0x015c],   80, 0x13 },
-	/* c8: */ { &EnvelopeStages[0x015f],    0, 0x02 },
-	/* c9: */ { &EnvelopeStages[0x0162],    0, 0x00 },
-	/* ca: */ { &EnvelopeStages[0x0164],   16, 0x00 },
-	/* cb: */ { &EnvelopeStages[0x0166],    0, 0x02 },
-	/* cc: */ { &EnvelopeStages[0x0169],   32, 0x02 },
-	/* cd: */ { &EnvelopeStages[0x016c],   16, 0x13 },
-	/* ce: */ { &EnvelopeStages[0x0170],   37, 0x13 },
-	/* cf: */ { &EnvelopeStages[0x0174],    0, 0x13 },
-	/* d0: */ { &EnvelopeStages[0x0178],    0, 0x02 },
-	/* d1: */ { &EnvelopeStages[0x017b],    0, 0x02 },
-	/* d2: */ { &EnvelopeStages[0x017e],    0, 0x00 },
-	/* d3: */ { &EnvelopeStages[0x017f],    0, 0x00 },
-	/* d4: */ { &EnvelopeStages[0x0180],    0, 0x00 },
-	/* d5: */ { &EnvelopeStages[0x0181],    0, 0x00 },
-	/* d6: */ { &EnvelopeStages[0x0182],    0, 0x00 },
-	/* d7: */ { &EnvelopeStages[0x0183],    0, 0x00 },
-	/* d8: */ { &EnvelopeStages[0x0184],    0, 0x00 },
-	/* d9: */ { &EnvelopeStages[0x0185],    0, 0x00 },
-	/* da: */ { &EnvelopeStages[0x0186],    0, 0x00 },
-	/* db: */ { &EnvelopeStages[0x0187],    0, 0x00 },
-	/* dc: */ { &EnvelopeStages[0x0188],    0, 0x00 },
-	/* dd: */ { &EnvelopeStages[0x0189],    0, 0x00 },
-	/* de: */ { &EnvelopeStages[0x018a],    0, 0x00 },
-	/* df: */ { &EnvelopeStages[0x018b],    0, 0x00 },
-	/* e0: */ { &EnvelopeStages[0x018c],   48, 0x02 },
-	/* e1: */ { &EnvelopeStages[0x018f],    0, 0x02 },
-	/* e2: */ { &EnvelopeStages[0x0192],    0, 0x00 },
-	/* e3: */ { &EnvelopeStages[0x0193],    0, 0x00 },
-	/* e4: */ { &EnvelopeStages[0x0194],    0, 0x00 },
-	/* e5: */ { &EnvelopeStages[0x0195],    0, 0x00 },
-	/* e6: */ { &EnvelopeStages[0x0196],    0, 0x00 },
-	/* e7: */ { &EnvelopeStages[0x0197],    0, 0x00 },
-	/* e8: */ { &EnvelopeStages[0x0198],    0, 0x00 },
-	/* e9: */ { &EnvelopeStages[0x0199],    0, 0x00 },
-	/* ea: */ { &EnvelopeStages[0x019a],    0, 0x00 },
-	/* eb: */ { &EnvelopeStages[0x019b],    0, 0x00 },
-	/* ec: */ { &EnvelopeStages[0x019c],    0, 0x00 },
-	/* ed: */ { &EnvelopeStages[0x019d],    0, 0x00 },
-	/* ee: */ { &EnvelopeStages[0x019e],    0, 0x00 },
-	/* ef: */ { &EnvelopeStages[0x019f],    0, 0x00 },
-	/* f0: */ { &EnvelopeStages[0x01a0],   32, 0x10 },
-	/* f1: */ { &EnvelopeStages[0x01a4],    0, 0x00 },
-	/* f2: */ { &EnvelopeStages[0x01a5],    0, 0x00 },
-	/* f3: */ { &EnvelopeStages[0x01a6],    0, 0x00 },
-	/* f4: */ { &EnvelopeStages[0x01a7],    0, 0x00 },
-	/* f5: */ { &EnvelopeStages[0x01a8],    0, 0x00 },
-	/* f6: */ { &EnvelopeStages[0x01a9],    0, 0x00 },
-	/* f7: */ { &EnvelopeStages[0x01aa],    0, 0x00 },
-	/* f8: */ { &EnvelopeStages[0x01ab],    0, 0x00 },
-	/* f9: */ { &EnvelopeStages[0x01ac],    0, 0x00 },
-	/* fa: */ { &EnvelopeStages[0x01ad],    0, 0x00 },
-	/* fb: */ { &EnvelopeStages[0x01ae],    0, 0x00 },
-	/* fc: */ { &EnvelopeStages[0x01af],   64, 0x02 },
-	/* fd: */ { &EnvelopeStages[0x01b2],   64, 0x02 },
-	/* fe: */ { &EnvelopeStages[0x01b5],   64, 0x02 },
-	/* ff: */ { &EnvelopeStages[0x01b8],   64, 0x00 },
+	/* 00: */ { &EnvelopeStages[0x0002],    0, 0x10 },
+	/* 01: */ { &EnvelopeStages[0x0143],   48, 0x44 },
+	/* 02: */ { &EnvelopeStages[0x0149],   48, 0x44 },
+	/* 03: */ { &EnvelopeStages[0x014f],   48, 0x44 },
+	/* 04: */ { &EnvelopeStages[0x0155],   48, 0x44 },
+	/* 05: */ { &EnvelopeStages[0x015b],   36, 0x44 },
+	/* 06: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 07: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 08: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 09: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 0a: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 0b: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 0c: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 0d: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 0e: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 0f: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 10: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 11: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 12: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 13: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 14: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 15: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 16: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 17: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 18: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 19: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 1a: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 1b: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 1c: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 1d: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 1e: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 1f: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 20: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 21: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 22: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 23: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 24: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 25: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 26: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 27: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 28: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 29: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 2a: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 2b: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 2c: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 2d: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 2e: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 2f: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 30: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 31: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 32: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 33: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 34: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 35: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 36: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 37: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 38: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 39: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 3a: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 3b: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 3c: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 3d: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 3e: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 3f: */ { &EnvelopeStages[0x0161],   36, 0x12 },
+	/* 40: */ { &EnvelopeStages[0x0167],   40, 0x13 },
+	/* 41: */ { &EnvelopeStages[0x016d],   42, 0x13 },
+	/* 42: */ { &EnvelopeStages[0x0173],   36, 0x12 },
+	/* 43: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 44: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 45: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 46: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 47: */ { &EnvelopeStages[0x0179],    0, 0x24 },
+	/* 48: */ { &EnvelopeStages[0x017f],    0, 0x12 },
+	/* 49: */ { &EnvelopeStages[0x0185],    0, 0x24 },
+	/* 4a: */ { &EnvelopeStages[0x018b],   10, 0x24 },
+	/* 4b: */ { &EnvelopeStages[0x0191],    0, 0x24 },
+	/* 4c: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 4d: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 4e: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 4f: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 50: */ { &EnvelopeStages[0x0197],    0, 0x24 },
+	/* 51: */ { &EnvelopeStages[0x019d],    0, 0x24 },
+	/* 52: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 53: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 54: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 55: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 56: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 57: */ { &EnvelopeStages[0x01a3],    0, 0x13 },
+	/* 58: */ { &EnvelopeStages[0x01a9],    0, 0x13 },
+	/* 59: */ { &EnvelopeStages[0x01af],    0, 0x13 },
+	/* 5a: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 5b: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 5c: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 5d: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 5e: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 5f: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 60: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 61: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 62: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 63: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 64: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 65: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 66: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 67: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 68: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 69: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 6a: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 6b: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 6c: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 6d: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 6e: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 6f: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 70: */ { &EnvelopeStages[0x01b5],    0, 0x00 },
+	/* 71: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 72: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 73: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 74: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 75: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 76: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 77: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 78: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 79: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 7a: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 7b: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 7c: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 7d: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 7e: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 7f: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 80: */ { &EnvelopeStages[0x01bb],  127, 0x00 },
+	/* 81: */ { &EnvelopeStages[0x01c1],   48, 0x00 },
+	/* 82: */ { &EnvelopeStages[0x01c7],   48, 0x00 },
+	/* 83: */ { &EnvelopeStages[0x01cd],    0, 0x00 },
+	/* 84: */ { &EnvelopeStages[0x01d3],    0, 0x00 },
+	/* 85: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 86: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 87: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 88: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 89: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 8a: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 8b: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 8c: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 8d: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 8e: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 8f: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 90: */ { &EnvelopeStages[0x01d9],   99, 0x00 },
+	/* 91: */ { &EnvelopeStages[0x01df],   95, 0x00 },
+	/* 92: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 93: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 94: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 95: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 96: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 97: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 98: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 99: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 9a: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 9b: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 9c: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 9d: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 9e: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* 9f: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* a0: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* a1: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* a2: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* a3: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* a4: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* a5: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* a6: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* a7: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* a8: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* a9: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* aa: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* ab: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* ac: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* ad: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* ae: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* af: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* b0: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* b1: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* b2: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* b3: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* b4: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* b5: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* b6: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* b7: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* b8: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* b9: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* ba: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* bb: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* bc: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* bd: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* be: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* bf: */ { &EnvelopeStages[0x021c],    0, 0x00 },
+	/* c0: */ { &EnvelopeStages[0x021e],    0, 0x00 },
+	/* c1: */ { &EnvelopeStages[0x0209],    0, 0x02 },
+	/* c2: */ { &EnvelopeStages[0x020c],    0, 0x00 },
+	/* c3: */ { &EnvelopeStages[0x0218],   80, 0x00 },
+	/* c4: */ { &EnvelopeStages[0x020e],   64, 0x02 },
+	/* c5: */ { &EnvelopeStages[0x0211],    0, 0x00 },
+	/* c6: */ { &EnvelopeStages[0x01e5],   64, 0x02 },
+	/* c7: */ { &EnvelopeStages[0x01e8],   80, 0x13 },
+	/* c8: */ { &EnvelopeStages[0x0213],    0, 0x02 },
+	/* c9: */ { &EnvelopeStages[0x0216],    0, 0x00 },
+	/* ca: */ { &EnvelopeStages[0x0220],   16, 0x00 },
+	/* cb: */ { &EnvelopeStages[0x01ee],    0, 0x02 },
+	/* cc: */ { &EnvelopeStages[0x0135],   32, 0x02 },
+	/* cd: */ { &EnvelopeStages[0x0129],   16, 0x13 },
+	/* ce: */ { &EnvelopeStages[0x012d],   37, 0x13 },
+	/* cf: */ { &EnvelopeStages[0x013c],    0, 0x13 },
+	/* d0: */ { &EnvelopeStages[0x01f4],    0, 0x02 },
+	/* d1: */ { &EnvelopeStages[0x0115],    0, 0x02 },
+	/* d2: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* d3: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* d4: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* d5: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* d6: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* d7: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* d8: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* d9: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* da: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* db: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* dc: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* dd: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* de: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* df: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* e0: */ { &EnvelopeStages[0x01fa],   48, 0x02 },
+	/* e1: */ { &EnvelopeStages[0x0100],    0, 0x02 },
+	/* e2: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* e3: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* e4: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* e5: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* e6: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* e7: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* e8: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* e9: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* ea: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* eb: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* ec: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* ed: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* ee: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* ef: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* f0: */ { &EnvelopeStages[0x0111],   32, 0x10 },
+	/* f1: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* f2: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* f3: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* f4: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* f5: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* f6: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* f7: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* f8: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* f9: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* fa: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* fb: */ { &EnvelopeStages[0x0002],    0, 0x00 },
+	/* fc: */ { &EnvelopeStages[0x0200],   64, 0x02 },
+	/* fd: */ { &EnvelopeStages[0x0203],   64, 0x02 },
+	/* fe: */ { &EnvelopeStages[0x0000],   64, 0x02 },
+	/* ff: */ { &EnvelopeStages[0x0002],   64, 0x00 },
 };
+#endif // !__AVR__
 
+#ifndef WAVETABLE_SEGMENTS
 static constexpr int8_t Waveforms[] PROGMEM = {
 	/* Wave 0 */
 	/* 0000: */   21,   11,    7,   11,   19,   25,   17,   -3,   -7,   -5,    1,    1,   -1,   -5,   -7,   -9,  -17,  -25,  -27,  -36,  -44,  -52,  -58,  -66,  -72,  -86, -113, -121, -127, -125, -117, -119,
@@ -2422,1410 +1627,1233 @@ static constexpr int8_t Waveforms[] PROGMEM = {
 	/* 50c0: */   77,   76,   74,   72,   71,   69,   67,   69,   66,   66,   62,   61,   51,   47,   41,   36,   19,   12,    4,    1,   -6,   -6,   -7,   -6,   -7,   -9,  -11,  -11,   -6,   -6,   -2,   -1,
 	/* 50e0: */    6,    9,   14,   16,   26,   27,   31,   32,   41,   44,   47,   51,   57,   61,   62,   64,   67,   67,   71,   74,   84,   87,   94,   99,  112,  114,  119,  120,  127,  127,  122,  117,
 };
+#endif // !WAVETABLE_SEGMENTS
+
+static constexpr EnvelopeStart AmpModVariants[] PROGMEM = {
+	/* 00: */ { &EnvelopeStages[0x0149],   48, 0x44, {  29332,   96 } },   /* program 02 */
+	/* 01: */ { &EnvelopeStages[0x014f],   48, 0x44, {  29332,   96 } },   /* program 03 */
+	/* 02: */ { &EnvelopeStages[0x0155],   48, 0x44, {  29332,   96 } },   /* program 04 */
+	/* 03: */ { &EnvelopeStages[0x0149],   48, 0x44, {  29332,   96 } },   /* program 02 */
+	/* 04: */ { &EnvelopeStages[0x014f],   48, 0x44, {  29332,   96 } },   /* program 03 */
+	/* 05: */ { &EnvelopeStages[0x0155],   48, 0x44, {  29332,   96 } },   /* program 04 */
+	/* 06: */ { &EnvelopeStages[0x0149],   48, 0x44, {  29332,   96 } },   /* program 02 */
+	/* 07: */ { &EnvelopeStages[0x014f],   48, 0x44, {  29332,   96 } },   /* program 03 */
+	/* 08: */ { &EnvelopeStages[0x0155],   48, 0x44, {  29332,   96 } },   /* program 04 */
+	/* 09: */ { &EnvelopeStages[0x0149],   48, 0x44, {  29332,   96 } },   /* program 02 */
+	/* 0a: */ { &EnvelopeStages[0x014f],   48, 0x44, {  29332,   96 } },   /* program 03 */
+	/* 0b: */ { &EnvelopeStages[0x0155],   48, 0x44, {  29332,   96 } },   /* program 04 */
+	/* 0c: */ { &EnvelopeStages[0x0149],   48, 0x44, {  29332,   96 } },   /* program 02 */
+	/* 0d: */ { &EnvelopeStages[0x014f],   48, 0x44, {  29332,   96 } },   /* program 03 */
+	/* 0e: */ { &EnvelopeStages[0x0155],   48, 0x44, {  29332,   96 } },   /* program 04 */
+	/* 0f: */ { &EnvelopeStages[0x0149],   48, 0x44, {  29332,   96 } },   /* program 02 */
+	/* 10: */ { &EnvelopeStages[0x014f],   48, 0x44, {  29332,   96 } },   /* program 03 */
+	/* 11: */ { &EnvelopeStages[0x0155],   48, 0x44, {  29332,   96 } },   /* program 04 */
+	/* 12: */ { &EnvelopeStages[0x0149],   48, 0x44, {  29332,   96 } },   /* program 02 */
+	/* 13: */ { &EnvelopeStages[0x014f],   48, 0x44, {  29332,   96 } },   /* program 03 */
+	/* 14: */ { &EnvelopeStages[0x0155],   48, 0x44, {  29332,   96 } },   /* program 04 */
+	/* 15: */ { &EnvelopeStages[0x0149],   48, 0x44, {  29332,   96 } },   /* program 02 */
+	/* 16: */ { &EnvelopeStages[0x014f],   48, 0x44, {  29332,   96 } },   /* program 03 */
+	/* 17: */ { &EnvelopeStages[0x0155],   48, 0x44, {  29332,   96 } },   /* program 04 */
+};
 
-static constexpr Instrument instruments[] PROGMEM = {
-	/*   0:         Acoustic Grand Piano */ {
-		/* waveOffset: */ &Waveforms[128],
-		/* ampMod:     */ 1,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(12)
-	},
-	/*   1:        Bright Acoustic Piano */ {
-		/* waveOffset: */ &Waveforms[117],
-		/* ampMod:     */ 1,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(12)
-	},
-	/*   2:         Electric Grand Piano */ {
-		/* waveOffset: */ &Waveforms[320],
-		/* ampMod:     */ 1,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(4)
-	},
-	/*   3:             Honky-tonk Piano */ {
-		/* waveOffset: */ &Waveforms[128],
-		/* ampMod:     */ 1,
-		/* freqMod:    */ 196,
-		/* waveMod:    */ 0,
+static constexpr InstrumentRecord InstrumentRecords[] PROGMEM = {
+	/* 00:         Acoustic Grand Piano */ {
+		/* waveOffset: */ 128,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(12),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x0143],   48, 0x44, {  29332,   96 } },   /* program 01 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x0002],    0, 0x10, {      0,  -64 } },   /* program 00 */
+	},
+	/* 01:        Bright Acoustic Piano */ {
+		/* waveOffset: */ 117,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(12),
+		/* variants:   */ 0x03,
+		/* ampMod:     */ { &EnvelopeStages[0x0143],   48, 0x44, {  29332,   96 } },   /* program 01 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x0002],    0, 0x10, {      0,  -64 } },   /* program 00 */
+	},
+	/* 02:         Electric Grand Piano */ {
+		/* waveOffset: */ 320,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(4),
+		/* variants:   */ 0x06,
+		/* ampMod:     */ { &EnvelopeStages[0x0143],   48, 0x44, {  29332,   96 } },   /* program 01 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x0002],    0, 0x10, {      0,  -64 } },   /* program 00 */
+	},
+	/* 03:             Honky-tonk Piano */ {
+		/* waveOffset: */ 128,
 		/* xor:        */ 3,
-		/* flags:      */ static_cast<InstrumentFlags>(12)
-	},
-	/*   4:             Electric Piano 1 */ {
-		/* waveOffset: */ &Waveforms[448],
-		/* ampMod:     */ 1,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(4)
-	},
-	/*   5:             Electric Piano 2 */ {
-		/* waveOffset: */ &Waveforms[576],
-		/* ampMod:     */ 1,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(4)
-	},
-	/*   6:                  Harpsichord */ {
-		/* waveOffset: */ &Waveforms[0],
-		/* ampMod:     */ 1,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 194,
+		/* flags:      */ static_cast<InstrumentFlags>(12),
+		/* variants:   */ 0x09,
+		/* ampMod:     */ { &EnvelopeStages[0x0143],   48, 0x44, {  29332,   96 } },   /* program 01 */
+		/* freqMod:    */ { &EnvelopeStages[0x020e],   64, 0x02, {  32512,   66 } },   /* program c4 */
+		/* waveMod:    */ { &EnvelopeStages[0x0002],    0, 0x10, {      0,  -64 } },   /* program 00 */
+	},
+	/* 04:             Electric Piano 1 */ {
+		/* waveOffset: */ 448,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(4),
+		/* variants:   */ 0x0c,
+		/* ampMod:     */ { &EnvelopeStages[0x0143],   48, 0x44, {  29332,   96 } },   /* program 01 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x0002],    0, 0x10, {      0,  -64 } },   /* program 00 */
+	},
+	/* 05:             Electric Piano 2 */ {
+		/* waveOffset: */ 576,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(4),
+		/* variants:   */ 0x0f,
+		/* ampMod:     */ { &EnvelopeStages[0x0143],   48, 0x44, {  29332,   96 } },   /* program 01 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x0002],    0, 0x10, {      0,  -64 } },   /* program 00 */
+	},
+	/* 06:                  Harpsichord */ {
+		/* waveOffset: */ 0,
 		/* xor:        */ 4,
-		/* flags:      */ static_cast<InstrumentFlags>(4)
-	},
-	/*   7:                     Clavinet */ {
-		/* waveOffset: */ &Waveforms[481],
-		/* ampMod:     */ 1,
-		/* freqMod:    */ 197,
-		/* waveMod:    */ 191,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(4)
-	},
-	/*   8:                      Celesta */ {
-		/* waveOffset: */ &Waveforms[1024],
-		/* ampMod:     */ 4,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 197,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*   9:                 Glockenspiel */ {
-		/* waveOffset: */ &Waveforms[1088],
-		/* ampMod:     */ 3,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  10:                    Music Box */ {
-		/* waveOffset: */ &Waveforms[1088],
-		/* ampMod:     */ 4,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  11:                   Vibraphone */ {
-		/* waveOffset: */ &Waveforms[832],
-		/* ampMod:     */ 3,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  12:                      Marimba */ {
-		/* waveOffset: */ &Waveforms[1280],
-		/* ampMod:     */ 3,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 197,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  13:                    Xylophone */ {
-		/* waveOffset: */ &Waveforms[1344],
-		/* ampMod:     */ 3,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  14:                Tubular Bells */ {
-		/* waveOffset: */ &Waveforms[1344],
-		/* ampMod:     */ 3,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  15:                     Dulcimer */ {
-		/* waveOffset: */ &Waveforms[735],
-		/* ampMod:     */ 1,
-		/* freqMod:    */ 199,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  16:                Drawbar Organ */ {
-		/* waveOffset: */ &Waveforms[1600],
-		/* ampMod:     */ 64,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  17:             Percussive Organ */ {
-		/* waveOffset: */ &Waveforms[1600],
-		/* ampMod:     */ 65,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(4),
+		/* variants:   */ 0x12,
+		/* ampMod:     */ { &EnvelopeStages[0x0143],   48, 0x44, {  29332,   96 } },   /* program 01 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x020c],    0, 0x00, {     54,   32 } },   /* program c2 */
+	},
+	/* 07:                     Clavinet */ {
+		/* waveOffset: */ 481,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(4),
+		/* variants:   */ 0x15,
+		/* ampMod:     */ { &EnvelopeStages[0x0143],   48, 0x44, {  29332,   96 } },   /* program 01 */
+		/* freqMod:    */ { &EnvelopeStages[0x0211],    0, 0x00, {  32512,   64 } },   /* program c5 */
+		/* waveMod:    */ { &EnvelopeStages[0x021c],    0, 0x00, {  14662,   34 } },   /* program bf */
+	},
+	/* 08:                      Celesta */ {
+		/* waveOffset: */ 1024,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x0155],   48, 0x44, {  29332,   96 } },   /* program 04 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x0211],    0, 0x00, {  32512,   64 } },   /* program c5 */
+	},
+	/* 09:                 Glockenspiel */ {
+		/* waveOffset: */ 1088,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x014f],   48, 0x44, {  29332,   96 } },   /* program 03 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x0002],    0, 0x10, {      0,  -64 } },   /* program 00 */
+	},
+	/* 0a:                    Music Box */ {
+		/* waveOffset: */ 1088,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x0155],   48, 0x44, {  29332,   96 } },   /* program 04 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x0002],    0, 0x10, {      0,  -64 } },   /* program 00 */
+	},
+	/* 0b:                   Vibraphone */ {
+		/* waveOffset: */ 832,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x014f],   48, 0x44, {  29332,   96 } },   /* program 03 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x0002],    0, 0x10, {      0,  -64 } },   /* program 00 */
+	},
+	/* 0c:                      Marimba */ {
+		/* waveOffset: */ 1280,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x014f],   48, 0x44, {  29332,   96 } },   /* program 03 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x0211],    0, 0x00, {  32512,   64 } },   /* program c5 */
+	},
+	/* 0d:                    Xylophone */ {
+		/* waveOffset: */ 1344,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x014f],   48, 0x44, {  29332,   96 } },   /* program 03 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x0002],    0, 0x10, {      0,  -64 } },   /* program 00 */
+	},
+	/* 0e:                     Dulcimer */ {
+		/* waveOffset: */ 735,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x0143],   48, 0x44, {  29332,   96 } },   /* program 01 */
+		/* freqMod:    */ { &EnvelopeStages[0x01e8],   80, 0x13, {  -7331,   67 } },   /* program c7 */
+		/* waveMod:    */ { &EnvelopeStages[0x0002],    0, 0x10, {      0,  -64 } },   /* program 00 */
+	},
+	/* 0f:                Drawbar Organ */ {
+		/* waveOffset: */ 1600,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x0167],   40, 0x13, {  14662,   80 } },   /* program 40 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x0002],    0, 0x10, {      0,  -64 } },   /* program 00 */
+	},
+	/* 10:             Percussive Organ */ {
+		/* waveOffset: */ 1600,
 		/* xor:        */ 2,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  18:                   Rock Organ */ {
-		/* waveOffset: */ &Waveforms[1698],
-		/* ampMod:     */ 64,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  19:                 Church Organ */ {
-		/* waveOffset: */ &Waveforms[1856],
-		/* ampMod:     */ 64,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  20:                   Reed Organ */ {
-		/* waveOffset: */ &Waveforms[1792],
-		/* ampMod:     */ 66,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  21:                    Accordion */ {
-		/* waveOffset: */ &Waveforms[2112],
-		/* ampMod:     */ 64,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 198,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  22:                    Harmonica */ {
-		/* waveOffset: */ &Waveforms[2240],
-		/* ampMod:     */ 64,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  23:              Tango Accordion */ {
-		/* waveOffset: */ &Waveforms[2112],
-		/* ampMod:     */ 64,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  24:      Acoustic Guitar (nylon) */ {
-		/* waveOffset: */ &Waveforms[2752],
-		/* ampMod:     */ 2,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  25:      Acoustic Guitar (steel) */ {
-		/* waveOffset: */ &Waveforms[2816],
-		/* ampMod:     */ 2,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  26:       Electric Guitar (jazz) */ {
-		/* waveOffset: */ &Waveforms[2670],
-		/* ampMod:     */ 1,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  27:      Electric Guitar (clean) */ {
-		/* waveOffset: */ &Waveforms[3008],
-		/* ampMod:     */ 1,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  28:      Electric Guitar (muted) */ {
-		/* waveOffset: */ &Waveforms[2624],
-		/* ampMod:     */ 1,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  29:            Overdriven Guitar */ {
-		/* waveOffset: */ &Waveforms[3030],
-		/* ampMod:     */ 5,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 200,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  30:            Distortion Guitar */ {
-		/* waveOffset: */ &Waveforms[3264],
-		/* ampMod:     */ 5,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 200,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  31:             Guitar Harmonics */ {
-		/* waveOffset: */ &Waveforms[2496],
-		/* ampMod:     */ 5,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 200,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  32:                Acoustic Bass */ {
-		/* waveOffset: */ &Waveforms[4480],
-		/* ampMod:     */ 1,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  33:       Electric Bass (finger) */ {
-		/* waveOffset: */ &Waveforms[4992],
-		/* ampMod:     */ 3,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  34:         Electric Bass (pick) */ {
-		/* waveOffset: */ &Waveforms[4992],
-		/* ampMod:     */ 3,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  35:                Fretless Bass */ {
-		/* waveOffset: */ &Waveforms[4992],
-		/* ampMod:     */ 3,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  36:                  Slap Bass 1 */ {
-		/* waveOffset: */ &Waveforms[4992],
-		/* ampMod:     */ 3,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  37:                  Slap Bass 2 */ {
-		/* waveOffset: */ &Waveforms[4992],
-		/* ampMod:     */ 3,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  38:                 Synth Bass 1 */ {
-		/* waveOffset: */ &Waveforms[5056],
-		/* ampMod:     */ 3,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  39:                 Synth Bass 2 */ {
-		/* waveOffset: */ &Waveforms[4608],
-		/* ampMod:     */ 3,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  40:                       Violin */ {
-		/* waveOffset: */ &Waveforms[5248],
-		/* ampMod:     */ 80,
-		/* freqMod:    */ 201,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  41:                        Viola */ {
-		/* waveOffset: */ &Waveforms[5312],
-		/* ampMod:     */ 80,
-		/* freqMod:    */ 201,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  42:                        Cello */ {
-		/* waveOffset: */ &Waveforms[5440],
-		/* ampMod:     */ 80,
-		/* freqMod:    */ 192,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  43:                   Contrabass */ {
-		/* waveOffset: */ &Waveforms[5248],
-		/* ampMod:     */ 3,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  44:              Tremolo Strings */ {
-		/* waveOffset: */ &Waveforms[5504],
-		/* ampMod:     */ 81,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  45:            Pizzicato Strings */ {
-		/* waveOffset: */ &Waveforms[5440],
-		/* ampMod:     */ 4,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  46:              Orchestral Harp */ {
-		/* waveOffset: */ &Waveforms[1344],
-		/* ampMod:     */ 1,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  47:                      Timpani */ {
-		/* waveOffset: */ &Waveforms[4352],
-		/* ampMod:     */ 1,
-		/* freqMod:    */ 195,
-		/* waveMod:    */ 192,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x016d],   42, 0x13, {  32512,   84 } },   /* program 41 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x0002],    0, 0x10, {      0,  -64 } },   /* program 00 */
+	},
+	/* 11:                   Rock Organ */ {
+		/* waveOffset: */ 1698,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x0167],   40, 0x13, {  14662,   80 } },   /* program 40 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x0002],    0, 0x10, {      0,  -64 } },   /* program 00 */
+	},
+	/* 12:                 Church Organ */ {
+		/* waveOffset: */ 1856,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x0167],   40, 0x13, {  14662,   80 } },   /* program 40 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x0002],    0, 0x10, {      0,  -64 } },   /* program 00 */
+	},
+	/* 13:                   Reed Organ */ {
+		/* waveOffset: */ 1792,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x0173],   36, 0x12, {  29332,   72 } },   /* program 42 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x0002],    0, 0x10, {      0,  -64 } },   /* program 00 */
+	},
+	/* 14:                    Accordion */ {
+		/* waveOffset: */ 2112,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x0167],   40, 0x13, {  14662,   80 } },   /* program 40 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x01e5],   64, 0x02, {  32512,   63 } },   /* program c6 */
+	},
+	/* 15:                    Harmonica */ {
+		/* waveOffset: */ 2240,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x0167],   40, 0x13, {  14662,   80 } },   /* program 40 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x0002],    0, 0x10, {      0,  -64 } },   /* program 00 */
+	},
+	/* 16:              Tango Accordion */ {
+		/* waveOffset: */ 2112,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x0167],   40, 0x13, {  14662,   80 } },   /* program 40 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x0002],    0, 0x10, {      0,  -64 } },   /* program 00 */
+	},
+	/* 17:      Acoustic Guitar (nylon) */ {
+		/* waveOffset: */ 2752,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x0149],   48, 0x44, {  29332,   96 } },   /* program 02 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x0002],    0, 0x10, {      0,  -64 } },   /* program 00 */
+	},
+	/* 18:      Acoustic Guitar (steel) */ {
+		/* waveOffset: */ 2816,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x0149],   48, 0x44, {  29332,   96 } },   /* program 02 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x0002],    0, 0x10, {      0,  -64 } },   /* program 00 */
+	},
+	/* 19:       Electric Guitar (jazz) */ {
+		/* waveOffset: */ 2670,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x0143],   48, 0x44, {  29332,   96 } },   /* program 01 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x0002],    0, 0x10, {      0,  -64 } },   /* program 00 */
+	},
+	/* 1a:      Electric Guitar (clean) */ {
+		/* waveOffset: */ 3008,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x0143],   48, 0x44, {  29332,   96 } },   /* program 01 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x0002],    0, 0x10, {      0,  -64 } },   /* program 00 */
+	},
+	/* 1b:      Electric Guitar (muted) */ {
+		/* waveOffset: */ 2624,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x0143],   48, 0x44, {  29332,   96 } },   /* program 01 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x0002],    0, 0x10, {      0,  -64 } },   /* program 00 */
+	},
+	/* 1c:            Overdriven Guitar */ {
+		/* waveOffset: */ 3030,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x015b],   36, 0x44, {   4885,   84 } },   /* program 05 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x0213],    0, 0x02, {    340,   64 } },   /* program c8 */
+	},
+	/* 1d:            Distortion Guitar */ {
+		/* waveOffset: */ 3264,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x015b],   36, 0x44, {   4885,   84 } },   /* program 05 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x0213],    0, 0x02, {    340,   64 } },   /* program c8 */
+	},
+	/* 1e:             Guitar Harmonics */ {
+		/* waveOffset: */ 2496,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x015b],   36, 0x44, {   4885,   84 } },   /* program 05 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x0213],    0, 0x02, {    340,   64 } },   /* program c8 */
+	},
+	/* 1f:                Acoustic Bass */ {
+		/* waveOffset: */ 4480,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x0143],   48, 0x44, {  29332,   96 } },   /* program 01 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x0002],    0, 0x10, {      0,  -64 } },   /* program 00 */
+	},
+	/* 20:       Electric Bass (finger) */ {
+		/* waveOffset: */ 4992,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x014f],   48, 0x44, {  29332,   96 } },   /* program 03 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x0002],    0, 0x10, {      0,  -64 } },   /* program 00 */
+	},
+	/* 21:                 Synth Bass 1 */ {
+		/* waveOffset: */ 5056,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x014f],   48, 0x44, {  29332,   96 } },   /* program 03 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x0002],    0, 0x10, {      0,  -64 } },   /* program 00 */
+	},
+	/* 22:                 Synth Bass 2 */ {
+		/* waveOffset: */ 4608,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x014f],   48, 0x44, {  29332,   96 } },   /* program 03 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x0002],    0, 0x10, {      0,  -64 } },   /* program 00 */
+	},
+	/* 23:                       Violin */ {
+		/* waveOffset: */ 5248,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x0197],    0, 0x24, {   2085,   72 } },   /* program 50 */
+		/* freqMod:    */ { &EnvelopeStages[0x0216],    0, 0x00, {   7331,   64 } },   /* program c9 */
+		/* waveMod:    */ { &EnvelopeStages[0x0002],    0, 0x10, {      0,  -64 } },   /* program 00 */
+	},
+	/* 24:                        Viola */ {
+		/* waveOffset: */ 5312,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x0197],    0, 0x24, {   2085,   72 } },   /* program 50 */
+		/* freqMod:    */ { &EnvelopeStages[0x0216],    0, 0x00, {   7331,   64 } },   /* program c9 */
+		/* waveMod:    */ { &EnvelopeStages[0x0002],    0, 0x10, {      0,  -64 } },   /* program 00 */
+	},
+	/* 25:                        Cello */ {
+		/* waveOffset: */ 5440,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x0197],    0, 0x24, {   2085,   72 } },   /* program 50 */
+		/* freqMod:    */ { &EnvelopeStages[0x021e],    0, 0x00, {   9770,   64 } },   /* program c0 */
+		/* waveMod:    */ { &EnvelopeStages[0x0002],    0, 0x10, {      0,  -64 } },   /* program 00 */
+	},
+	/* 26:                   Contrabass */ {
+		/* waveOffset: */ 5248,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x014f],   48, 0x44, {  29332,   96 } },   /* program 03 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x0002],    0, 0x10, {      0,  -64 } },   /* program 00 */
+	},
+	/* 27:              Tremolo Strings */ {
+		/* waveOffset: */ 5504,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x019d],    0, 0x24, {    893,   72 } },   /* program 51 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x0002],    0, 0x10, {      0,  -64 } },   /* program 00 */
+	},
+	/* 28:            Pizzicato Strings */ {
+		/* waveOffset: */ 5440,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x0155],   48, 0x44, {  29332,   96 } },   /* program 04 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x0002],    0, 0x10, {      0,  -64 } },   /* program 00 */
+	},
+	/* 29:              Orchestral Harp */ {
+		/* waveOffset: */ 1344,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x0143],   48, 0x44, {  29332,   96 } },   /* program 01 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x0002],    0, 0x10, {      0,  -64 } },   /* program 00 */
+	},
+	/* 2a:                      Timpani */ {
+		/* waveOffset: */ 4352,
 		/* xor:        */ 3,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  48:            String Ensemble 1 */ {
-		/* waveOffset: */ &Waveforms[4986],
-		/* ampMod:     */ 80,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  49:            String Ensemble 2 */ {
-		/* waveOffset: */ &Waveforms[5074],
-		/* ampMod:     */ 80,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  50:              Synth Strings 1 */ {
-		/* waveOffset: */ &Waveforms[9152],
-		/* ampMod:     */ 80,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  51:              Synth Strings 2 */ {
-		/* waveOffset: */ &Waveforms[9152],
-		/* ampMod:     */ 80,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  52:                   Choir Aahs */ {
-		/* waveOffset: */ &Waveforms[9216],
-		/* ampMod:     */ 74,
-		/* freqMod:    */ 252,
-		/* waveMod:    */ 209,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(8)
-	},
-	/*  53:                   Voice Oohs */ {
-		/* waveOffset: */ &Waveforms[9728],
-		/* ampMod:     */ 73,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 210,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  54:                  Synth Choir */ {
-		/* waveOffset: */ &Waveforms[9088],
-		/* ampMod:     */ 71,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 209,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  55:                Orchestra Hit */ {
-		/* waveOffset: */ &Waveforms[10368],
-		/* ampMod:     */ 128,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 208,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  56:                      Trumpet */ {
-		/* waveOffset: */ &Waveforms[5696],
-		/* ampMod:     */ 88,
-		/* freqMod:    */ 202,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(8)
-	},
-	/*  57:                     Trombone */ {
-		/* waveOffset: */ &Waveforms[5722],
-		/* ampMod:     */ 88,
-		/* freqMod:    */ 240,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(8)
-	},
-	/*  58:                         Tuba */ {
-		/* waveOffset: */ &Waveforms[6144],
-		/* ampMod:     */ 89,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 224,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  59:                Muted Trumpet */ {
-		/* waveOffset: */ &Waveforms[5888],
-		/* ampMod:     */ 88,
-		/* freqMod:    */ 202,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  60:                  French Horn */ {
-		/* waveOffset: */ &Waveforms[6464],
-		/* ampMod:     */ 88,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 206,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  61:                Brass Section */ {
-		/* waveOffset: */ &Waveforms[6784],
-		/* ampMod:     */ 88,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 206,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(8)
-	},
-	/*  62:                Synth Brass 1 */ {
-		/* waveOffset: */ &Waveforms[8512],
-		/* ampMod:     */ 87,
-		/* freqMod:    */ 201,
-		/* waveMod:    */ 204,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  63:                Synth Brass 2 */ {
-		/* waveOffset: */ &Waveforms[8512],
-		/* ampMod:     */ 87,
-		/* freqMod:    */ 192,
-		/* waveMod:    */ 205,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  64:                  Soprano Sax */ {
-		/* waveOffset: */ &Waveforms[6016],
-		/* ampMod:     */ 88,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  65:                     Alto Sax */ {
-		/* waveOffset: */ &Waveforms[7168],
-		/* ampMod:     */ 88,
-		/* freqMod:    */ 202,
-		/* waveMod:    */ 203,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(8)
-	},
-	/*  66:                    Tenor Sax */ {
-		/* waveOffset: */ &Waveforms[7168],
-		/* ampMod:     */ 88,
-		/* freqMod:    */ 202,
-		/* waveMod:    */ 203,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(8)
-	},
-	/*  67:                 Baritone Sax */ {
-		/* waveOffset: */ &Waveforms[7168],
-		/* ampMod:     */ 88,
-		/* freqMod:    */ 202,
-		/* waveMod:    */ 203,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(8)
-	},
-	/*  68:                         Oboe */ {
-		/* waveOffset: */ &Waveforms[7360],
-		/* ampMod:     */ 88,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  69:                 English Horn */ {
-		/* waveOffset: */ &Waveforms[7552],
-		/* ampMod:     */ 88,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  70:                      Bassoon */ {
-		/* waveOffset: */ &Waveforms[6070],
-		/* ampMod:     */ 88,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  71:                     Clarinet */ {
-		/* waveOffset: */ &Waveforms[7808],
-		/* ampMod:     */ 80,
-		/* freqMod:    */ 253,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  72:                      Piccolo */ {
-		/* waveOffset: */ &Waveforms[8192],
-		/* ampMod:     */ 73,
-		/* freqMod:    */ 240,
-		/* waveMod:    */ 202,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  73:                        Flute */ {
-		/* waveOffset: */ &Waveforms[8128],
-		/* ampMod:     */ 73,
-		/* freqMod:    */ 240,
-		/* waveMod:    */ 202,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  74:                     Recorder */ {
-		/* waveOffset: */ &Waveforms[4708],
-		/* ampMod:     */ 73,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  75:                    Pan Flute */ {
-		/* waveOffset: */ &Waveforms[8128],
-		/* ampMod:     */ 73,
-		/* freqMod:    */ 240,
-		/* waveMod:    */ 207,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  76:                 Blown bottle */ {
-		/* waveOffset: */ &Waveforms[8128],
-		/* ampMod:     */ 72,
-		/* freqMod:    */ 240,
-		/* waveMod:    */ 207,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  77:                   Shakuhachi */ {
-		/* waveOffset: */ &Waveforms[8236],
-		/* ampMod:     */ 72,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  78:                      Whistle */ {
-		/* waveOffset: */ &Waveforms[4480],
-		/* ampMod:     */ 80,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  79:                      Ocarina */ {
-		/* waveOffset: */ &Waveforms[4480],
-		/* ampMod:     */ 80,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  80:              Lead 1 (square) */ {
-		/* waveOffset: */ &Waveforms[8576],
-		/* ampMod:     */ 63,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  81:            Lead 2 (sawtooth) */ {
-		/* waveOffset: */ &Waveforms[8896],
-		/* ampMod:     */ 63,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 200,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  82:            Lead 3 (calliope) */ {
-		/* waveOffset: */ &Waveforms[8127],
-		/* ampMod:     */ 73,
-		/* freqMod:    */ 240,
-		/* waveMod:    */ 202,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  83:               Lead 4 (chiff) */ {
-		/* waveOffset: */ &Waveforms[8823],
-		/* ampMod:     */ 64,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  84:             Lead 5 (charang) */ {
-		/* waveOffset: */ &Waveforms[8861],
-		/* ampMod:     */ 64,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  85:               Lead 6 (voice) */ {
-		/* waveOffset: */ &Waveforms[9728],
-		/* ampMod:     */ 71,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  86:              Lead 7 (fifths) */ {
-		/* waveOffset: */ &Waveforms[8523],
-		/* ampMod:     */ 64,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  87:         Lead 8 (bass + lead) */ {
-		/* waveOffset: */ &Waveforms[8314],
-		/* ampMod:     */ 63,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  88:              Pad 1 (new age) */ {
-		/* waveOffset: */ &Waveforms[4473],
-		/* ampMod:     */ 72,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  89:                 Pad 2 (warm) */ {
-		/* waveOffset: */ &Waveforms[8107],
-		/* ampMod:     */ 72,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 59,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  90:            Pad 3 (polysynth) */ {
-		/* waveOffset: */ &Waveforms[8384],
-		/* ampMod:     */ 64,
-		/* freqMod:    */ 240,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  91:                Pad 4 (choir) */ {
-		/* waveOffset: */ &Waveforms[9856],
-		/* ampMod:     */ 72,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  92:                Pad 5 (bowed) */ {
-		/* waveOffset: */ &Waveforms[4480],
-		/* ampMod:     */ 72,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  93:             Pad 6 (metallic) */ {
-		/* waveOffset: */ &Waveforms[9760],
-		/* ampMod:     */ 72,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  94:                 Pad 7 (halo) */ {
-		/* waveOffset: */ &Waveforms[4480],
-		/* ampMod:     */ 72,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  95:                Pad 8 (sweep) */ {
-		/* waveOffset: */ &Waveforms[5184],
-		/* ampMod:     */ 72,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  96:                  FX 1 (rain) */ {
-		/* waveOffset: */ &Waveforms[4480],
-		/* ampMod:     */ 1,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  97:            FX 2 (soundtrack) */ {
-		/* waveOffset: */ &Waveforms[4480],
-		/* ampMod:     */ 1,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  98:               FX 3 (crystal) */ {
-		/* waveOffset: */ &Waveforms[4480],
-		/* ampMod:     */ 1,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/*  99:            FX 4 (atmosphere) */ {
-		/* waveOffset: */ &Waveforms[4480],
-		/* ampMod:     */ 1,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/* 100:            FX 5 (brightness) */ {
-		/* waveOffset: */ &Waveforms[4480],
-		/* ampMod:     */ 1,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/* 101:               FX 6 (goblins) */ {
-		/* waveOffset: */ &Waveforms[4480],
-		/* ampMod:     */ 1,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/* 102:                FX 7 (echoes) */ {
-		/* waveOffset: */ &Waveforms[4480],
-		/* ampMod:     */ 1,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/* 103:                FX 8 (sci-fi) */ {
-		/* waveOffset: */ &Waveforms[4480],
-		/* ampMod:     */ 1,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/* 104:                        Sitar */ {
-		/* waveOffset: */ &Waveforms[4480],
-		/* ampMod:     */ 1,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/* 105:                        Banjo */ {
-		/* waveOffset: */ &Waveforms[4480],
-		/* ampMod:     */ 1,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/* 106:                     Shamisen */ {
-		/* waveOffset: */ &Waveforms[4480],
-		/* ampMod:     */ 1,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/* 107:                         Koto */ {
-		/* waveOffset: */ &Waveforms[4480],
-		/* ampMod:     */ 1,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/* 108:                      Kalimba */ {
-		/* waveOffset: */ &Waveforms[4480],
-		/* ampMod:     */ 1,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/* 109:                      Bagpipe */ {
-		/* waveOffset: */ &Waveforms[4480],
-		/* ampMod:     */ 1,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/* 110:                       Fiddle */ {
-		/* waveOffset: */ &Waveforms[4480],
-		/* ampMod:     */ 1,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/* 111:                       Shanai */ {
-		/* waveOffset: */ &Waveforms[4480],
-		/* ampMod:     */ 1,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/* 112:                  Tinkle Bell */ {
-		/* waveOffset: */ &Waveforms[4480],
-		/* ampMod:     */ 1,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/* 113:                        Agogo */ {
-		/* waveOffset: */ &Waveforms[4480],
-		/* ampMod:     */ 1,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/* 114:                  Steel Drums */ {
-		/* waveOffset: */ &Waveforms[4480],
-		/* ampMod:     */ 1,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/* 115:                    Woodblock */ {
-		/* waveOffset: */ &Waveforms[4480],
-		/* ampMod:     */ 1,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/* 116:                   Taiko Drum */ {
-		/* waveOffset: */ &Waveforms[4480],
-		/* ampMod:     */ 1,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 7,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/* 117:                  Melodic Tom */ {
-		/* waveOffset: */ &Waveforms[4480],
-		/* ampMod:     */ 1,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 7,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/* 118:                   Synth Drum */ {
-		/* waveOffset: */ &Waveforms[4480],
-		/* ampMod:     */ 1,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x0143],   48, 0x44, {  29332,   96 } },   /* program 01 */
+		/* freqMod:    */ { &EnvelopeStages[0x0218],   80, 0x00, {  29332,   72 } },   /* program c3 */
+		/* waveMod:    */ { &EnvelopeStages[0x021e],    0, 0x00, {   9770,   64 } },   /* program c0 */
+	},
+	/* 2b:            String Ensemble 1 */ {
+		/* waveOffset: */ 4986,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x0197],    0, 0x24, {   2085,   72 } },   /* program 50 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x0002],    0, 0x10, {      0,  -64 } },   /* program 00 */
+	},
+	/* 2c:            String Ensemble 2 */ {
+		/* waveOffset: */ 5074,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x0197],    0, 0x24, {   2085,   72 } },   /* program 50 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x0002],    0, 0x10, {      0,  -64 } },   /* program 00 */
+	},
+	/* 2d:              Synth Strings 1 */ {
+		/* waveOffset: */ 9152,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x0197],    0, 0x24, {   2085,   72 } },   /* program 50 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x0002],    0, 0x10, {      0,  -64 } },   /* program 00 */
+	},
+	/* 2e:                   Choir Aahs */ {
+		/* waveOffset: */ 9216,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(8),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x018b],   10, 0x24, {   1452,   40 } },   /* program 4a */
+		/* freqMod:    */ { &EnvelopeStages[0x0200],   64, 0x02, {  32512,   67 } },   /* program fc */
+		/* waveMod:    */ { &EnvelopeStages[0x0115],    0, 0x02, {    703,   20 } },   /* program d1 */
+	},
+	/* 2f:                   Voice Oohs */ {
+		/* waveOffset: */ 9728,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x0185],    0, 0x24, {   1204,   72 } },   /* program 49 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x0002],    0, 0x00, {      0,  -64 } },   /* program d2 */
+	},
+	/* 30:                  Synth Choir */ {
+		/* waveOffset: */ 9088,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x0179],    0, 0x24, {   2926,   72 } },   /* program 47 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x0115],    0, 0x02, {    703,   20 } },   /* program d1 */
+	},
+	/* 31:                Orchestra Hit */ {
+		/* waveOffset: */ 10368,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x01bb],  127, 0x00, {  32512,  127 } },   /* program 80 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x01f4],    0, 0x02, {    634,  127 } },   /* program d0 */
+	},
+	/* 32:                      Trumpet */ {
+		/* waveOffset: */ 5696,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(8),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x01a9],    0, 0x13, {   3661,   72 } },   /* program 58 */
+		/* freqMod:    */ { &EnvelopeStages[0x0220],   16, 0x00, {   2436,   64 } },   /* program ca */
+		/* waveMod:    */ { &EnvelopeStages[0x0002],    0, 0x10, {      0,  -64 } },   /* program 00 */
+	},
+	/* 33:                     Trombone */ {
+		/* waveOffset: */ 5722,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(8),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x01a9],    0, 0x13, {   3661,   72 } },   /* program 58 */
+		/* freqMod:    */ { &EnvelopeStages[0x0111],   32, 0x10, {   2085,   70 } },   /* program f0 */
+		/* waveMod:    */ { &EnvelopeStages[0x0002],    0, 0x10, {      0,  -64 } },   /* program 00 */
+	},
+	/* 34:                         Tuba */ {
+		/* waveOffset: */ 6144,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x01af],    0, 0x13, {   2926,   80 } },   /* program 59 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x01fa],   48, 0x02, {    305,  127 } },   /* program e0 */
+	},
+	/* 35:                Muted Trumpet */ {
+		/* waveOffset: */ 5888,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x01a9],    0, 0x13, {   3661,   72 } },   /* program 58 */
+		/* freqMod:    */ { &EnvelopeStages[0x0220],   16, 0x00, {   2436,   64 } },   /* program ca */
+		/* waveMod:    */ { &EnvelopeStages[0x0002],    0, 0x10, {      0,  -64 } },   /* program 00 */
+	},
+	/* 36:                  French Horn */ {
+		/* waveOffset: */ 6464,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x01a9],    0, 0x13, {   3661,   72 } },   /* program 58 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x012d],   37, 0x13, {    549,   64 } },   /* program ce */
+	},
+	/* 37:                Brass Section */ {
+		/* waveOffset: */ 6784,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(8),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x01a9],    0, 0x13, {   3661,   72 } },   /* program 58 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x012d],   37, 0x13, {    549,   64 } },   /* program ce */
+	},
+	/* 38:                Synth Brass 1 */ {
+		/* waveOffset: */ 8512,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x01a3],    0, 0x13, {  14666,   84 } },   /* program 57 */
+		/* freqMod:    */ { &EnvelopeStages[0x0216],    0, 0x00, {   7331,   64 } },   /* program c9 */
+		/* waveMod:    */ { &EnvelopeStages[0x0135],   32, 0x02, {   2926,   65 } },   /* program cc */
+	},
+	/* 39:                Synth Brass 2 */ {
+		/* waveOffset: */ 8512,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x01a3],    0, 0x13, {  14666,   84 } },   /* program 57 */
+		/* freqMod:    */ { &EnvelopeStages[0x021e],    0, 0x00, {   9770,   64 } },   /* program c0 */
+		/* waveMod:    */ { &EnvelopeStages[0x0129],   16, 0x13, {    549,   64 } },   /* program cd */
+	},
+	/* 3a:                  Soprano Sax */ {
+		/* waveOffset: */ 6016,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x01a9],    0, 0x13, {   3661,   72 } },   /* program 58 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x0002],    0, 0x10, {      0,  -64 } },   /* program 00 */
+	},
+	/* 3b:                     Alto Sax */ {
+		/* waveOffset: */ 7168,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(8),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x01a9],    0, 0x13, {   3661,   72 } },   /* program 58 */
+		/* freqMod:    */ { &EnvelopeStages[0x0220],   16, 0x00, {   2436,   64 } },   /* program ca */
+		/* waveMod:    */ { &EnvelopeStages[0x01ee],    0, 0x02, {    525,   16 } },   /* program cb */
+	},
+	/* 3c:                         Oboe */ {
+		/* waveOffset: */ 7360,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x01a9],    0, 0x13, {   3661,   72 } },   /* program 58 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x0002],    0, 0x10, {      0,  -64 } },   /* program 00 */
+	},
+	/* 3d:                 English Horn */ {
+		/* waveOffset: */ 7552,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x01a9],    0, 0x13, {   3661,   72 } },   /* program 58 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x0002],    0, 0x10, {      0,  -64 } },   /* program 00 */
+	},
+	/* 3e:                      Bassoon */ {
+		/* waveOffset: */ 6070,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x01a9],    0, 0x13, {   3661,   72 } },   /* program 58 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x0002],    0, 0x10, {      0,  -64 } },   /* program 00 */
+	},
+	/* 3f:                     Clarinet */ {
+		/* waveOffset: */ 7808,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x0197],    0, 0x24, {   2085,   72 } },   /* program 50 */
+		/* freqMod:    */ { &EnvelopeStages[0x0203],   64, 0x02, {  32512,   66 } },   /* program fd */
+		/* waveMod:    */ { &EnvelopeStages[0x0002],    0, 0x10, {      0,  -64 } },   /* program 00 */
+	},
+	/* 40:                      Piccolo */ {
+		/* waveOffset: */ 8192,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x0185],    0, 0x24, {   1204,   72 } },   /* program 49 */
+		/* freqMod:    */ { &EnvelopeStages[0x0111],   32, 0x10, {   2085,   70 } },   /* program f0 */
+		/* waveMod:    */ { &EnvelopeStages[0x0220],   16, 0x00, {   2436,   64 } },   /* program ca */
+	},
+	/* 41:                        Flute */ {
+		/* waveOffset: */ 8128,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x0185],    0, 0x24, {   1204,   72 } },   /* program 49 */
+		/* freqMod:    */ { &EnvelopeStages[0x0111],   32, 0x10, {   2085,   70 } },   /* program f0 */
+		/* waveMod:    */ { &EnvelopeStages[0x0220],   16, 0x00, {   2436,   64 } },   /* program ca */
+	},
+	/* 42:                     Recorder */ {
+		/* waveOffset: */ 4708,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x0185],    0, 0x24, {   1204,   72 } },   /* program 49 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x0002],    0, 0x10, {      0,  -64 } },   /* program 00 */
+	},
+	/* 43:                    Pan Flute */ {
+		/* waveOffset: */ 8128,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x0185],    0, 0x24, {   1204,   72 } },   /* program 49 */
+		/* freqMod:    */ { &EnvelopeStages[0x0111],   32, 0x10, {   2085,   70 } },   /* program f0 */
+		/* waveMod:    */ { &EnvelopeStages[0x013c],    0, 0x13, {   4885,  127 } },   /* program cf */
+	},
+	/* 44:                 Blown bottle */ {
+		/* waveOffset: */ 8128,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x017f],    0, 0x12, {    955,   72 } },   /* program 48 */
+		/* freqMod:    */ { &EnvelopeStages[0x0111],   32, 0x10, {   2085,   70 } },   /* program f0 */
+		/* waveMod:    */ { &EnvelopeStages[0x013c],    0, 0x13, {   4885,  127 } },   /* program cf */
+	},
+	/* 45:                   Shakuhachi */ {
+		/* waveOffset: */ 8236,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x017f],    0, 0x12, {    955,   72 } },   /* program 48 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x0002],    0, 0x10, {      0,  -64 } },   /* program 00 */
+	},
+	/* 46:                      Whistle */ {
+		/* waveOffset: */ 4480,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x0197],    0, 0x24, {   2085,   72 } },   /* program 50 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x0002],    0, 0x10, {      0,  -64 } },   /* program 00 */
+	},
+	/* 47:              Lead 1 (square) */ {
+		/* waveOffset: */ 8576,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x0161],   36, 0x12, {  14666,   72 } },   /* program 3f */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x0002],    0, 0x10, {      0,  -64 } },   /* program 00 */
+	},
+	/* 48:            Lead 2 (sawtooth) */ {
+		/* waveOffset: */ 8896,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x0161],   36, 0x12, {  14666,   72 } },   /* program 3f */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x0213],    0, 0x02, {    340,   64 } },   /* program c8 */
+	},
+	/* 49:            Lead 3 (calliope) */ {
+		/* waveOffset: */ 8127,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x0185],    0, 0x24, {   1204,   72 } },   /* program 49 */
+		/* freqMod:    */ { &EnvelopeStages[0x0111],   32, 0x10, {   2085,   70 } },   /* program f0 */
+		/* waveMod:    */ { &EnvelopeStages[0x0220],   16, 0x00, {   2436,   64 } },   /* program ca */
+	},
+	/* 4a:               Lead 4 (chiff) */ {
+		/* waveOffset: */ 8823,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x0167],   40, 0x13, {  14662,   80 } },   /* program 40 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x0002],    0, 0x10, {      0,  -64 } },   /* program 00 */
+	},
+	/* 4b:             Lead 5 (charang) */ {
+		/* waveOffset: */ 8861,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x0167],   40, 0x13, {  14662,   80 } },   /* program 40 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x0002],    0, 0x10, {      0,  -64 } },   /* program 00 */
+	},
+	/* 4c:               Lead 6 (voice) */ {
+		/* waveOffset: */ 9728,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x0179],    0, 0x24, {   2926,   72 } },   /* program 47 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x0002],    0, 0x10, {      0,  -64 } },   /* program 00 */
+	},
+	/* 4d:              Lead 7 (fifths) */ {
+		/* waveOffset: */ 8523,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x0167],   40, 0x13, {  14662,   80 } },   /* program 40 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x0002],    0, 0x10, {      0,  -64 } },   /* program 00 */
+	},
+	/* 4e:         Lead 8 (bass + lead) */ {
+		/* waveOffset: */ 8314,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x0161],   36, 0x12, {  14666,   72 } },   /* program 3f */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x0002],    0, 0x10, {      0,  -64 } },   /* program 00 */
+	},
+	/* 4f:              Pad 1 (new age) */ {
+		/* waveOffset: */ 4473,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x017f],    0, 0x12, {    955,   72 } },   /* program 48 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x0002],    0, 0x10, {      0,  -64 } },   /* program 00 */
+	},
+	/* 50:                 Pad 2 (warm) */ {
+		/* waveOffset: */ 8107,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x017f],    0, 0x12, {    955,   72 } },   /* program 48 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x0002],    0, 0x00, {      0,  -64 } },   /* program 3b */
+	},
+	/* 51:            Pad 3 (polysynth) */ {
+		/* waveOffset: */ 8384,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x0167],   40, 0x13, {  14662,   80 } },   /* program 40 */
+		/* freqMod:    */ { &EnvelopeStages[0x0111],   32, 0x10, {   2085,   70 } },   /* program f0 */
+		/* waveMod:    */ { &EnvelopeStages[0x0002],    0, 0x10, {      0,  -64 } },   /* program 00 */
+	},
+	/* 52:                Pad 4 (choir) */ {
+		/* waveOffset: */ 9856,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x017f],    0, 0x12, {    955,   72 } },   /* program 48 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x0002],    0, 0x10, {      0,  -64 } },   /* program 00 */
+	},
+	/* 53:                Pad 5 (bowed) */ {
+		/* waveOffset: */ 4480,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x017f],    0, 0x12, {    955,   72 } },   /* program 48 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x0002],    0, 0x10, {      0,  -64 } },   /* program 00 */
+	},
+	/* 54:             Pad 6 (metallic) */ {
+		/* waveOffset: */ 9760,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x017f],    0, 0x12, {    955,   72 } },   /* program 48 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x0002],    0, 0x10, {      0,  -64 } },   /* program 00 */
+	},
+	/* 55:                Pad 8 (sweep) */ {
+		/* waveOffset: */ 5184,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x017f],    0, 0x12, {    955,   72 } },   /* program 48 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x0002],    0, 0x10, {      0,  -64 } },   /* program 00 */
+	},
+	/* 56:                   Taiko Drum */ {
+		/* waveOffset: */ 4480,
 		/* xor:        */ 7,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/* 119:               Reverse Cymbal */ {
-		/* waveOffset: */ &Waveforms[4096],
-		/* ampMod:     */ 112,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(1)
-	},
-	/* 120:            Guitar Fret Noise */ {
-		/* waveOffset: */ &Waveforms[4480],
-		/* ampMod:     */ 1,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/* 121:                 Breath Noise */ {
-		/* waveOffset: */ &Waveforms[4480],
-		/* ampMod:     */ 1,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/* 122:                     Seashore */ {
-		/* waveOffset: */ &Waveforms[4480],
-		/* ampMod:     */ 1,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/* 123:                   Bird Tweet */ {
-		/* waveOffset: */ &Waveforms[4480],
-		/* ampMod:     */ 1,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/* 124:               Telephone Ring */ {
-		/* waveOffset: */ &Waveforms[4480],
-		/* ampMod:     */ 1,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/* 125:                   Helicopter */ {
-		/* waveOffset: */ &Waveforms[4480],
-		/* ampMod:     */ 1,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/* 126:                     Applause */ {
-		/* waveOffset: */ &Waveforms[5093],
-		/* ampMod:     */ 75,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(1)
-	},
-	/* 127:                      Gunshot */ {
-		/* waveOffset: */ &Waveforms[4160],
-		/* ampMod:     */ 2,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(1)
-	},
-	/* 128:                  Bass Drum 2 */ {
-		/* waveOffset: */ &Waveforms[4416],
-		/* ampMod:     */ 128,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 192,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x0143],   48, 0x44, {  29332,   96 } },   /* program 01 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x0002],    0, 0x10, {      0,  -64 } },   /* program 00 */
+	},
+	/* 57:               Reverse Cymbal */ {
+		/* waveOffset: */ 4096,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(1),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x01b5],    0, 0x00, { -32512,    0 } },   /* program 70 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x0002],    0, 0x10, {      0,  -64 } },   /* program 00 */
+	},
+	/* 58:                     Applause */ {
+		/* waveOffset: */ 5093,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(1),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x0191],    0, 0x24, {    160,   40 } },   /* program 4b */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x0002],    0, 0x10, {      0,  -64 } },   /* program 00 */
+	},
+	/* 59:                      Gunshot */ {
+		/* waveOffset: */ 4160,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(1),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x0149],   48, 0x44, {  29332,   96 } },   /* program 02 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x0002],    0, 0x10, {      0,  -64 } },   /* program 00 */
+	},
+	/* 5a:                  Bass Drum 2 */ {
+		/* waveOffset: */ 4416,
 		/* xor:        */ 3,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/* 129:                  Bass Drum 1 */ {
-		/* waveOffset: */ &Waveforms[4416],
-		/* ampMod:     */ 128,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 192,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/* 130:           Side Stick/Rimshot */ {
-		/* waveOffset: */ &Waveforms[4160],
-		/* ampMod:     */ 130,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(1)
-	},
-	/* 131:                 Snare Drum 1 */ {
-		/* waveOffset: */ &Waveforms[4160],
-		/* ampMod:     */ 129,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 5,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(1)
-	},
-	/* 132:                    Hand Clap */ {
-		/* waveOffset: */ &Waveforms[4160],
-		/* ampMod:     */ 130,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(1)
-	},
-	/* 133:                 Snare Drum 2 */ {
-		/* waveOffset: */ &Waveforms[4160],
-		/* ampMod:     */ 129,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 5,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(1)
-	},
-	/* 134:                    Low Tom 2 */ {
-		/* waveOffset: */ &Waveforms[4416],
-		/* ampMod:     */ 128,
-		/* freqMod:    */ 2,
-		/* waveMod:    */ 3,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/* 135:                Closed Hi-hat */ {
-		/* waveOffset: */ &Waveforms[4160],
-		/* ampMod:     */ 130,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(3)
-	},
-	/* 136:                    Low Tom 1 */ {
-		/* waveOffset: */ &Waveforms[4416],
-		/* ampMod:     */ 128,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 4,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/* 137:                 Pedal Hi-hat */ {
-		/* waveOffset: */ &Waveforms[4160],
-		/* ampMod:     */ 130,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(3)
-	},
-	/* 138:                    Mid Tom 2 */ {
-		/* waveOffset: */ &Waveforms[4416],
-		/* ampMod:     */ 128,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 4,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/* 139:                  Open Hi-hat */ {
-		/* waveOffset: */ &Waveforms[4160],
-		/* ampMod:     */ 129,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(3)
-	},
-	/* 140:                    Mid Tom 1 */ {
-		/* waveOffset: */ &Waveforms[4416],
-		/* ampMod:     */ 128,
-		/* freqMod:    */ 2,
-		/* waveMod:    */ 3,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/* 141:                   High Tom 2 */ {
-		/* waveOffset: */ &Waveforms[4416],
-		/* ampMod:     */ 128,
-		/* freqMod:    */ 2,
-		/* waveMod:    */ 3,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/* 142:               Crash Cymbal 1 */ {
-		/* waveOffset: */ &Waveforms[3584],
-		/* ampMod:     */ 144,
-		/* freqMod:    */ 253,
-		/* waveMod:    */ 208,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/* 143:                   High Tom 1 */ {
-		/* waveOffset: */ &Waveforms[4416],
-		/* ampMod:     */ 128,
-		/* freqMod:    */ 2,
-		/* waveMod:    */ 3,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/* 144:                Ride Cymbal 1 */ {
-		/* waveOffset: */ &Waveforms[3727],
-		/* ampMod:     */ 145,
-		/* freqMod:    */ 253,
-		/* waveMod:    */ 208,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/* 145:               Chinese Cymbal */ {
-		/* waveOffset: */ &Waveforms[3584],
-		/* ampMod:     */ 144,
-		/* freqMod:    */ 254,
-		/* waveMod:    */ 208,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/* 146:                    Ride Bell */ {
-		/* waveOffset: */ &Waveforms[3795],
-		/* ampMod:     */ 4,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 208,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(2)
-	},
-	/* 147:                   Tambourine */ {
-		/* waveOffset: */ &Waveforms[3840],
-		/* ampMod:     */ 129,
-		/* freqMod:    */ 204,
-		/* waveMod:    */ 203,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(2)
-	},
-	/* 148:                Splash Cymbal */ {
-		/* waveOffset: */ &Waveforms[3648],
-		/* ampMod:     */ 144,
-		/* freqMod:    */ 253,
-		/* waveMod:    */ 208,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/* 149:                      Cowbell */ {
-		/* waveOffset: */ &Waveforms[4480],
-		/* ampMod:     */ 4,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 32,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/* 150:               Crash Cymbal 2 */ {
-		/* waveOffset: */ &Waveforms[3584],
-		/* ampMod:     */ 144,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 208,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/* 151:                   Vibra Slap */ {
-		/* waveOffset: */ &Waveforms[4480],
-		/* ampMod:     */ 4,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 32,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/* 152:                Ride Cymbal 2 */ {
-		/* waveOffset: */ &Waveforms[3840],
-		/* ampMod:     */ 145,
-		/* freqMod:    */ 253,
-		/* waveMod:    */ 208,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/* 153:                   High Bongo */ {
-		/* waveOffset: */ &Waveforms[4480],
-		/* ampMod:     */ 128,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 32,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/* 154:                    Low Bongo */ {
-		/* waveOffset: */ &Waveforms[4480],
-		/* ampMod:     */ 128,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 32,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/* 155:              Mute High Conga */ {
-		/* waveOffset: */ &Waveforms[4480],
-		/* ampMod:     */ 128,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 32,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/* 156:              Open High Conga */ {
-		/* waveOffset: */ &Waveforms[4480],
-		/* ampMod:     */ 128,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x01bb],  127, 0x00, {  32512,  127 } },   /* program 80 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x021e],    0, 0x00, {   9770,   64 } },   /* program c0 */
+	},
+	/* 5b:                  Bass Drum 1 */ {
+		/* waveOffset: */ 4416,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x01bb],  127, 0x00, {  32512,  127 } },   /* program 80 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x021e],    0, 0x00, {   9770,   64 } },   /* program c0 */
+	},
+	/* 5c:           Side Stick/Rimshot */ {
+		/* waveOffset: */ 4160,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(1),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x01c7],   48, 0x00, {  32512,   96 } },   /* program 82 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x0002],    0, 0x10, {      0,  -64 } },   /* program 00 */
+	},
+	/* 5d:                 Snare Drum 1 */ {
+		/* waveOffset: */ 4160,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(1),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x01c1],   48, 0x00, {  -5852,   96 } },   /* program 81 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x015b],   36, 0x44, {   4885,   84 } },   /* program 05 */
+	},
+	/* 5e:                    Low Tom 2 */ {
+		/* waveOffset: */ 4416,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x01bb],  127, 0x00, {  32512,  127 } },   /* program 80 */
+		/* freqMod:    */ { &EnvelopeStages[0x0149],   48, 0x44, {  29332,   96 } },   /* program 02 */
+		/* waveMod:    */ { &EnvelopeStages[0x014f],   48, 0x44, {  29332,   96 } },   /* program 03 */
+	},
+	/* 5f:                Closed Hi-hat */ {
+		/* waveOffset: */ 4160,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(3),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x01c7],   48, 0x00, {  32512,   96 } },   /* program 82 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x0002],    0, 0x10, {      0,  -64 } },   /* program 00 */
+	},
+	/* 60:                    Low Tom 1 */ {
+		/* waveOffset: */ 4416,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x01bb],  127, 0x00, {  32512,  127 } },   /* program 80 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x0155],   48, 0x44, {  29332,   96 } },   /* program 04 */
+	},
+	/* 61:                  Open Hi-hat */ {
+		/* waveOffset: */ 4160,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(3),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x01c1],   48, 0x00, {  -5852,   96 } },   /* program 81 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x0002],    0, 0x10, {      0,  -64 } },   /* program 00 */
+	},
+	/* 62:               Crash Cymbal 1 */ {
+		/* waveOffset: */ 3584,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x01d9],   99, 0x00, {    160,  100 } },   /* program 90 */
+		/* freqMod:    */ { &EnvelopeStages[0x0203],   64, 0x02, {  32512,   66 } },   /* program fd */
+		/* waveMod:    */ { &EnvelopeStages[0x01f4],    0, 0x02, {    634,  127 } },   /* program d0 */
+	},
+	/* 63:                Ride Cymbal 1 */ {
+		/* waveOffset: */ 3727,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x01df],   95, 0x00, {    148,   96 } },   /* program 91 */
+		/* freqMod:    */ { &EnvelopeStages[0x0203],   64, 0x02, {  32512,   66 } },   /* program fd */
+		/* waveMod:    */ { &EnvelopeStages[0x01f4],    0, 0x02, {    634,  127 } },   /* program d0 */
+	},
+	/* 64:               Chinese Cymbal */ {
+		/* waveOffset: */ 3584,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x01d9],   99, 0x00, {    160,  100 } },   /* program 90 */
+		/* freqMod:    */ { &EnvelopeStages[0x0000],   64, 0x02, {  32512,   65 } },   /* program fe */
+		/* waveMod:    */ { &EnvelopeStages[0x01f4],    0, 0x02, {    634,  127 } },   /* program d0 */
+	},
+	/* 65:                    Ride Bell */ {
+		/* waveOffset: */ 3795,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(2),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x0155],   48, 0x44, {  29332,   96 } },   /* program 04 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x01f4],    0, 0x02, {    634,  127 } },   /* program d0 */
+	},
+	/* 66:                   Tambourine */ {
+		/* waveOffset: */ 3840,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(2),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x01c1],   48, 0x00, {  -5852,   96 } },   /* program 81 */
+		/* freqMod:    */ { &EnvelopeStages[0x0135],   32, 0x02, {   2926,   65 } },   /* program cc */
+		/* waveMod:    */ { &EnvelopeStages[0x01ee],    0, 0x02, {    525,   16 } },   /* program cb */
+	},
+	/* 67:                Splash Cymbal */ {
+		/* waveOffset: */ 3648,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x01d9],   99, 0x00, {    160,  100 } },   /* program 90 */
+		/* freqMod:    */ { &EnvelopeStages[0x0203],   64, 0x02, {  32512,   66 } },   /* program fd */
+		/* waveMod:    */ { &EnvelopeStages[0x01f4],    0, 0x02, {    634,  127 } },   /* program d0 */
+	},
+	/* 68:                      Cowbell */ {
+		/* waveOffset: */ 4480,
 		/* xor:        */ 32,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/* 157:                    Low Conga */ {
-		/* waveOffset: */ &Waveforms[4480],
-		/* ampMod:     */ 128,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 32,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/* 158:                 High Timbale */ {
-		/* waveOffset: */ &Waveforms[4480],
-		/* ampMod:     */ 129,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 32,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/* 159:                  Low Timbale */ {
-		/* waveOffset: */ &Waveforms[4480],
-		/* ampMod:     */ 129,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 32,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/* 160:                   High Agogô */ {
-		/* waveOffset: */ &Waveforms[4480],
-		/* ampMod:     */ 129,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 32,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/* 161:                    Low Agogô */ {
-		/* waveOffset: */ &Waveforms[4480],
-		/* ampMod:     */ 129,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 32,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/* 162:                       Cabasa */ {
-		/* waveOffset: */ &Waveforms[3866],
-		/* ampMod:     */ 132,
-		/* freqMod:    */ 196,
-		/* waveMod:    */ 208,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(2)
-	},
-	/* 163:                      Maracas */ {
-		/* waveOffset: */ &Waveforms[4075],
-		/* ampMod:     */ 131,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(3)
-	},
-	/* 164:                Short Whistle */ {
-		/* waveOffset: */ &Waveforms[4480],
-		/* ampMod:     */ 1,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x0155],   48, 0x44, {  29332,   96 } },   /* program 04 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x0002],    0, 0x10, {      0,  -64 } },   /* program 00 */
+	},
+	/* 69:               Crash Cymbal 2 */ {
+		/* waveOffset: */ 3584,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x01d9],   99, 0x00, {    160,  100 } },   /* program 90 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x01f4],    0, 0x02, {    634,  127 } },   /* program d0 */
+	},
+	/* 6a:                Ride Cymbal 2 */ {
+		/* waveOffset: */ 3840,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x01df],   95, 0x00, {    148,   96 } },   /* program 91 */
+		/* freqMod:    */ { &EnvelopeStages[0x0203],   64, 0x02, {  32512,   66 } },   /* program fd */
+		/* waveMod:    */ { &EnvelopeStages[0x01f4],    0, 0x02, {    634,  127 } },   /* program d0 */
+	},
+	/* 6b:                   High Bongo */ {
+		/* waveOffset: */ 4480,
 		/* xor:        */ 32,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/* 165:                 Long Whistle */ {
-		/* waveOffset: */ &Waveforms[4480],
-		/* ampMod:     */ 1,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x01bb],  127, 0x00, {  32512,  127 } },   /* program 80 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x0002],    0, 0x10, {      0,  -64 } },   /* program 00 */
+	},
+	/* 6c:                 High Timbale */ {
+		/* waveOffset: */ 4480,
 		/* xor:        */ 32,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/* 166:                  Short Güiro */ {
-		/* waveOffset: */ &Waveforms[4480],
-		/* ampMod:     */ 4,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x01c1],   48, 0x00, {  -5852,   96 } },   /* program 81 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x0002],    0, 0x10, {      0,  -64 } },   /* program 00 */
+	},
+	/* 6d:                       Cabasa */ {
+		/* waveOffset: */ 3866,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(2),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x01d3],    0, 0x00, {   4885,   64 } },   /* program 84 */
+		/* freqMod:    */ { &EnvelopeStages[0x020e],   64, 0x02, {  32512,   66 } },   /* program c4 */
+		/* waveMod:    */ { &EnvelopeStages[0x01f4],    0, 0x02, {    634,  127 } },   /* program d0 */
+	},
+	/* 6e:                      Maracas */ {
+		/* waveOffset: */ 4075,
+		/* xor:        */ 0,
+		/* flags:      */ static_cast<InstrumentFlags>(3),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x01cd],    0, 0x00, {   7331,   68 } },   /* program 83 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x0002],    0, 0x10, {      0,  -64 } },   /* program 00 */
+	},
+	/* 6f:                Short Whistle */ {
+		/* waveOffset: */ 4480,
 		/* xor:        */ 32,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x0143],   48, 0x44, {  29332,   96 } },   /* program 01 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x0002],    0, 0x10, {      0,  -64 } },   /* program 00 */
 	},
-	/* 167:                   Long Güiro */ {
-		/* waveOffset: */ &Waveforms[4480],
-		/* ampMod:     */ 4,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
+	/* 70:                   Long Güiro */ {
+		/* waveOffset: */ 4480,
 		/* xor:        */ 0,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/* 168:                       Claves */ {
-		/* waveOffset: */ &Waveforms[4480],
-		/* ampMod:     */ 4,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 32,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/* 169:              High Wood Block */ {
-		/* waveOffset: */ &Waveforms[4480],
-		/* ampMod:     */ 4,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 32,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/* 170:               Low Wood Block */ {
-		/* waveOffset: */ &Waveforms[4480],
-		/* ampMod:     */ 4,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 32,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/* 171:                   Mute Cuíca */ {
-		/* waveOffset: */ &Waveforms[4480],
-		/* ampMod:     */ 4,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 32,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/* 172:                   Open Cuíca */ {
-		/* waveOffset: */ &Waveforms[4480],
-		/* ampMod:     */ 4,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 32,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/* 173:                Mute Triangle */ {
-		/* waveOffset: */ &Waveforms[4480],
-		/* ampMod:     */ 4,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 32,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
-	},
-	/* 174:                Open Triangle */ {
-		/* waveOffset: */ &Waveforms[4480],
-		/* ampMod:     */ 4,
-		/* freqMod:    */ 255,
-		/* waveMod:    */ 0,
-		/* xor:        */ 32,
-		/* flags:      */ static_cast<InstrumentFlags>(0)
+		/* flags:      */ static_cast<InstrumentFlags>(0),
+		/* variants:   */ 0x00,
+		/* ampMod:     */ { &EnvelopeStages[0x0155],   48, 0x44, {  29332,   96 } },   /* program 04 */
+		/* freqMod:    */ { &EnvelopeStages[0x0002],   64, 0x00, {      0,  -64 } },   /* program ff */
+		/* waveMod:    */ { &EnvelopeStages[0x0002],    0, 0x10, {      0,  -64 } },   /* program 00 */
 	},
 };
 
+static constexpr uint8_t instruments[] PROGMEM = {
+	/*   0:         Acoustic Grand Piano */ 0x00,
+	/*   1:        Bright Acoustic Piano */ 0x01,
+	/*   2:         Electric Grand Piano */ 0x02,
+	/*   3:             Honky-tonk Piano */ 0x03,
+	/*   4:             Electric Piano 1 */ 0x04,
+	/*   5:             Electric Piano 2 */ 0x05,
+	/*   6:                  Harpsichord */ 0x06,
+	/*   7:                     Clavinet */ 0x07,
+	/*   8:                      Celesta */ 0x08,
+	/*   9:                 Glockenspiel */ 0x09,
+	/*  10:                    Music Box */ 0x0a,
+	/*  11:                   Vibraphone */ 0x0b,
+	/*  12:                      Marimba */ 0x0c,
+	/*  13:                    Xylophone */ 0x0d,
+	/*  14:                Tubular Bells */ 0x0d,
+	/*  15:                     Dulcimer */ 0x0e,
+	/*  16:                Drawbar Organ */ 0x0f,
+	/*  17:             Percussive Organ */ 0x10,
+	/*  18:                   Rock Organ */ 0x11,
+	/*  19:                 Church Organ */ 0x12,
+	/*  20:                   Reed Organ */ 0x13,
+	/*  21:                    Accordion */ 0x14,
+	/*  22:                    Harmonica */ 0x15,
+	/*  23:              Tango Accordion */ 0x16,
+	/*  24:      Acoustic Guitar (nylon) */ 0x17,
+	/*  25:      Acoustic Guitar (steel) */ 0x18,
+	/*  26:       Electric Guitar (jazz) */ 0x19,
+	/*  27:      Electric Guitar (clean) */ 0x1a,
+	/*  28:      Electric Guitar (muted) */ 0x1b,
+	/*  29:            Overdriven Guitar */ 0x1c,
+	/*  30:            Distortion Guitar */ 0x1d,
+	/*  31:             Guitar Harmonics */ 0x1e,
+	/*  32:                Acoustic Bass */ 0x1f,
+	/*  33:       Electric Bass (finger) */ 0x20,
+	/*  34:         Electric Bass (pick) */ 0x20,
+	/*  35:                Fretless Bass */ 0x20,
+	/*  36:                  Slap Bass 1 */ 0x20,
+	/*  37:                  Slap Bass 2 */ 0x20,
+	/*  38:                 Synth Bass 1 */ 0x21,
+	/*  39:                 Synth Bass 2 */ 0x22,
+	/*  40:                       Violin */ 0x23,
+	/*  41:                        Viola */ 0x24,
+	/*  42:                        Cello */ 0x25,
+	/*  43:                   Contrabass */ 0x26,
+	/*  44:              Tremolo Strings */ 0x27,
+	/*  45:            Pizzicato Strings */ 0x28,
+	/*  46:              Orchestral Harp */ 0x29,
+	/*  47:                      Timpani */ 0x2a,
+	/*  48:            String Ensemble 1 */ 0x2b,
+	/*  49:            String Ensemble 2 */ 0x2c,
+	/*  50:              Synth Strings 1 */ 0x2d,
+	/*  51:              Synth Strings 2 */ 0x2d,
+	/*  52:                   Choir Aahs */ 0x2e,
+	/*  53:                   Voice Oohs */ 0x2f,
+	/*  54:                  Synth Choir */ 0x30,
+	/*  55:                Orchestra Hit */ 0x31,
+	/*  56:                      Trumpet */ 0x32,
+	/*  57:                     Trombone */ 0x33,
+	/*  58:                         Tuba */ 0x34,
+	/*  59:                Muted Trumpet */ 0x35,
+	/*  60:                  French Horn */ 0x36,
+	/*  61:                Brass Section */ 0x37,
+	/*  62:                Synth Brass 1 */ 0x38,
+	/*  63:                Synth Brass 2 */ 0x39,
+	/*  64:                  Soprano Sax */ 0x3a,
+	/*  65:                     Alto Sax */ 0x3b,
+	/*  66:                    Tenor Sax */ 0x3b,
+	/*  67:                 Baritone Sax */ 0x3b,
+	/*  68:                         Oboe */ 0x3c,
+	/*  69:                 English Horn */ 0x3d,
+	/*  70:                      Bassoon */ 0x3e,
+	/*  71:                     Clarinet */ 0x3f,
+	/*  72:                      Piccolo */ 0x40,
+	/*  73:                        Flute */ 0x41,
+	/*  74:                     Recorder */ 0x42,
+	/*  75:                    Pan Flute */ 0x43,
+	/*  76:                 Blown bottle */ 0x44,
+	/*  77:                   Shakuhachi */ 0x45,
+	/*  78:                      Whistle */ 0x46,
+	/*  79:                      Ocarina */ 0x46,
+	/*  80:              Lead 1 (square) */ 0x47,
+	/*  81:            Lead 2 (sawtooth) */ 0x48,
+	/*  82:            Lead 3 (calliope) */ 0x49,
+	/*  83:               Lead 4 (chiff) */ 0x4a,
+	/*  84:             Lead 5 (charang) */ 0x4b,
+	/*  85:               Lead 6 (voice) */ 0x4c,
+	/*  86:              Lead 7 (fifths) */ 0x4d,
+	/*  87:         Lead 8 (bass + lead) */ 0x4e,
+	/*  88:              Pad 1 (new age) */ 0x4f,
+	/*  89:                 Pad 2 (warm) */ 0x50,
+	/*  90:            Pad 3 (polysynth) */ 0x51,
+	/*  91:                Pad 4 (choir) */ 0x52,
+	/*  92:                Pad 5 (bowed) */ 0x53,
+	/*  93:             Pad 6 (metallic) */ 0x54,
+	/*  94:                 Pad 7 (halo) */ 0x53,
+	/*  95:                Pad 8 (sweep) */ 0x55,
+	/*  96:                  FX 1 (rain) */ 0x1f,
+	/*  97:            FX 2 (soundtrack) */ 0x1f,
+	/*  98:               FX 3 (crystal) */ 0x1f,
+	/*  99:            FX 4 (atmosphere) */ 0x1f,
+	/* 100:            FX 5 (brightness) */ 0x1f,
+	/* 101:               FX 6 (goblins) */ 0x1f,
+	/* 102:                FX 7 (echoes) */ 0x1f,
+	/* 103:                FX 8 (sci-fi) */ 0x1f,
+	/* 104:                        Sitar */ 0x1f,
+	/* 105:                        Banjo */ 0x1f,
+	/* 106:                     Shamisen */ 0x1f,
+	/* 107:                         Koto */ 0x1f,
+	/* 108:                      Kalimba */ 0x1f,
+	/* 109:                      Bagpipe */ 0x1f,
+	/* 110:                       Fiddle */ 0x1f,
+	/* 111:                       Shanai */ 0x1f,
+	/* 112:                  Tinkle Bell */ 0x1f,
+	/* 113:                        Agogo */ 0x1f,
+	/* 114:                  Steel Drums */ 0x1f,
+	/* 115:                    Woodblock */ 0x1f,
+	/* 116:                   Taiko Drum */ 0x56,
+	/* 117:                  Melodic Tom */ 0x56,
+	/* 118:                   Synth Drum */ 0x56,
+	/* 119:               Reverse Cymbal */ 0x57,
+	/* 120:            Guitar Fret Noise */ 0x1f,
+	/* 121:                 Breath Noise */ 0x1f,
+	/* 122:                     Seashore */ 0x1f,
+	/* 123:                   Bird Tweet */ 0x1f,
+	/* 124:               Telephone Ring */ 0x1f,
+	/* 125:                   Helicopter */ 0x1f,
+	/* 126:                     Applause */ 0x58,
+	/* 127:                      Gunshot */ 0x59,
+	/* 128:                  Bass Drum 2 */ 0x5a,
+	/* 129:                  Bass Drum 1 */ 0x5b,
+	/* 130:           Side Stick/Rimshot */ 0x5c,
+	/* 131:                 Snare Drum 1 */ 0x5d,
+	/* 132:                    Hand Clap */ 0x5c,
+	/* 133:                 Snare Drum 2 */ 0x5d,
+	/* 134:                    Low Tom 2 */ 0x5e,
+	/* 135:                Closed Hi-hat */ 0x5f,
+	/* 136:                    Low Tom 1 */ 0x60,
+	/* 137:                 Pedal Hi-hat */ 0x5f,
+	/* 138:                    Mid Tom 2 */ 0x60,
+	/* 139:                  Open Hi-hat */ 0x61,
+	/* 140:                    Mid Tom 1 */ 0x5e,
+	/* 141:                   High Tom 2 */ 0x5e,
+	/* 142:               Crash Cymbal 1 */ 0x62,
+	/* 143:                   High Tom 1 */ 0x5e,
+	/* 144:                Ride Cymbal 1 */ 0x63,
+	/* 145:               Chinese Cymbal */ 0x64,
+	/* 146:                    Ride Bell */ 0x65,
+	/* 147:                   Tambourine */ 0x66,
+	/* 148:                Splash Cymbal */ 0x67,
+	/* 149:                      Cowbell */ 0x68,
+	/* 150:               Crash Cymbal 2 */ 0x69,
+	/* 151:                   Vibra Slap */ 0x68,
+	/* 152:                Ride Cymbal 2 */ 0x6a,
+	/* 153:                   High Bongo */ 0x6b,
+	/* 154:                    Low Bongo */ 0x6b,
+	/* 155:              Mute High Conga */ 0x6b,
+	/* 156:              Open High Conga */ 0x6b,
+	/* 157:                    Low Conga */ 0x6b,
+	/* 158:                 High Timbale */ 0x6c,
+	/* 159:                  Low Timbale */ 0x6c,
+	/* 160:                   High Agogô */ 0x6c,
+	/* 161:                    Low Agogô */ 0x6c,
+	/* 162:                       Cabasa */ 0x6d,
+	/* 163:                      Maracas */ 0x6e,
+	/* 164:                Short Whistle */ 0x6f,
+	/* 165:                 Long Whistle */ 0x6f,
+	/* 166:                  Short Güiro */ 0x68,
+	/* 167:                   Long Güiro */ 0x70,
+	/* 168:                       Claves */ 0x68,
+	/* 169:              High Wood Block */ 0x68,
+	/* 170:               Low Wood Block */ 0x68,
+	/* 171:                   Mute Cuíca */ 0x68,
+	/* 172:                   Open Cuíca */ 0x68,
+	/* 173:                Mute Triangle */ 0x68,
+	/* 174:                Open Triangle */ 0x68,
+};
+
 static constexpr uint8_t percussionNotes[] PROGMEM = {
 	/* 35:        Bass Drum 2 */ 0x1f,
 	/* 36:        Bass Drum 1 */ 0x1f,
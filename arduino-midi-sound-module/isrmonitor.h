@@ -0,0 +1,127 @@
+/*
+    ISR overrun monitor
+    https://github.com/DLehenbauer/arduino-midi-sound-module
+
+    Optional detector for CPU overload, enabled by defining 'ISR_MONITOR'.
+
+    If 'Synth::isr()' takes longer than the sampling interval, Timer2 raises the next compare match
+    before the ISR returns and the following sample is output late (i.e., the output sample rate
+    silently drifts below 'Synth::sampleRate').  At exit, the monitor reads TCNT2, which counts Timer2
+    ticks (8 cycles each) since the compare match that raised the ISR, to record:
+
+      - The longest time from compare match to ISR exit.  This includes the interrupt latency (e.g.,
+        while the main loop has suspended the ISR) and any nested USART RX ISRs.
+      - The number of overruns (i.e., ISRs that ended after the next compare match.)
+
+    Durations longer than two sampling intervals can not be distinguished, and are recorded as the
+    longest measurable duration.
+
+    If 'ISR_OVERRUN_PIN' is also defined (e.g., '-DISR_OVERRUN_PIN=PinId::D2'), the pin is driven high
+    for ~0.2s after each overrun so that overload can be observed in the field with an LED or scope.
+
+    The counters are read and reset via sysex (see 'sysex.h'), or by the periodic telemetry reports
+    if enabled (see 'telemetry.h').  The sysex reply to 'F0 7D 04 F7' is:
+
+                F0 7D 05 <maxCycles: 3B> <overruns: 3B> <periodCycles: 3B> F7
+
+    When 'ISR_MONITOR' is not defined, 'Synth' uses 'NoIsrMonitor', whose methods are empty.
+*/
+
+#ifndef __ISRMONITOR_H__
+#define __ISRMONITOR_H__
+
+#include <stdint.h>
+#include <avr/interrupt.h>
+#include <avr/io.h>
+#include "pin.h"
+#include "sysex.h"
+
+class IsrMonitor final {
+  private:
+    static constexpr uint8_t cyclesPerTick = 8;         // Timer2 prescaler (see 'Synth::begin()').
+    static constexpr uint8_t flashFrames = 16;          // Frames the overrun pin remains high (~0.2s).
+
+    static volatile uint8_t  v_maxTicks;                // Longest ISR, measured from compare match to exit.
+    static volatile uint16_t v_overruns;                // ISRs that ended after the next compare match.
+    static volatile uint8_t  v_flash;                   // Frames remaining before the overrun pin is lowered.
+
+  public:
+    static void setup() {
+    #ifdef ISR_OVERRUN_PIN
+      Pin<ISR_OVERRUN_PIN>().output();
+    #endif
+    }
+
+    // Called at the end of the ISR, where 'top' is the value of OCR2A.
+    static void exit(uint8_t top) __attribute__((always_inline)) {
+      uint8_t ticks = TCNT2;
+      if (TIFR2 & _BV(OCF2A)) {                         // If the next compare match has already occurred, the next sample
+        ticks = ticks < (top >> 1)                      // is late.  (If TCNT2 was read just before the match, the count
+          ? ticks + top + 1                             // has not yet wrapped.)
+          : top + 1;
+        v_overruns++;
+
+      #ifdef ISR_OVERRUN_PIN
+        Pin<ISR_OVERRUN_PIN>().high();
+        v_flash = flashFrames;
+      #endif
+      }
+
+      if (ticks > v_maxTicks) {
+        v_maxTicks = ticks;
+      }
+    }
+
+    // Called by the ISR once per frame (see 'Synth::getFrame()').
+    static void frame() __attribute__((always_inline)) {
+    #ifdef ISR_OVERRUN_PIN
+      if (v_flash != 0 && --v_flash == 0) {
+        Pin<ISR_OVERRUN_PIN>().low();
+      }
+    #endif
+    }
+
+    // Returns the longest ISR (in CPU cycles) and the number of overruns since the previous call, and
+    // resets the counters.
+    static void take(uint16_t& maxCycles, uint16_t& overruns) {
+      cli();
+      const uint8_t maxTicks = v_maxTicks;
+      overruns = v_overruns;
+      v_maxTicks = 0;
+      v_overruns = 0;
+      sei();
+
+      maxCycles = static_cast<uint16_t>(maxTicks) * cyclesPerTick;
+    }
+
+    // Sends the sysex reply described above one byte at a time via 'send(byte)', and resets the
+    // counters.  'top' is the value of OCR2A.
+    template <typename TSend>
+    static void dump(uint8_t top, TSend send) {
+      uint16_t maxCycles, overruns;
+      take(maxCycles, overruns);
+
+      send(0xF0);
+      send(Sysex_Id);
+      send(Sysex_IsrStatsReply);
+      sendSysex7(send, maxCycles, 3);
+      sendSysex7(send, overruns, 3);
+      sendSysex7(send, static_cast<uint16_t>(top + 1) * cyclesPerTick, 3);
+      send(0xF7);
+    }
+};
+
+volatile uint8_t  IsrMonitor::v_maxTicks = 0;
+volatile uint16_t IsrMonitor::v_overruns = 0;
+volatile uint8_t  IsrMonitor::v_flash = 0;
+
+// Used in place of 'IsrMonitor' when 'ISR_MONITOR' is not defined.
+class NoIsrMonitor final {
+  public:
+    static void setup() { /* do nothing */ }
+    static void exit(uint8_t) __attribute__((always_inline)) { /* do nothing */ }
+    static void frame() __attribute__((always_inline)) { /* do nothing */ }
+    template <typename TSend> static void dump(uint8_t, TSend) { /* do nothing */ }
+};
+
+#endif //__ISRMONITOR_H__
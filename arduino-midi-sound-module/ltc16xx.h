@@ -53,6 +53,9 @@ class Ltc16xx final {
     static Spi<csPin> _spi;
   
   public:
+    static constexpr bool usesSpi = true;             // The display must wait for the ISR to release the SPI bus.
+    static constexpr bool isStereo = false;
+
     static void setup() { _spi.setup(); }
   
     static void sendHiByte() {
@@ -11,11 +11,21 @@
     Ltc16xx:  +18B
     Pwm1:     +32B
     Pwm01:    +72B
+
+    (Run 'build-avr.sh' for the current flash / SRAM usage of each variant, broken down by symbol.)
 */
 
 //#define DAC Pwm1
 //#define DAC Pwm01
 //#define DAC Ltc16xx<PinId::D10>
+//#define DAC Mcp4822<PinId::D10>                 // Stereo (see 'mcp4822.h')
+//#define DAC StereoPair<Pwm0, Pwm1>              // Stereo (see 'dacpair.h')
+
+//#define WAVETABLE_SEGMENTS      // Store only the unique pages of the wavetable (see 'instruments.h', saves ~8.5KB)
+//#define VOICE_STATS             // Collect voice usage counters, readable via sysex (see 'voicestats.h')
+//#define ISR_MONITOR             // Detect ISR overruns, readable via sysex (see 'isrmonitor.h')
+//#define ISR_OVERRUN_PIN PinId::D2   // Drive a pin high after each overrun (requires ISR_MONITOR)
+//#define TELEMETRY               // Send periodic health reports via USART TX (see 'telemetry.h')
 
 #ifndef ARDUINO
 #ifndef __EMSCRIPTEN__
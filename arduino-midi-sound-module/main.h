@@ -12,18 +12,42 @@
   #define MIDI_BAUD 31250
 #endif
 
+#ifdef TELEMETRY
+  #define ISR_MONITOR                       // Telemetry reports include the ISR duration (see 'isrmonitor.h').
+#endif
+
+#if defined(VOICE_STATS) || defined(ISR_MONITOR)
+  #define MIDI_TX                           // Diagnostics are sent via USART TX (see 'Midi::send()').
+#endif
+
 #include <stdint.h>
 #include "midi.h"
 #include "ssd1306.h"
+#include "bargraph.h"
+#include "meter.h"
 #include "midisynth.h"
 
-Ssd1306</* rotate 180: */ true> display;    // SSD1306 driver for 128x64 OLED SPI display
+#ifdef TELEMETRY
+  #include "telemetry.h"
+#endif
+
+typedef Ssd1306</* rotate 180: */ true> Display;
+
+Display display;                            // SSD1306 driver for 128x64 OLED SPI display
+BarGraph<Display> bars(display);            // Incrementally updated bar graph of voice amplitudes
+Meter<MidiSynth> meter;                     // Per-voice peak/decay levels displayed by the bar graph
 MidiSynth synth;
 
-// The below thunks are invoked during Midi::Dispatch() and forwarded to our MidiSynth.
+#ifdef TELEMETRY
+Telemetry<MidiSynth> telemetry;             // Periodic health reports sent via USART TX
+#endif
+
+// The below thunks are invoked during Midi::Dispatch() and forwarded to our MidiSynth.  ('noteOn()' is
+// not inlined, so that 'host/avrsim.cpp' can measure the cycles per note-on with '-f _Z6noteOnhhh'.)
+__attribute__((noinline))
 void noteOn(uint8_t channel, uint8_t note, uint8_t velocity)		    { synth.midiNoteOn(channel, note, velocity); }
 void noteOff(uint8_t channel, uint8_t note)							            { synth.midiNoteOff(channel, note); }
-void sysex(uint8_t cbData, uint8_t data[])							            { /* do nothing */ }
+void sysex(uint8_t cbData, uint8_t data[])							            { synth.midiSysex(cbData, data, Midi::send); }
 void controlChange(uint8_t channel, uint8_t control, uint8_t value) { synth.midiControlChange(channel, control, value); }
 void programChange(uint8_t channel, uint8_t value)					        { synth.midiProgramChange(channel, value); }
 void pitchBend(uint8_t channel, int16_t value)						          { synth.midiPitchBend(channel, value); }
@@ -41,18 +65,6 @@ void setup() {
   sei();                                  // Begin processing interrupts.
 }
 
-// Helper used by main 'loop()' to set each column of an 8x7 block of pixels to the given mask,
-// and then dispatch any MIDI messages that were queued while the SPI transfer was in progress.
-//
-// Note: Because this is the only call to 'display.send7()', AVR8/GNU C Compiler v5.4.0 will
-//       inline it (even with -Os), and then jump into Midi::dispatch().
-void display_send7(uint8_t mask) {
-  synth.suspend();                            // Suspend audio processing ISR so display has exclusive access to SPI.
-  display.set7x8(mask);                       // Set first 7 columns of currently selected 8x8 block to given 'mask'.
-  synth.resume();                             // Resume audio processing.
-  Midi::dispatch();                           // (Drain the pending queue of MIDI messages)
-}
-
 // There are four activities happening concurrently, roughly in priority order:
 //
 //    1. The USART RX ISR started by Midi::begin() is queuing incoming bytes from the serial port
@@ -63,37 +75,32 @@ void display_send7(uint8_t mask) {
 //
 //    3. The main 'loop()' below interleaves the following two activities:
 //        a. Handling the MIDI messages queued by the USART RX ISR by updating the state of the synth.
-//        b. Updating the bar graph on the OLED display with the current amplitude of each voice.
+//        b. Updating the bar graph on the OLED display with the peak amplitude of each voice.
 //
 void loop() {
-  static uint8_t voice = 0;                   // Each time through the loop, we update the bar for one voice (in
-  voice++;                                    // round-robin order.)
-  voice &= 0x0F;
+  if (meter.update(synth)) {                  // At the meter's frame rate, collect the peak amplitudes recorded by
+    for (int8_t voice = MidiSynth::maxVoice; voice >= 0; voice--) {     // the ISR and update the bar heights.
+      bars.set(voice, meter.getLevel(voice), meter.getHold(voice)); // (Only bars whose height changed are redrawn.)
+    }
+  }
 
-  uint8_t y = synth.getAmp(voice);            // The height of the bar is equal to 1.5x the current amplitude,
-  y += y >> 1;                                // with a maximum of 64px (i.e., [0..63])
-  y &= 0x3F;
-  
-  const uint8_t x = voice << 3;               // Calculate the left edge of the bar from the voice index.
-  const int8_t page = 7 - (y >> 3);           // Calculate the 8px page that contains 'y'.
   Midi::dispatch();                           // (Drain the pending queue of MIDI messages)
-  
-  synth.suspend();                            // Suspend audio processing ISR so display has exclusive access to SPI.
-  display.select(x, x + 6, 0, 7);             // Select the 7px x 64px area of the display containing the current bar.
-  synth.resume();                             // Resume audio processing.
-  
-  for (int8_t i = page; i > 0; i--) {         // Clear 7x8 blocks above the new bar graph's current level.
-    display_send7(0x00);
-  }
 
-  {                                           // Set/Clear the pixel of the 7x8 block containing the current bar graph level.
-    const uint8_t remainder = 7 - (y & 0x07);
-    display_send7(~((1 << remainder) - 1));
-  }
+  synth.updateStats();                        // Collect voice usage counters (only if built with VOICE_STATS).
 
-  for (int8_t i = 6 - page; i >= 0; i--) {    // Set 7x8 blocks under the new bar graph's current level.
-    display_send7(0xFF);
-  }
+#ifdef TELEMETRY
+  telemetry.update(synth);                    // Periodically queue a telemetry report for USART TX.
+#endif
+
+  if (MidiSynth::Dac::usesSpi) {              // If the DAC shares the SPI bus with the display, suspend the audio
+    synth.suspend();                          // ISR only for the duration of a single byte, and deselect the display
+    bars.poll();                              // before resuming, so it ignores the DAC's bytes.
+    bars.flush();
+    bars.release();
+    synth.resume();
+  } else {                                    // Otherwise, the display has exclusive access to SPI and we can push
+    bars.poll();                              // the next byte without suspending audio processing or waiting for
+  }                                           // the transfer to complete.
 }
 
 #endif /* MAIN_H_ */
@@ -0,0 +1,85 @@
+/*
+    Driver for MCP4822 dual 12-bit serial DAC (stereo)
+    https://github.com/DLehenbauer/arduino-midi-sound-module
+
+    DANGER: Like 'Ltc16xx', this driver does not wait for the SPI end-of-transmission flag before
+            selecting the slave device or transmitting.  The sample/mix/output ISR in synth.h ensures
+            sufficient clock cycles pass between calls by interleaving them with mixing work.
+
+    Each channel is transmitted as a separate 16-bit command, latched when CS returns high:
+
+        bit  15:      Channel (0 = A/left, 1 = B/right)
+        bit  14:      (ignored)
+        bit  13:      Gain (1 = 1x, i.e. 2.048V full scale)
+        bit  12:      Shutdown (1 = active)
+        bits 11..0:   Data
+
+        MCP4822 12-bit dual R2R SPI DAC
+        http://ww1.microchip.com/downloads/en/DeviceDoc/20002249B.pdf
+
+    Connection to Arduino Uno (assuming using pin 10 for CS):
+
+                       .------.
+            +5v >----1-|      |-8----> VoutA (left)
+         pin 10 >----2-|  U1  |-7----< gnd
+         pin 13 >----3-|      |-6----> VoutB (right)
+         pin 11 >----4-|      |-5----< gnd (LDAC)
+                       '------'
+
+    (Follow each output with the same RC filter and coupling capacitor as 'ltc16xx.h'.)
+*/
+
+#ifndef MCP4822_H_
+#define MCP4822_H_
+
+#include "spi.h"
+
+template<PinId csPin>
+class Mcp4822 final {
+  private:
+    static constexpr uint8_t _configA = 0x30;       // Channel A, 1x gain, active
+    static constexpr uint8_t _configB = 0xB0;       // Channel B, 1x gain, active
+
+    static uint16_t _left;
+    static uint16_t _right;
+    static Spi<csPin> _spi;
+
+  public:
+    static constexpr bool usesSpi = true;
+    static constexpr bool isStereo = true;
+
+    static void setup() { _spi.setup(); }
+
+    static void sendHiByte() {
+      _spi.begin();
+      _spi.unsafe_send(_configA | (_left >> 12));
+    }
+
+    static void sendLoByte() {
+      _spi.unsafe_send((_left >> 4) & 0xFF);
+    }
+
+    static void sendRightHiByte() {
+      _spi.end();                                   // Deselect to latch the left channel (LDAC is tied low).
+      _spi.unsafe_clearEndOfTransmissionFlag();
+      _spi.begin();
+      _spi.unsafe_send(_configB | (_right >> 12));
+    }
+
+    static void sendRightLoByte() {
+      _spi.unsafe_send((_right >> 4) & 0xFF);
+    }
+
+    static void set(uint16_t left, uint16_t right) {
+      _left = left;
+      _right = right;
+      _spi.end();                                   // Deselect to latch the right channel.
+      _spi.unsafe_clearEndOfTransmissionFlag();
+    }
+};
+
+template<PinId csPin> uint16_t Mcp4822<csPin>::_left;
+template<PinId csPin> uint16_t Mcp4822<csPin>::_right;
+template<PinId csPin> Spi<csPin> Mcp4822<csPin>::_spi;
+
+#endif /* MCP4822_H_ */
@@ -0,0 +1,89 @@
+/*
+    Voice meter
+    https://github.com/DLehenbauer/arduino-midi-sound-module
+
+    Computes the per-voice levels shown on the bar graph.  Rather than sampling the instantaneous
+    amplitude of one voice per pass of the main 'loop()', the meter collects the peak amplitude
+    recorded by the ISR for every voice and updates all levels at a fixed frame rate:
+
+      - The level of each bar jumps up to the peak amplitude observed during the frame, and
+        otherwise falls by 'decayPerFrame' (i.e., a fast attack, slow release meter).
+
+      - A peak-hold marker remains at the highest recent level for 'holdFrames' before falling.
+
+    Because levels only change once per frame, the bar graph receives new heights (and sends the
+    pages that changed) at most once per frame.
+*/
+
+#ifndef __METER_H__
+#define __METER_H__
+
+#include <stdint.h>
+
+template <typename TSynth>
+class Meter final {
+  public:
+    static constexpr uint8_t numMeters = TSynth::numVoices;
+    static constexpr uint8_t maxLevel = 63;             // Levels are in the range [0..63] (i.e., 64px)
+
+  private:
+    static constexpr uint8_t framesPerUpdate = 2;       // Synth frames per meter frame (~77 Hz / 2 ~= 39 Hz)
+    static constexpr uint8_t decayPerFrame = 2;         // Level decay per meter frame (~0.8s to fall from full scale)
+    static constexpr uint8_t holdFrames = 20;           // Meter frames the peak-hold marker remains (~0.5s)
+
+    uint8_t _level[numMeters];                          // Current level of each meter.
+    uint8_t _hold[numMeters];                           // Current peak-hold level of each meter.
+    uint8_t _holdTime[numMeters];                       // Frames remaining before the peak-hold marker begins to fall.
+    uint8_t _lastFrame = 0;                             // Synth frame at which the meter was last updated.
+
+  public:
+    Meter() {
+      for (int8_t i = numMeters - 1; i >= 0; i--) {
+        _level[i] = 0;
+        _hold[i] = 0;
+        _holdTime[i] = 0;
+      }
+    }
+
+    // Updates all meters if at least 'framesPerUpdate' synth frames have passed since the last update.
+    // Returns true if the meters were updated (i.e., the display should be refreshed.)
+    bool update(TSynth& synth) {
+      const uint8_t frame = synth.getFrame();
+      if (static_cast<uint8_t>(frame - _lastFrame) < framesPerUpdate) {
+        return false;
+      }
+      _lastFrame = frame;
+
+      uint8_t peaks[numMeters];
+      synth.takePeaks(peaks);
+
+      for (int8_t i = numMeters - 1; i >= 0; i--) {
+        uint8_t peak = peaks[i];                        // The height of the bar is equal to 1.5x the peak amplitude,
+        peak += peak >> 1;                              // saturating at 'maxLevel'.
+        if (peak > maxLevel) { peak = maxLevel; }
+
+        uint8_t level = _level[i];                      // Fall by 'decayPerFrame', unless the new peak is higher.
+        level = level > decayPerFrame
+          ? level - decayPerFrame
+          : 0;
+        if (peak > level) { level = peak; }
+        _level[i] = level;
+
+        if (level >= _hold[i]) {                        // If the level reaches the peak-hold marker, move the marker
+          _hold[i] = level;                             // up and restart the hold time.
+          _holdTime[i] = holdFrames;
+        } else if (_holdTime[i] > 0) {                  // Otherwise, hold the marker in place until the hold time
+          _holdTime[i]--;                               // expires, and then let it fall one pixel per frame.
+        } else {
+          _hold[i]--;
+        }
+      }
+
+      return true;
+    }
+
+    uint8_t getLevel(uint8_t meter) const { return _level[meter]; }
+    uint8_t getHold(uint8_t meter) const  { return _hold[meter]; }
+};
+
+#endif //__METER_H__
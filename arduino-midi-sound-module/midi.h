@@ -158,6 +158,15 @@ class Midi final {
     static constexpr uint8_t maxMidiData = 32;
     static RingBuffer<uint8_t, /* Log2Capacity: */ 6> _midiBuffer;
 
+  #ifdef MIDI_TX
+    static RingBuffer<uint8_t, /* Log2Capacity: */ 5> _txBuffer;        // Bytes queued for the USART UDRE ISR (see 'send()').
+  #endif
+
+  #ifdef TELEMETRY
+    static volatile uint8_t v_rxHighWater;                              // Most bytes in '_midiBuffer' since the last 'takeRxStats()'.
+    static volatile uint16_t v_rxDropped;                               // Bytes discarded because '_midiBuffer' was full.
+  #endif
+
     static constexpr int8_t midiStatusToDataLength[] = {
       /* 0x8n: MidiCommand_NoteOff               */ 2,
       /* 0x9n: MidiCommand_NoteOn                */ 2,
@@ -230,9 +239,68 @@ class Midi final {
       UCSR0B |= _BV(RXEN0) | _BV(RXCIE0);     // Enable receive w/interrupt
     }
 
+    // Queues the given byte for transmission via the USART, waiting only if the transmit buffer is
+    // full.  Bytes are sent by the USART UDRE ISR.  (The transmitter is enabled on first use, so the
+    // TX pin is left untouched unless something is sent.)  Does nothing unless built with 'MIDI_TX'.
+  #ifdef MIDI_TX
+    static void send(uint8_t byte) {
+      while (!_txBuffer.enqueue(byte)) { }
+      UCSR0B |= _BV(TXEN0) | _BV(UDRIE0);
+    }
+  #else
+    static void send(uint8_t) { /* do nothing */ }
+  #endif
+
+  #ifdef MIDI_TX
+    // Queues the given bytes for transmission if the transmit buffer has room for all of them, and
+    // otherwise returns false without queuing any.  Never waits.
+    static bool trySend(const uint8_t bytes[], uint8_t length) {
+      if (length > _txBuffer.capacity - _txBuffer.count()) {
+        return false;
+      }
+      for (uint8_t i = 0; i < length; i++) {
+        _txBuffer.enqueue(bytes[i]);
+      }
+      UCSR0B |= _BV(TXEN0) | _BV(UDRIE0);
+      return true;
+    }
+
+    // Called by the USART UDRE ISR to transmit the next queued byte.
+    static void transmit() {
+      uint8_t byte;
+      if (_txBuffer.dequeue(byte)) {
+        UDR0 = byte;
+      } else {
+        UCSR0B &= ~_BV(UDRIE0);               // Nothing left to send.  Disable the ISR until 'send()' is next called.
+      }
+    }
+  #endif
+
+  #ifdef TELEMETRY
+    // Returns the most bytes waiting in the receive buffer since the previous call and the number of
+    // bytes dropped because the receive buffer was full (since reset, modulo 2^16.)
+    static void takeRxStats(uint8_t& highWater, uint16_t& dropped) {
+      cli();
+      highWater = v_rxHighWater;
+      dropped = v_rxDropped;
+      v_rxHighWater = 0;
+      sei();
+    }
+  #endif
+
     // Called by the USART RX ISR to enqueue incoming MIDI bytes.  
     static void enqueue(uint8_t byte) {
+    #ifdef TELEMETRY
+      if (!_midiBuffer.enqueue(byte)) {
+        v_rxDropped++;
+      }
+      const uint8_t count = _midiBuffer.count();
+      if (count > v_rxHighWater) {
+        v_rxHighWater = count;
+      }
+    #else
       _midiBuffer.enqueue(byte);
+    #endif
     }
 
     // Called by 'dispatch()' to decode the next byte of a MIDI message.  The message is
@@ -267,6 +335,34 @@ class Midi final {
         decode(received);
       }
     }
+
+    // Discards any partially received message, returning the decoder to its initial state.  (Bytes
+    // waiting in the receive buffer are not affected.)
+    static void reset() {
+      midiStatus = MidiStatus_Unknown;
+      midiChannel = 0xFF;
+      midiDataRemaining = 0;
+      midiDataIndex = 0;
+      for (uint8_t i = 0; i < maxMidiData; i++) {
+        midiData[i] = 0;
+      }
+    }
+
+    // Saves or restores the state of the decoder, i.e., a partially received message (see
+    // 'snapshot.h').  Bytes still waiting in the receive buffer are not included.
+    template <typename TArchive> static void serialize(TArchive& archive) {
+      archive.io(midiStatus);
+      archive.io(midiChannel);
+      archive.io(midiDataRemaining);
+      archive.io(midiDataIndex);
+      archive.io(midiData);
+
+      if (!archive.check(midiStatus <= MidiStatus_Unknown
+          && midiDataIndex + midiDataRemaining <= maxMidiData
+          && (midiChannel <= 0x0F || midiDataRemaining == 0))) {
+        reset();
+      }
+    }
 };
 
 MidiStatus Midi::midiStatus = MidiStatus_Unknown;     // Status of the incoming message
@@ -277,8 +373,23 @@ uint8_t Midi::midiData[maxMidiData] = { 0 };          // Buffer containing incom
 constexpr int8_t Midi::midiStatusToDataLength[];
 RingBuffer<uint8_t, /* Log2Capacity: */ 6> Midi::_midiBuffer;
 
+#ifdef MIDI_TX
+RingBuffer<uint8_t, /* Log2Capacity: */ 5> Midi::_txBuffer;
+#endif
+
+#ifdef TELEMETRY
+volatile uint8_t Midi::v_rxHighWater = 0;
+volatile uint16_t Midi::v_rxDropped = 0;
+#endif
+
 ISR(USART_RX_vect) {
   Midi::enqueue(UDR0);
 }
 
+#ifdef MIDI_TX
+ISR(USART_UDRE_vect) {
+  Midi::transmit();
+}
+#endif
+
 #endif // __MIDI_H__
\ No newline at end of file
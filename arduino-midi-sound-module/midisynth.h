@@ -9,30 +9,229 @@
 #define __MIDISYNTH_H__
 
 #include <stdint.h>#include "synth.h"
+#include "sysex.h"
+#include "voicestats.h"
 
-class MidiSynth final : public Synth {
+class MidiSynth final : public Synth<DAC> {
   private:
     constexpr static uint8_t numMidiChannels	= 16;					          // MIDI standard has 16 channels.    constexpr static uint8_t maxMidiChannel		= numMidiChannels - 1;	// Maximum channel is 15 when 0-indexed.    constexpr static uint8_t percussionChannel	= 9;					        // Channel 10 is percussion (9 when 0-indexed).
-    uint8_t voiceToNote[numVoices];							        // Map synth voice to the current MIDI note (or 0xFF if off).    uint8_t voiceToChannel[numVoices];						      // Map synth voice to the current MIDI channel (or 0xFF if off).    Instrument channelToInstrument[numMidiChannels];		// Map MIDI channel to the current MIDI program (i.e., instrument).
+    uint8_t voiceToNote[numVoices];							        // Map synth voice to the current MIDI note (or 0xFF if off).    uint8_t voiceToChannel[numVoices];						      // Map synth voice to the current MIDI channel (or 0xFF if off).    uint8_t channelToProgram[numMidiChannels];		      // Map MIDI channel to the current MIDI program (i.e., instrument).
+    uint8_t channelToPan[numMidiChannels];              // Map MIDI channel to the current pan (CC10), used if the DAC is stereo.
+    uint8_t channelToVolume[numMidiChannels];           // Map MIDI channel to the current volume (CC7).
+    uint8_t channelToExpression[numMidiChannels];       // Map MIDI channel to the current expression (CC11).
+    uint16_t sustainedChannels = 0;                     // Bit 'n' is set while the sustain pedal (CC64) of MIDI channel 'n' is down.
+    uint16_t sustainedVoices = 0;                       // Bit 'n' is set if voice 'n' received a note off while its channel was sustained.
+
+  public:
+  #ifdef VOICE_STATS
+    typedef VoiceStats<numVoices> Stats;
+  #else
+    typedef NoVoiceStats<numVoices> Stats;
+  #endif
+
+  private:
+    static Stats stats;                                 // Optional voice usage counters (see 'voicestats.h').
+
+    // Returns the combined 7-bit volume of the given MIDI 'channel' (i.e., volume x expression).
+    uint8_t channelVolume(uint8_t channel) const {
+      return (channelToVolume[channel] * (channelToExpression[channel] + 1)) >> 7;
+    }
+
+    // Recalculates the volume of each voice currently playing on the given MIDI 'channel' after a change
+    // to the channel's volume, expression, or pan.  (The volume is folded into the voice's 'vol', so
+    // this adds no work to the ISR.)
+    void updateChannelVolume(uint8_t channel) {
+      const uint8_t volume = channelVolume(channel);
+      const uint8_t pan = channelToPan[channel];
+      for (int8_t voice = maxVoice; voice >= 0; voice--) {
+        if (voiceToChannel[voice] == channel) {
+          setVolume(voice, volume, pan);
+        }
+      }
+    }
+
+    // Stops each voice on the given MIDI 'channel' whose note off was deferred by the sustain pedal.
+    void releaseSustainedVoices(uint8_t channel) {
+      for (int8_t voice = maxVoice; voice >= 0; voice--) {
+        const uint16_t voiceBit = 1 << voice;
+        if ((sustainedVoices & voiceBit) && voiceToChannel[voice] == channel) {
+          noteOff(voice);
+          voiceToChannel[voice] = 0xFF;
+          sustainedVoices &= ~voiceBit;
+        }
+      }
+    }
+
+    // Stops the note playing on 'voice' for a note off on the given MIDI 'channel'.  If the channel's sustain
+    // pedal is down, the note off is deferred until the pedal is released (see 'releaseSustainedVoices()'),
+    // but the voice keeps its channel for pitch bend / volume changes.
+    void releaseVoice(uint8_t voice, uint8_t channel) {
+      voiceToNote[voice] = 0xFF;                        // (Ignore the voice for future note offs on this channel.)
+      if (sustainedChannels & (1 << channel)) {
+        sustainedVoices |= 1 << voice;
+        return;
+      }
+      noteOff(voice);
+      voiceToChannel[voice] = 0xFF;
+    }
+
+    // Returns the MIDI channel and voice state to its power-on state.
+    void resetChannels() {
+      for (int8_t channel = maxMidiChannel; channel >= 0; channel--) {
+        channelToProgram[channel] = 0;
+        channelToPan[channel] = 0x40;
+        channelToVolume[channel] = 100;                 // General MIDI default volume (about 2 dB below full scale;
+        channelToExpression[channel] = 0x7F;            // send CC 7 = 127 for full level), and full expression.
+      }
+
+      for (int8_t channel = maxMidiChannel; channel >= 0; channel--) {        voiceToNote[channel] = 0xFF;        voiceToChannel[channel] = 0xFF;      }
+
+      sustainedChannels = 0;
+      sustainedVoices = 0;
+    }
+
+  public:
+    MidiSynth() : Synth() {
+      resetChannels();
+    }
+
+    // Returns the synth to its power-on state: the MIDI channel and voice state, the synth engine (see
+    // 'Synth::reset()') and the voice usage counters.
+    void reset() {
+      resetChannels();
+      Synth::reset();
+      stats.reset(*this);
+    }
+
+    void midiNoteOn(uint8_t channel, uint8_t note, uint8_t velocity) {      uint8_t voice = getNextVoice();									  // Find an available voice and play the note.
+      stats.noteOn(*this, voice);
+
+      uint8_t instrument = channelToProgram[channel];   // The instrument is the channel's current program, unless
+      if (channel == percussionChannel) {						    // playing the percussion channel, in which case
+        note = Instruments::getPercussiveInstrument(    //   find the instrument for the given note, and replace the
+          note, instrument);                            //   note with the playback frequency for the instrument.
+      }
+
+      InstrumentRecord record;                          // Read the instrument's record from PROGMEM (a single 26B copy,
+      Instruments::getInstrumentRecord(instrument, record);   // made before 'noteOn()' suspends the ISR.)
+      noteOn(voice, note, velocity, record, channelVolume(channel), channelToPan[channel]);
+      sustainedVoices &= ~(1 << voice);                 // (If the voice was stolen from a sustained note, it is no longer sustained.)
 
-  public:    MidiSynth() : Synth() {      for (int8_t channel = maxMidiChannel; channel >= 0; channel--) {        Instruments::getInstrument(0, channelToInstrument[channel]);      }
-      for (int8_t channel = maxMidiChannel; channel >= 0; channel--) {        voiceToNote[channel] = 0xFF;        voiceToChannel[channel] = 0xFF;      }    }
-    void midiNoteOn(uint8_t channel, uint8_t note, uint8_t velocity) {      if (channel == percussionChannel) {						    // If playing the percussion channel        note = Instruments::getPercussiveInstrument(    //   Update the channel instrument for the given note, and          note, channelToInstrument[channel]);          //   replace the note with the correct playback frequency      }                                                 //   for the instrument (expressed as a midi note).
-      uint8_t voice = getNextVoice();									  // Find an available voice and play the note.      noteOn(voice, note, velocity, channelToInstrument[channel]);
       voiceToNote[voice] = note;								        // Update our voice -> note/channel maps (used for processing MIDI      voiceToChannel[voice] = channel;						      // pitch bend and note off messages).    }
-    void midiNoteOff(uint8_t channel, uint8_t note)  {      for (int8_t voice = maxVoice; voice >= 0; voice--) {						          // For each voice        if (voiceToNote[voice] == note && voiceToChannel[voice] == channel) {   //   that is currently playing the note on this channel          noteOff(voice);														                            //      stop playing the note          voiceToChannel[voice] = 0xFF;										                      //      and remove the voice from our voice -> note/channel          voiceToNote[voice] = 0xFF;											                      //      maps so we ignore it for future node off / pitch bench        }																		                                    //      messages.      }    }
-    void midiProgramChange(uint8_t channel, uint8_t program) {      Instruments::getInstrument(program, channelToInstrument[channel]);			  // Load the instrument corresponding to the given MIDI program    }																				                                    // into the MIDI channel -> instrument map.
-    void midiPitchBend(uint8_t channel, int16_t value) {      for (int8_t voice = maxVoice; voice >= 0; voice--) {						          // For each voice        if (voiceToChannel[voice] == channel) {									                //   which is currently playing a note on this channel          pitchBend(voice, value);											                        //     update pitch bench with the given value.        }      }    }      void midiControlChange(uint8_t channel, uint8_t controller, uint8_t value) {      switch (controller) {
+    void midiNoteOff(uint8_t channel, uint8_t note)  {      stats.count(VoiceStatsEvent_NoteOff);
+      for (int8_t voice = maxVoice; voice >= 0; voice--) {						          // For each voice        if (voiceToNote[voice] == note && voiceToChannel[voice] == channel) {   //   that is currently playing the note on this channel
+          releaseVoice(voice, channel);                                         //      stop playing the note (unless sustained).
+        }
+      }    }
+    void midiProgramChange(uint8_t channel, uint8_t program) {      stats.count(VoiceStatsEvent_ProgramChange);
+      channelToProgram[channel] = program;			                                // Remember the MIDI program for subsequent notes on this channel.
+    }																				                                    // (The instrument's record is read from PROGMEM on note on.)
+
+    void midiPitchBend(uint8_t channel, int16_t value) {      stats.count(VoiceStatsEvent_PitchBend);
+      for (int8_t voice = maxVoice; voice >= 0; voice--) {						          // For each voice        if (voiceToChannel[voice] == channel) {									                //   which is currently playing a note on this channel          pitchBend(voice, value);											                        //     update pitch bench with the given value.        }      }    }      void midiControlChange(uint8_t channel, uint8_t controller, uint8_t value) {
+      stats.count(VoiceStatsEvent_ControlChange);
+      switch (controller) {
+        // Volume:
+        case 0x07: {
+          channelToVolume[channel] = value;                         // Remember the volume for subsequent notes on this channel
+          updateChannelVolume(channel);                             // and update any voices currently playing on this channel.
+          break;
+        }
+
+        // Pan:
+        case 0x0A: {
+          channelToPan[channel] = value;                            // Remember the pan for subsequent notes on this channel
+          updateChannelVolume(channel);                             // and update any voices currently playing on this channel.
+          break;
+        }
+
+        // Expression:
+        case 0x0B: {
+          channelToExpression[channel] = value;                     // Remember the expression for subsequent notes on this channel
+          updateChannelVolume(channel);                             // and update any voices currently playing on this channel.
+          break;
+        }
+
+        // Sustain pedal:
+        case 0x40: {
+          const uint16_t channelBit = 1 << channel;
+          if (value >= 0x40) {                                      // Values >= 64 are 'on'.  While the pedal is down, note offs
+            sustainedChannels |= channelBit;                        // on this channel are deferred (see 'midiNoteOff()').
+          } else {
+            sustainedChannels &= ~channelBit;                       // When the pedal is released, stop the deferred notes.
+            releaseSustainedVoices(channel);
+          }
+          break;
+        }
+
+        // Reset All Controllers:
+        case 0x79: {
+          channelToExpression[channel] = 0x7F;                      // Per RP-015, reset expression and release the sustain pedal.
+          updateChannelVolume(channel);                             // (Volume and pan are not reset.)
+          sustainedChannels &= ~(1 << channel);
+          releaseSustainedVoices(channel);
+          break;
+        }
+
         case 0x7B: {
           switch (value) {
             // All Notes Off (for current channel):
-            case 0: {															                      
-              for (int8_t voice = maxVoice; voice >= 0; voice--) {			// For each voice                if (voiceToChannel[voice] == channel) {						      //   currently playing any note on this channel                  noteOff(voice);											                  //	   stop playing the note                  voiceToChannel[voice] = 0xFF;							            //      and remove the voice from our voice -> note/channel                  voiceToNote[voice] = 0xFF;								            //      maps so we ignore it for future node off / pitch bench                }															                          //      messages.              }              break;
+            case 0: {
+              for (int8_t voice = maxVoice; voice >= 0; voice--) {			// For each voice
+                if (voiceToChannel[voice] == channel) {						      //   currently playing any note on this channel
+                  releaseVoice(voice, channel);                         //     stop playing the note, unless the sustain pedal is down
+                }                                                       //     (per the MIDI spec, All Notes Off is held by sustain.)
+              }              break;
             }
           }
           break;
         }
       }
-    }}; //MidiSynth
+    }
+    // Handles the diagnostic sysex messages described in 'sysex.h'.  Replies are sent one byte at a
+    // time via 'send(byte)'.
+    template <typename TSend>
+    void midiSysex(uint8_t cbData, const uint8_t data[], TSend send) {
+      stats.count(VoiceStatsEvent_Sysex);
+
+      if (cbData != 2 || data[0] != Sysex_Id) {
+        return;
+      }
+
+      switch (data[1]) {
+        case Sysex_VoiceStatsRequest: stats.dump(send); break;
+        case Sysex_VoiceStatsReset:   stats.reset(); break;
+        case Sysex_IsrStatsRequest:   Monitor::dump(samplingInterval, send); break;
+      }
+    }
+
+    // Updates the frame counts of 'stats'.  Called from the main 'loop()'.
+    void updateStats() const {
+      stats.update(*this);
+    }
+
+    static const Stats& getStats() { return stats; }
+
+    // Saves or restores the MIDI channel and voice state, followed by the state of the synth engine
+    // (see 'snapshot.h').  The voice usage counters ('stats') are not included.
+    template <typename TArchive> void serialize(TArchive& archive) {
+      archive.io(voiceToNote);
+      archive.io(voiceToChannel);
+      archive.io(channelToProgram);
+      archive.io(channelToPan);
+      archive.io(channelToVolume);
+      archive.io(channelToExpression);
+      archive.io(sustainedChannels);
+      archive.io(sustainedVoices);
+      for (uint8_t channel = 0; channel < numMidiChannels; channel++) {
+        if (!archive.check(channelToProgram[channel] <= 127)) {
+          channelToProgram[channel] = 0;
+        }
+      }
+      Synth::serialize(archive);
+    }
+}; //MidiSynth
+
+MidiSynth::Stats MidiSynth::stats;
 
 #endif //__MIDISYNTH_H__
@@ -25,6 +25,9 @@
 
 class Pwm0 final {
   public:
+    static constexpr bool usesSpi = false;            // PWM output does not share the SPI bus with the display.
+    static constexpr bool isStereo = false;
+
     static void setup() {
       // Note: The standard Arduino core registers a TIMER0_OVF_vect ISR to keep a count of passing
       //       time for millis and delay.
@@ -31,6 +31,9 @@
 
 class Pwm01 final {
   public:
+    static constexpr bool usesSpi = false;            // PWM output does not share the SPI bus with the display.
+    static constexpr bool isStereo = false;
+
     static void setup() {
       GTCCR = _BV(TSM) | _BV(PSRSYNC);                    // Halt timers 0 and 1
     
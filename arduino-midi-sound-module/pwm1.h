@@ -27,6 +27,9 @@
 
 class Pwm1 final {
   public:
+    static constexpr bool usesSpi = false;            // PWM output does not share the SPI bus with the display.
+    static constexpr bool isStereo = false;
+
     static void setup() {
       TIMSK1 = 0;                                         // Disable any interrupts registered for Timer 1
       
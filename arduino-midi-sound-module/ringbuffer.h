@@ -3,7 +3,11 @@
     https://github.com/DLehenbauer/arduino-midi-sound-module
 
     Simple circular buffer used by 'midi.h' to quickly save incoming MIDI bytes during the
-    USART RX ISR for later decoding and dispatch.
+    USART RX ISR for later decoding and dispatch (and to queue outgoing bytes for the USART
+    UDRE ISR.)
+
+    One slot is left empty to distinguish a full buffer from an empty one, so the buffer holds
+    up to 'capacity' = 2^Log2Capacity - 1 items.
 */
 
 #ifndef __RINGBUFFER_H__
@@ -21,12 +25,18 @@ template<class T, uint8_t Log2Capacity> class RingBuffer {
     volatile uint8_t _tail;		// The location of the next item to be dequeued.
   
   public:
-    void enqueue(T data) volatile {
+    static constexpr uint8_t capacity = length - 1;
+
+    // Inserts 'data' at the head of the buffer.  Returns false if the buffer is full, in which case
+    // 'data' is discarded.
+    bool enqueue(T data) volatile {
       uint8_t newHead = (_head + 1) & lengthModMask;
       if (newHead != _tail) {
         _buffer[_head] = data;
         _head = newHead;
+        return true;
       }
+      return false;
     }
   
     bool dequeue(T& value) volatile {
@@ -38,6 +48,11 @@ template<class T, uint8_t Log2Capacity> class RingBuffer {
         return true;
       }
     }
+
+    // Returns the number of items currently in the buffer.
+    uint8_t count() const volatile {
+      return (_head - _tail) & lengthModMask;
+    }
 };
 
 #endif //__RINGBUFFER_H__
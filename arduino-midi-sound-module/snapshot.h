@@ -0,0 +1,168 @@
+/*
+    Synth State Snapshots
+    https://github.com/DLehenbauer/arduino-midi-sound-module
+
+    Saves and restores the complete state of the synth (see 'MidiSynth::serialize()'), including
+    the state private to the ISR, and the state of the MIDI decoder (see 'Midi::serialize()') as a
+    compact binary snapshot (~1KB).  Used by 'host/render.cpp' to checkpoint and resume renders:
+
+      std::vector<uint8_t> bytes;
+      Snapshot::save(synth, [&](uint8_t byte) { bytes.push_back(byte); });
+      ...
+      size_t next = 0;
+      Snapshot::restore(synth, [&](uint8_t& byte) {
+        if (next == bytes.size()) { return false; }
+        byte = bytes[next++];
+        return true;
+      });
+
+    The snapshot begins with a 6 byte header ('AMSS', version, flags), followed by the serialized
+    fields in the order they are visited by 'serialize()'.  Multi-byte values are little endian.
+    Pointers into PROGMEM tables are stored as indexes, so a snapshot can only be restored by a build
+    with the same instrument tables (and DAC channels / wavetable layout, which are recorded in the
+    flags.)
+
+    Each class visits its fields with 'archive.io(field)', so the same 'serialize()' method both saves
+    (with 'SnapshotWriter') and restores (with 'SnapshotReader') the state.  Fields that are stored
+    in another form (e.g., pointers) are converted into a local variable that is passed to 'io()' and
+    then converted back.
+
+    A snapshot is not trusted: before an index or offset is converted back into a pointer (or is later
+    used to index a table), it is passed to 'archive.check(isValid)'.  If it is out of range, the field
+    is reset instead, and 'restore()' returns false once the remaining fields have been read.
+*/
+
+#ifndef __SNAPSHOT_H__
+#define __SNAPSHOT_H__
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "midi.h"
+#include "midisynth.h"
+
+// Archive that writes each field passed to 'io()' via the 'write(uint8_t byte)' callback.
+template <typename TWrite> class SnapshotWriter final {
+  private:
+    TWrite& _write;
+
+  public:
+    explicit SnapshotWriter(TWrite& write) : _write(write) { }
+
+    // Writes the given integer, enum or bool 'value', least significant byte first.
+    template <typename T> void io(const volatile T& value) {
+      const uint32_t bits = static_cast<uint32_t>(value);
+      for (uint8_t i = 0; i < sizeof(T); i++) {
+        _write(static_cast<uint8_t>(bits >> (8 * i)));
+      }
+    }
+
+    template <typename T, size_t length> void io(T (&values)[length]) {
+      for (size_t i = 0; i < length; i++) {
+        io(values[i]);
+      }
+    }
+
+    // The state being saved is the synth's own, so it is always used as is.
+    bool check(bool /* isValid */) { return true; }
+};
+
+// Archive that reads each field passed to 'io()' via the 'read(uint8_t& byte)' callback, which returns
+// false if no bytes remain.
+template <typename TRead> class SnapshotReader final {
+  private:
+    TRead& _read;
+    bool _isComplete = true;                            // False if 'read()' ran out of bytes.
+    bool _isValid = true;                               // False if a restored field failed 'check()'.
+
+  public:
+    explicit SnapshotReader(TRead& read) : _read(read) { }
+
+    // Reads the given integer, enum or bool 'value', least significant byte first.
+    template <typename T> void io(volatile T& value) {
+      uint32_t bits = 0;
+      for (uint8_t i = 0; i < sizeof(T); i++) {
+        uint8_t byte = 0;
+        if (!_read(byte)) {
+          _isComplete = false;
+        }
+        bits |= static_cast<uint32_t>(byte) << (8 * i);
+      }
+      value = static_cast<T>(bits);
+    }
+
+    template <typename T, size_t length> void io(T (&values)[length]) {
+      for (size_t i = 0; i < length; i++) {
+        io(values[i]);
+      }
+    }
+
+    // Records whether the field just restored is within range, and returns 'isValid'.  The caller
+    // resets the field if it is not.
+    bool check(bool isValid) {
+      _isValid = _isValid && isValid;
+      return isValid;
+    }
+
+    bool isComplete() const { return _isComplete; }
+    bool isValid() const { return _isValid; }
+};
+
+class Snapshot final {
+  private:
+    static constexpr uint8_t version = 4;
+    static constexpr uint8_t headerLength = 6;
+
+    enum Flags : uint8_t {
+      Flags_Stereo            = (1 << 0),               // Saved by a build with a stereo DAC.
+      Flags_WavetableSegments = (1 << 1),               // Saved by a build with 'WAVETABLE_SEGMENTS'.
+    };
+
+    static void getHeader(uint8_t header[headerLength]) {
+      header[0] = 'A'; header[1] = 'M'; header[2] = 'S'; header[3] = 'S';
+      header[4] = version;
+      header[5] = (MidiSynth::Dac::isStereo ? Flags_Stereo : 0)
+    #ifdef WAVETABLE_SEGMENTS
+        | Flags_WavetableSegments
+    #endif
+        ;
+    }
+
+    // Saves or restores the header.  Returns false if a restored header does not match this build.
+    template <typename TArchive> static bool serializeHeader(TArchive& archive) {
+      uint8_t expected[headerLength];
+      getHeader(expected);
+
+      uint8_t header[headerLength];
+      getHeader(header);
+      archive.io(header);
+      return memcmp(header, expected, headerLength) == 0;
+    }
+
+  public:
+    // Writes a snapshot of the current state of 'synth' and the MIDI decoder, one byte at a time via
+    // 'write(byte)'.
+    template <typename TWrite> static void save(MidiSynth& synth, TWrite write) {
+      SnapshotWriter<TWrite> archive(write);
+      serializeHeader(archive);
+      synth.serialize(archive);
+      Midi::serialize(archive);
+    }
+
+    // Restores the state of 'synth' and the MIDI decoder from a snapshot read one byte at a time via
+    // 'read(byte)', which returns false once no bytes remain.  Returns false if the snapshot was saved
+    // by an incompatible build (in which case the state is unchanged), or is truncated or contains an
+    // index or offset outside of the tables of this build (in which case the state is incomplete.)
+    template <typename TRead> static bool restore(MidiSynth& synth, TRead read) {
+      SnapshotReader<TRead> archive(read);
+      if (!serializeHeader(archive) || !archive.isComplete()) {
+        return false;
+      }
+
+      synth.serialize(archive);
+      Midi::serialize(archive);
+      return archive.isComplete() && archive.isValid();
+    }
+};
+
+#endif //__SNAPSHOT_H__
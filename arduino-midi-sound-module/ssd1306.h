@@ -9,6 +9,9 @@
     in 7x8 blocks with no double buffering in the uC's data memory.  (The 8th column is always unset to
     create a visual space between bars in the bar graph.)
 
+    In addition, the driver exposes non-blocking primitives ('isIdle()' and 'unsafe_send()') that allow
+    'BarGraph' to push one byte at a time without busy waiting for the SPI transfer to complete.
+
     Connection to Arduino Uno:
 
                   .-----------------.
@@ -168,8 +171,24 @@ class Ssd1306 final {
       send(value);
       endData();
     }
-    
-  private:
+
+    // Returns true if the SPI end of transmission flag is set (i.e., the last byte sent has finished
+    // transmitting.)  Reading SPSR followed by the next write to SPDR implicitly clears the flag.
+    bool isIdle() __attribute__((always_inline)) {
+      return SPSR & _BV(SPIF);
+    }
+
+    // Sends the given byte and returns without waiting for the transmission to complete.  The caller
+    // is responsible for waiting until 'isIdle()' before sending the next byte or ending the transfer.
+    void unsafe_send(const uint8_t data) __attribute__((always_inline)) {
+      SPDR = data;
+    }
+
+    // Busy wait until the SPI end of transmission flag is set.
+    void flush() __attribute__((always_inline)) {
+      while (!isIdle());
+    }
+
     void beginCommand() __attribute__((always_inline)) {
       PORTD &= ~_cmdPins;         // Select SSD1306 for command.
     }
@@ -186,9 +205,10 @@ class Ssd1306 final {
       PORTD |= _dataPins;         // Deselect SSD1306.
     }
     
+  private:
     void send(const uint8_t data) __attribute__((always_inline)) {
-      SPDR = data;
-      while (!(SPSR & _BV(SPIF)));
+      unsafe_send(data);
+      flush();
     }
 };
 
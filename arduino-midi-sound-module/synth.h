@@ -19,6 +19,44 @@
         that it can be preempted by the USART RX ISR.
         
         (However, it disables Timer2 ISRs until it's ready to exit to avoid reentrancy.)
+
+      - The output device is selected at compile time by the 'TDac' policy template parameter.  A DAC
+        policy is a class exposing the following static members, which the ISR calls directly (see
+        'pwm0.h' and 'ltc16xx.h' for examples, and 'dacpair.h' for driving two DACs at once):
+
+          static constexpr bool usesSpi;    // True if the DAC shares the SPI bus with the display.
+          static constexpr bool isStereo;   // True if the DAC outputs separate left/right channels (see below).
+          static void setup();              // Configures the output.  Called once by 'begin()'.
+          static void sendHiByte();         // Begins transmitting the upper 8-bits of the previous sample.
+          static void sendLoByte();         // Transmits the lower 8-bits of the previous sample.
+          static void set(uint16_t out);    // Stores the next sample for output.
+
+        Stereo DAC policies instead expose 'set(uint16_t left, uint16_t right)', where 'sendHiByte()' and
+        'sendLoByte()' transmit the left channel, plus the following hooks to transmit the right channel:
+
+          static void sendRightHiByte();    // Begins transmitting the upper 8-bits of the previous right sample.
+          static void sendRightLoByte();    // Transmits the lower 8-bits of the previous right sample.
+
+      - When the DAC is stereo, each voice is mixed into separate left and right accumulators, scaled
+        by a per-voice volume for each channel ('vol' and 'volR') that combines velocity, volume
+        and pan.
+        The mono mixing code is unchanged (the stereo work is eliminated at compile time.)
+
+        The right channel of each group of 4 voices is mixed immediately after the left, while the
+        group's samples are still in register, rather than keeping all 8 samples of the first half live
+        across the transmit of the left channel.  The SPI transmits are spaced by at least 4 voices of
+        work (more than the 16 cycles to shift out each byte.)
+
+        Per sample, stereo adds the right channel mix (per voice: load 'xorBits' / 'ampR', xor,
+        multiply and add) and the right channel output, plus one multiply per voice in the amplitude
+        slot every 256 samples.  The Timer2 ISR must still fit the 808 cycles between interrupts
+        (ATMega328P @ 16MHz, samplingInterval 0x65); measure it with 'host/avrsim' on a stereo build.
+
+      - Per-voice state shared with the ISR ('VoiceState') is stored as a structure of arrays by
+        default, which lets the AVR address each field of each voice at a constant address.  If
+        'VOICE_RECORDS' is defined, it is instead stored as an array of per-voice records, keeping the
+        state of each voice together in the cache on host / WASM builds (see 'host/bench.cpp').
+        Fields are accessed with 'VOICE(voice, field)' in either layout.
 */
 
 #ifndef __SYNTH_H__
@@ -26,29 +64,83 @@
 
 #include <avr/interrupt.h>
 #include <avr/pgmspace.h>
-#include <math.h>
 #include <stdint.h>
 #include "instruments.h"
 #include "envelope.h"
+#include "isrmonitor.h"
+#include "dacpair.h"
 #include "ltc16xx.h"
+#include "mcp4822.h"
 #include "pwm0.h"
 #include "pwm01.h"
 #include "pwm1.h"
 
-// With GCC, we can calculate the _noteToPitch table at compile time.
-#ifndef __EMSCRIPTEN__
-constexpr static uint16_t interval(double sampleRate, double note) {
-  return round(pow(2, (note - 69.0) / 12.0) * 440.0 / sampleRate * static_cast<double>(0xFFFF));
+// Sums the Taylor series of e^x, starting from the given 'term' (i.e., x^(n-1) / (n-1)!).  Converges quickly
+// for the |x| < 1 used below.  (Unlike 'pow()', this can be evaluated at compile time by both GCC and
+// Emscripten, so the '_fineToSamplingInterval' table is calculated at compile time by both.)
+constexpr static double expSeries(double x, double term, uint8_t n) {
+  return n > 20 ? term : term + expSeries(x, term * x / n, n + 1);
+}
+
+// Returns the Q8.8 sampling interval of the pitch 'semitone' [0 .. 11] + 'fraction' [0 .. 63] 1/64ths of a
+// semitone above MIDI note 120 (i.e., the highest octave, which has the most precise 16-bit intervals).
+constexpr static uint16_t fineInterval(double sampleRate, uint8_t semitone, uint8_t fraction) {
+  return static_cast<uint16_t>(
+    expSeries(((semitone + 3) * 64 + fraction) / 768.0 * 0.69314718055994531, 1.0, 1)   // 2^((note - 117) / 12)
+      * 16.0 * 440.0 / sampleRate * static_cast<double>(0xFFFF) + 0.5);                // x 2^((117 - 69) / 12) x 440 Hz
+}
+
+// Maps the MIDI note 'velocity' [0 .. 127] to a gain in [0 .. peak] proportional to the square of the
+// velocity (i.e., a 40 dB dynamic range, as recommended by GM2), which sounds more even to the ear than
+// scaling the amplitude linearly.  Rounds up, so that non-zero velocities are never silent.  (Integer
+// only, so the '_velocityToGain' table is also calculated at compile time with Emscripten.)
+constexpr static uint8_t velocityGain(uint8_t velocity, uint8_t peak) {
+  return (static_cast<uint32_t>(velocity) * velocity * peak + (127 * 127 - 1)) / (127 * 127);
 }
-#endif
 
 // If unspecified, choose the default DAC.
 #ifndef DAC
   #define DAC Pwm0
 #endif
 
+// Layouts for 'VoiceState'.  With 'VoiceArrays', each field is an array indexed by voice (structure
+// of arrays).  With 'VoiceRecord', each field holds the state of a single voice, and 'VoiceState' is
+// itself indexed by voice (array of structures).
+template <uint8_t numVoices> struct VoiceArrays { template <typename T> using Field = T[numVoices]; };
+struct VoiceRecord { template <typename T> using Field = T; };
+
+// Per-voice state shared with the ISR.  (Fields used by the ISR for every sample are first.)
+template <typename TLayout> struct VoiceState {
+  typename TLayout::template Field<WaveWindow> wave;          // 256b window of the wavetable currently sampled.
+  typename TLayout::template Field<uint16_t>   phase;         // Phase accumulator holding the Q8.8 offset of the next sample.
+  typename TLayout::template Field<uint16_t>   interval;      // Q8.8 sampling interval, used to advance the 'phase' accumulator.
+  typename TLayout::template Field<int8_t>     xorBits;       // XOR bits applied to each sample (Note: clobbered if isNoise is true).
+  typename TLayout::template Field<uint8_t>    amp;           // 6-bit amplitude scale applied to each sample.
+  typename TLayout::template Field<uint8_t>    ampR;          // Right channel 'amp' (stereo only.)
+  typename TLayout::template Field<bool>       isNoise;       // If true, 'xorBits' is periodically overwritten with random values.
+  typename TLayout::template Field<uint8_t>    vol;           // Additional 7-bit volume scalar (i.e., MIDI velocity x channel volume).  Left channel if stereo.
+  typename TLayout::template Field<uint8_t>    volR;          // Right channel 'vol' (stereo only.)
+  typename TLayout::template Field<uint8_t>    peak;          // Peak 'amp' since last call to 'takePeaks()' (for the meter display).
+  typename TLayout::template Field<uint16_t>   bentInterval;  // Q8.8 sampling internal post pitch bend, but prior to freqMod.
+  typename TLayout::template Field<uint8_t>    bentFraction;  // Fraction of 'bentInterval' below its LSB, in 1/256ths (i.e., the bottom byte of the Q8.16 interval.)
+  typename TLayout::template Field<uint8_t>    carry;         // Running sum of 'bentFraction' (mod 256).  Each overflow adds 1 LSB to 'interval' (see 'tick()').
+  typename TLayout::template Field<uint16_t>   baseWave;      // Original offset of the window in the wavetable.
+  typename TLayout::template Field<Envelope>   ampMod;        // Amplitude modulation (0 .. 127, although most instruments peak below 96)
+  typename TLayout::template Field<Envelope>   freqMod;       // Frequency modulation (-64 .. +64)
+  typename TLayout::template Field<Envelope>   waveMod;       // Wave offset modulation (0 .. 127)
+};
+
+#ifdef VOICE_RECORDS
+  #define VOICE(voice, field) (_state.v_voices[voice].field)
+#else
+  #define VOICE(voice, field) (_state.v_voices.field[voice])
+#endif
+
+template <typename TDac>
 class Synth {
   public:
+    typedef TDac Dac;
+
     constexpr static uint8_t numVoices = 16;
     constexpr static uint8_t maxVoice = Synth::numVoices - 1;
     constexpr static uint8_t samplingInterval = 0x65      // 0x65 ~= 19.8 kHz
@@ -58,6 +150,12 @@ class Synth {
       ;
   
   constexpr static double sampleRate = static_cast<double>(F_CPU) / 8.0 / static_cast<double>(Synth::samplingInterval);
+
+  #ifdef ISR_MONITOR
+    typedef IsrMonitor Monitor;                           // Detects ISR overruns (see 'isrmonitor.h').
+  #else
+    typedef NoIsrMonitor Monitor;
+  #endif
   
   private:
     // Used in 'noteOn()' to shift wave offset or amplitude modulation program based on the current note played.
@@ -65,62 +163,150 @@ class Synth {
     // qualities vary based on the note played.)
     static constexpr uint8_t offsetTable[] = { 0, 0, 1, 1, 2, 3, 3, 3 };
 
-    // Map MIDI notes [0..127] to the corresponding Q8.8 sampling interval
-    constexpr static uint16_t _noteToSamplingInterval[] PROGMEM = {
-    #ifndef __EMSCRIPTEN__
-      interval(sampleRate, 0x00), interval(sampleRate, 0x01), interval(sampleRate, 0x02), interval(sampleRate, 0x03), interval(sampleRate, 0x04), interval(sampleRate, 0x05), interval(sampleRate, 0x06), interval(sampleRate, 0x07),
-      interval(sampleRate, 0x08), interval(sampleRate, 0x09), interval(sampleRate, 0x0A), interval(sampleRate, 0x0B), interval(sampleRate, 0x0C), interval(sampleRate, 0x0D), interval(sampleRate, 0x0E), interval(sampleRate, 0x0F),
-      interval(sampleRate, 0x10), interval(sampleRate, 0x11), interval(sampleRate, 0x12), interval(sampleRate, 0x13), interval(sampleRate, 0x14), interval(sampleRate, 0x15), interval(sampleRate, 0x16), interval(sampleRate, 0x17),
-      interval(sampleRate, 0x18), interval(sampleRate, 0x19), interval(sampleRate, 0x1A), interval(sampleRate, 0x1B), interval(sampleRate, 0x1C), interval(sampleRate, 0x1D), interval(sampleRate, 0x1E), interval(sampleRate, 0x1F),
-      interval(sampleRate, 0x20), interval(sampleRate, 0x21), interval(sampleRate, 0x22), interval(sampleRate, 0x23), interval(sampleRate, 0x24), interval(sampleRate, 0x25), interval(sampleRate, 0x26), interval(sampleRate, 0x27),
-      interval(sampleRate, 0x28), interval(sampleRate, 0x29), interval(sampleRate, 0x2A), interval(sampleRate, 0x2B), interval(sampleRate, 0x2C), interval(sampleRate, 0x2D), interval(sampleRate, 0x2E), interval(sampleRate, 0x2F),
-      interval(sampleRate, 0x30), interval(sampleRate, 0x31), interval(sampleRate, 0x32), interval(sampleRate, 0x33), interval(sampleRate, 0x34), interval(sampleRate, 0x35), interval(sampleRate, 0x36), interval(sampleRate, 0x37),
-      interval(sampleRate, 0x38), interval(sampleRate, 0x39), interval(sampleRate, 0x3A), interval(sampleRate, 0x3B), interval(sampleRate, 0x3C), interval(sampleRate, 0x3D), interval(sampleRate, 0x3E), interval(sampleRate, 0x3F),
-      interval(sampleRate, 0x40), interval(sampleRate, 0x41), interval(sampleRate, 0x42), interval(sampleRate, 0x43), interval(sampleRate, 0x44), interval(sampleRate, 0x45), interval(sampleRate, 0x46), interval(sampleRate, 0x47),
-      interval(sampleRate, 0x48), interval(sampleRate, 0x49), interval(sampleRate, 0x4A), interval(sampleRate, 0x4B), interval(sampleRate, 0x4C), interval(sampleRate, 0x4D), interval(sampleRate, 0x4E), interval(sampleRate, 0x4F),
-      interval(sampleRate, 0x50), interval(sampleRate, 0x51), interval(sampleRate, 0x52), interval(sampleRate, 0x53), interval(sampleRate, 0x54), interval(sampleRate, 0x55), interval(sampleRate, 0x56), interval(sampleRate, 0x57),
-      interval(sampleRate, 0x58), interval(sampleRate, 0x59), interval(sampleRate, 0x5A), interval(sampleRate, 0x5B), interval(sampleRate, 0x5C), interval(sampleRate, 0x5D), interval(sampleRate, 0x5E), interval(sampleRate, 0x5F),
-      interval(sampleRate, 0x60), interval(sampleRate, 0x61), interval(sampleRate, 0x62), interval(sampleRate, 0x63), interval(sampleRate, 0x64), interval(sampleRate, 0x65), interval(sampleRate, 0x66), interval(sampleRate, 0x67),
-      interval(sampleRate, 0x68), interval(sampleRate, 0x69), interval(sampleRate, 0x6A), interval(sampleRate, 0x6B), interval(sampleRate, 0x6C), interval(sampleRate, 0x6D), interval(sampleRate, 0x6E), interval(sampleRate, 0x6F),
-      interval(sampleRate, 0x70), interval(sampleRate, 0x71), interval(sampleRate, 0x72), interval(sampleRate, 0x73), interval(sampleRate, 0x74), interval(sampleRate, 0x75), interval(sampleRate, 0x76), interval(sampleRate, 0x77),
-      interval(sampleRate, 0x78), interval(sampleRate, 0x79), interval(sampleRate, 0x7A), interval(sampleRate, 0x7B), interval(sampleRate, 0x7C), interval(sampleRate, 0x7D), interval(sampleRate, 0x7E), interval(sampleRate, 0x7F),
-    #else
-      // For samplingInterval = 0x65:
-      0x001B, 0x001D, 0x001E, 0x0020, 0x0022, 0x0024, 0x0026, 0x0029, 0x002B, 0x002E, 0x0030, 0x0033, 0x0036, 0x0039, 0x003D, 0x0040,
-      0x0044, 0x0048, 0x004D, 0x0051, 0x0056, 0x005B, 0x0060, 0x0066, 0x006C, 0x0073, 0x0079, 0x0081, 0x0088, 0x0090, 0x0099, 0x00A2,
-      0x00AC, 0x00B6, 0x00C1, 0x00CC, 0x00D8, 0x00E5, 0x00F3, 0x0101, 0x0111, 0x0121, 0x0132, 0x0144, 0x0158, 0x016C, 0x0182, 0x0199,
-      0x01B1, 0x01CB, 0x01E6, 0x0203, 0x0221, 0x0242, 0x0264, 0x0289, 0x02AF, 0x02D8, 0x0303, 0x0331, 0x0362, 0x0395, 0x03CC, 0x0406,
-      0x0443, 0x0484, 0x04C9, 0x0511, 0x055E, 0x05B0, 0x0607, 0x0663, 0x06C4, 0x072B, 0x0798, 0x080B, 0x0886, 0x0908, 0x0991, 0x0A23,
-      0x0ABD, 0x0B60, 0x0C0E, 0x0CC5, 0x0D87, 0x0E55, 0x0F30, 0x1017, 0x110C, 0x120F, 0x1322, 0x1445, 0x157A, 0x16C1, 0x181B, 0x198A,
-      0x1B0F, 0x1CAB, 0x1E5F, 0x202D, 0x2217, 0x241E, 0x2644, 0x288B, 0x2AF4, 0x2D82, 0x3036, 0x3314, 0x361E, 0x3955, 0x3CBE, 0x405B,
-      0x442F, 0x483C, 0x4C88, 0x5115, 0x55E7, 0x5B03, 0x606C, 0x6628, 0x6C3B, 0x72AB, 0x797C, 0x80B6, 0x885D, 0x9079, 0x9910, 0xA22A,
-    #endif
+    // Expands to the 64 entries of the given 'semitone' in the '_fineToSamplingInterval' table.
+    #define FINE_INTERVALS(semitone) \
+      fineInterval(sampleRate, semitone, 0x00), fineInterval(sampleRate, semitone, 0x01), fineInterval(sampleRate, semitone, 0x02), fineInterval(sampleRate, semitone, 0x03), fineInterval(sampleRate, semitone, 0x04), fineInterval(sampleRate, semitone, 0x05), fineInterval(sampleRate, semitone, 0x06), fineInterval(sampleRate, semitone, 0x07), \
+      fineInterval(sampleRate, semitone, 0x08), fineInterval(sampleRate, semitone, 0x09), fineInterval(sampleRate, semitone, 0x0A), fineInterval(sampleRate, semitone, 0x0B), fineInterval(sampleRate, semitone, 0x0C), fineInterval(sampleRate, semitone, 0x0D), fineInterval(sampleRate, semitone, 0x0E), fineInterval(sampleRate, semitone, 0x0F), \
+      fineInterval(sampleRate, semitone, 0x10), fineInterval(sampleRate, semitone, 0x11), fineInterval(sampleRate, semitone, 0x12), fineInterval(sampleRate, semitone, 0x13), fineInterval(sampleRate, semitone, 0x14), fineInterval(sampleRate, semitone, 0x15), fineInterval(sampleRate, semitone, 0x16), fineInterval(sampleRate, semitone, 0x17), \
+      fineInterval(sampleRate, semitone, 0x18), fineInterval(sampleRate, semitone, 0x19), fineInterval(sampleRate, semitone, 0x1A), fineInterval(sampleRate, semitone, 0x1B), fineInterval(sampleRate, semitone, 0x1C), fineInterval(sampleRate, semitone, 0x1D), fineInterval(sampleRate, semitone, 0x1E), fineInterval(sampleRate, semitone, 0x1F), \
+      fineInterval(sampleRate, semitone, 0x20), fineInterval(sampleRate, semitone, 0x21), fineInterval(sampleRate, semitone, 0x22), fineInterval(sampleRate, semitone, 0x23), fineInterval(sampleRate, semitone, 0x24), fineInterval(sampleRate, semitone, 0x25), fineInterval(sampleRate, semitone, 0x26), fineInterval(sampleRate, semitone, 0x27), \
+      fineInterval(sampleRate, semitone, 0x28), fineInterval(sampleRate, semitone, 0x29), fineInterval(sampleRate, semitone, 0x2A), fineInterval(sampleRate, semitone, 0x2B), fineInterval(sampleRate, semitone, 0x2C), fineInterval(sampleRate, semitone, 0x2D), fineInterval(sampleRate, semitone, 0x2E), fineInterval(sampleRate, semitone, 0x2F), \
+      fineInterval(sampleRate, semitone, 0x30), fineInterval(sampleRate, semitone, 0x31), fineInterval(sampleRate, semitone, 0x32), fineInterval(sampleRate, semitone, 0x33), fineInterval(sampleRate, semitone, 0x34), fineInterval(sampleRate, semitone, 0x35), fineInterval(sampleRate, semitone, 0x36), fineInterval(sampleRate, semitone, 0x37), \
+      fineInterval(sampleRate, semitone, 0x38), fineInterval(sampleRate, semitone, 0x39), fineInterval(sampleRate, semitone, 0x3A), fineInterval(sampleRate, semitone, 0x3B), fineInterval(sampleRate, semitone, 0x3C), fineInterval(sampleRate, semitone, 0x3D), fineInterval(sampleRate, semitone, 0x3E), fineInterval(sampleRate, semitone, 0x3F)
+
+    // Map pitches in the highest octave (MIDI notes [120 .. 131]) at a resolution of 1/64 semitone to the
+    // corresponding Q8.8 sampling interval.  Lower octaves halve the interval (see 'getSamplingInterval()').
+    constexpr static uint16_t _fineToSamplingInterval[12 * 64] PROGMEM = {
+      FINE_INTERVALS(0),
+      FINE_INTERVALS(1),
+      FINE_INTERVALS(2),
+      FINE_INTERVALS(3),
+      FINE_INTERVALS(4),
+      FINE_INTERVALS(5),
+      FINE_INTERVALS(6),
+      FINE_INTERVALS(7),
+      FINE_INTERVALS(8),
+      FINE_INTERVALS(9),
+      FINE_INTERVALS(10),
+      FINE_INTERVALS(11),
+    };
+
+    #undef FINE_INTERVALS
+
+    // Velocity curves applied by 'noteOn()', indexed by the instrument's 'VelocityCurve'.
+    enum VelocityCurve : uint8_t {
+      VelocityCurve_Full  = 0,                              // Default curve, peaking at full volume.
+      VelocityCurve_Half  = 1,                              // Instruments with 'InstrumentFlags_HalfAmplitude' peak at 1/2 volume.
+      VelocityCurve_Count = 2,
+    };
+
+    // Map MIDI velocity [0 .. 127] to the 7-bit gain for each 'VelocityCurve' (see 'velocityGain()').
+    constexpr static uint8_t _velocityToGain[VelocityCurve_Count][128] PROGMEM = {
+      { // VelocityCurve_Full: [0 .. 127]
+        velocityGain(0x00, 127), velocityGain(0x01, 127), velocityGain(0x02, 127), velocityGain(0x03, 127), velocityGain(0x04, 127), velocityGain(0x05, 127), velocityGain(0x06, 127), velocityGain(0x07, 127),
+        velocityGain(0x08, 127), velocityGain(0x09, 127), velocityGain(0x0A, 127), velocityGain(0x0B, 127), velocityGain(0x0C, 127), velocityGain(0x0D, 127), velocityGain(0x0E, 127), velocityGain(0x0F, 127),
+        velocityGain(0x10, 127), velocityGain(0x11, 127), velocityGain(0x12, 127), velocityGain(0x13, 127), velocityGain(0x14, 127), velocityGain(0x15, 127), velocityGain(0x16, 127), velocityGain(0x17, 127),
+        velocityGain(0x18, 127), velocityGain(0x19, 127), velocityGain(0x1A, 127), velocityGain(0x1B, 127), velocityGain(0x1C, 127), velocityGain(0x1D, 127), velocityGain(0x1E, 127), velocityGain(0x1F, 127),
+        velocityGain(0x20, 127), velocityGain(0x21, 127), velocityGain(0x22, 127), velocityGain(0x23, 127), velocityGain(0x24, 127), velocityGain(0x25, 127), velocityGain(0x26, 127), velocityGain(0x27, 127),
+        velocityGain(0x28, 127), velocityGain(0x29, 127), velocityGain(0x2A, 127), velocityGain(0x2B, 127), velocityGain(0x2C, 127), velocityGain(0x2D, 127), velocityGain(0x2E, 127), velocityGain(0x2F, 127),
+        velocityGain(0x30, 127), velocityGain(0x31, 127), velocityGain(0x32, 127), velocityGain(0x33, 127), velocityGain(0x34, 127), velocityGain(0x35, 127), velocityGain(0x36, 127), velocityGain(0x37, 127),
+        velocityGain(0x38, 127), velocityGain(0x39, 127), velocityGain(0x3A, 127), velocityGain(0x3B, 127), velocityGain(0x3C, 127), velocityGain(0x3D, 127), velocityGain(0x3E, 127), velocityGain(0x3F, 127),
+        velocityGain(0x40, 127), velocityGain(0x41, 127), velocityGain(0x42, 127), velocityGain(0x43, 127), velocityGain(0x44, 127), velocityGain(0x45, 127), velocityGain(0x46, 127), velocityGain(0x47, 127),
+        velocityGain(0x48, 127), velocityGain(0x49, 127), velocityGain(0x4A, 127), velocityGain(0x4B, 127), velocityGain(0x4C, 127), velocityGain(0x4D, 127), velocityGain(0x4E, 127), velocityGain(0x4F, 127),
+        velocityGain(0x50, 127), velocityGain(0x51, 127), velocityGain(0x52, 127), velocityGain(0x53, 127), velocityGain(0x54, 127), velocityGain(0x55, 127), velocityGain(0x56, 127), velocityGain(0x57, 127),
+        velocityGain(0x58, 127), velocityGain(0x59, 127), velocityGain(0x5A, 127), velocityGain(0x5B, 127), velocityGain(0x5C, 127), velocityGain(0x5D, 127), velocityGain(0x5E, 127), velocityGain(0x5F, 127),
+        velocityGain(0x60, 127), velocityGain(0x61, 127), velocityGain(0x62, 127), velocityGain(0x63, 127), velocityGain(0x64, 127), velocityGain(0x65, 127), velocityGain(0x66, 127), velocityGain(0x67, 127),
+        velocityGain(0x68, 127), velocityGain(0x69, 127), velocityGain(0x6A, 127), velocityGain(0x6B, 127), velocityGain(0x6C, 127), velocityGain(0x6D, 127), velocityGain(0x6E, 127), velocityGain(0x6F, 127),
+        velocityGain(0x70, 127), velocityGain(0x71, 127), velocityGain(0x72, 127), velocityGain(0x73, 127), velocityGain(0x74, 127), velocityGain(0x75, 127), velocityGain(0x76, 127), velocityGain(0x77, 127),
+        velocityGain(0x78, 127), velocityGain(0x79, 127), velocityGain(0x7A, 127), velocityGain(0x7B, 127), velocityGain(0x7C, 127), velocityGain(0x7D, 127), velocityGain(0x7E, 127), velocityGain(0x7F, 127),
+      },
+      { // VelocityCurve_Half: [0 .. 63]
+        velocityGain(0x00, 63), velocityGain(0x01, 63), velocityGain(0x02, 63), velocityGain(0x03, 63), velocityGain(0x04, 63), velocityGain(0x05, 63), velocityGain(0x06, 63), velocityGain(0x07, 63),
+        velocityGain(0x08, 63), velocityGain(0x09, 63), velocityGain(0x0A, 63), velocityGain(0x0B, 63), velocityGain(0x0C, 63), velocityGain(0x0D, 63), velocityGain(0x0E, 63), velocityGain(0x0F, 63),
+        velocityGain(0x10, 63), velocityGain(0x11, 63), velocityGain(0x12, 63), velocityGain(0x13, 63), velocityGain(0x14, 63), velocityGain(0x15, 63), velocityGain(0x16, 63), velocityGain(0x17, 63),
+        velocityGain(0x18, 63), velocityGain(0x19, 63), velocityGain(0x1A, 63), velocityGain(0x1B, 63), velocityGain(0x1C, 63), velocityGain(0x1D, 63), velocityGain(0x1E, 63), velocityGain(0x1F, 63),
+        velocityGain(0x20, 63), velocityGain(0x21, 63), velocityGain(0x22, 63), velocityGain(0x23, 63), velocityGain(0x24, 63), velocityGain(0x25, 63), velocityGain(0x26, 63), velocityGain(0x27, 63),
+        velocityGain(0x28, 63), velocityGain(0x29, 63), velocityGain(0x2A, 63), velocityGain(0x2B, 63), velocityGain(0x2C, 63), velocityGain(0x2D, 63), velocityGain(0x2E, 63), velocityGain(0x2F, 63),
+        velocityGain(0x30, 63), velocityGain(0x31, 63), velocityGain(0x32, 63), velocityGain(0x33, 63), velocityGain(0x34, 63), velocityGain(0x35, 63), velocityGain(0x36, 63), velocityGain(0x37, 63),
+        velocityGain(0x38, 63), velocityGain(0x39, 63), velocityGain(0x3A, 63), velocityGain(0x3B, 63), velocityGain(0x3C, 63), velocityGain(0x3D, 63), velocityGain(0x3E, 63), velocityGain(0x3F, 63),
+        velocityGain(0x40, 63), velocityGain(0x41, 63), velocityGain(0x42, 63), velocityGain(0x43, 63), velocityGain(0x44, 63), velocityGain(0x45, 63), velocityGain(0x46, 63), velocityGain(0x47, 63),
+        velocityGain(0x48, 63), velocityGain(0x49, 63), velocityGain(0x4A, 63), velocityGain(0x4B, 63), velocityGain(0x4C, 63), velocityGain(0x4D, 63), velocityGain(0x4E, 63), velocityGain(0x4F, 63),
+        velocityGain(0x50, 63), velocityGain(0x51, 63), velocityGain(0x52, 63), velocityGain(0x53, 63), velocityGain(0x54, 63), velocityGain(0x55, 63), velocityGain(0x56, 63), velocityGain(0x57, 63),
+        velocityGain(0x58, 63), velocityGain(0x59, 63), velocityGain(0x5A, 63), velocityGain(0x5B, 63), velocityGain(0x5C, 63), velocityGain(0x5D, 63), velocityGain(0x5E, 63), velocityGain(0x5F, 63),
+        velocityGain(0x60, 63), velocityGain(0x61, 63), velocityGain(0x62, 63), velocityGain(0x63, 63), velocityGain(0x64, 63), velocityGain(0x65, 63), velocityGain(0x66, 63), velocityGain(0x67, 63),
+        velocityGain(0x68, 63), velocityGain(0x69, 63), velocityGain(0x6A, 63), velocityGain(0x6B, 63), velocityGain(0x6C, 63), velocityGain(0x6D, 63), velocityGain(0x6E, 63), velocityGain(0x6F, 63),
+        velocityGain(0x70, 63), velocityGain(0x71, 63), velocityGain(0x72, 63), velocityGain(0x73, 63), velocityGain(0x74, 63), velocityGain(0x75, 63), velocityGain(0x76, 63), velocityGain(0x77, 63),
+        velocityGain(0x78, 63), velocityGain(0x79, 63), velocityGain(0x7A, 63), velocityGain(0x7B, 63), velocityGain(0x7C, 63), velocityGain(0x7D, 63), velocityGain(0x7E, 63), velocityGain(0x7F, 63),
+      },
     };
 
+  #ifdef VOICE_RECORDS
+    typedef VoiceState<VoiceRecord> Voices[Synth::numVoices];
+  #else
+    typedef VoiceState<VoiceArrays<Synth::numVoices>> Voices;
+  #endif
+
     // Note: Members prefixed with 'v_' (as in volatile) are shared with the ISR, and should only
     //       be accessed outside the ISR after calling 'suspend()' to suspend the ISR.
+    //
+    // State of the synth engine.
+    struct State {
+      volatile Voices     v_voices;                             // Per-voice state shared with the ISR (see 'VoiceState').
+      volatile uint8_t    v_frame;                              // Incremented each time the ISR has updated 'amp' for all voices.
+      uint16_t            noise;                                // 16-bit maximal-period Galois LFSR (only used by the ISR).
+      uint8_t             divider;                              // Time division of periodic work across interrupts (only used by the ISR).
+      uint8_t             note[Synth::numVoices];               // MIDI note currently played by the voice (for 'pitchBend()').
+      uint8_t             velocity[Synth::numVoices];           // Velocity gain of the current note (see '_velocityToGain'), used to recalculate 'vol' on 'setVolume()'.
+    };
 
-    static volatile const int8_t*	v_wave[Synth::numVoices];			    // Starting address of 256b wave table.
-    static volatile uint16_t		  v_phase[Synth::numVoices];			  // Phase accumulator holding the Q8.8 offset of the next sample.
-    static volatile uint16_t		  v_interval[Synth::numVoices];		  // Q8.8 sampling interval, used to advance the '_phase' accumulator.
-    static volatile int8_t			  v_xor[Synth::numVoices];			    // XOR bits applied to each sample (Note: clobbered if v_isNoise is true).
-    static volatile uint8_t			  v_amp[Synth::numVoices];			    // 6-bit amplitude scale applied to each sample.
-    static volatile bool			    v_isNoise[Synth::numVoices];		  // If true, '_xor' is periodically overwritten with random values.
-
-    static volatile Envelope			v_ampMod[Synth::numVoices];       // Amplitude modulation (0 .. 127, although most instruments peak below 96)
-    static volatile Envelope			v_freqMod[Synth::numVoices];		  // Frequency modulation (-64 .. +64)
-    static volatile Envelope			v_waveMod[Synth::numVoices];		  // Wave offset modulation (0 .. 127)
+    constexpr static uint16_t noiseSeed = 0xACE1;               // Initial state of 'noise'.
+
+    // Note: The engine state is static on AVR, so that the ISR accesses it at fixed addresses.  Elsewhere,
+    //       each synth has its own state (and 'isr()' / 'skip()' are instance methods), so that a host
+    //       process can run more than one synth.
+  #ifdef __AVR__
+    static State _state;
+    #define SYNTH_STATIC static
+  #else
+    State _state = { {}, 0, noiseSeed, 0, { 0 }, { 0 } };
+    #define SYNTH_STATIC
+  #endif
 
-    static volatile uint8_t			  v_vol[Synth::numVoices];			    // Additional 7-bit volume scalar (i.e., MIDI velocity).
+    // Tag used to select between the mono and stereo DAC hooks at compile time.
+    template <bool isStereo> struct Channels {};
+
+    static void output(uint16_t out, uint16_t, Channels<false>) __attribute__((always_inline)) { TDac::set(out); }
+    static void output(uint16_t left, uint16_t right, Channels<true>) __attribute__((always_inline)) { TDac::set(left, right); }
+    static void sendRightHiByte(Channels<false>) __attribute__((always_inline)) { }
+    static void sendRightHiByte(Channels<true>) __attribute__((always_inline)) { TDac::sendRightHiByte(); }
+    static void sendRightLoByte(Channels<false>) __attribute__((always_inline)) { }
+    static void sendRightLoByte(Channels<true>) __attribute__((always_inline)) { TDac::sendRightLoByte(); }
+
+    // Splits 'volume' into left/right channel volumes for the given MIDI 'pan' [0 .. 127].  The channel
+    // opposite the pan direction is attenuated linearly, such that center pan (64) plays both channels
+    // at full volume (i.e., the same level as the mono mix.)
+    static void panVolume(uint8_t volume, uint8_t pan, uint8_t& left, uint8_t& right) {
+      const uint8_t leftGain = pan <= 0x40 ? 0x80 : (0x7F - pan) << 1;       // [0 .. 128]
+      const uint8_t rightGain = pan >= 0x40 ? 0x80 : pan << 1;               // [0 .. 128]
+      left = (volume * leftGain) >> 7;
+      right = (volume * rightGain) >> 7;
+    }
 
-    static          uint16_t		  _baseInterval[Synth::numVoices];  // Original Q8.8 sampling internal, prior to modulation, pitch bend, etc.
-    static volatile uint16_t		  v_bentInterval[Synth::numVoices];	// Q8.8 sampling internal post pitch bend, but prior to freqMod.
-    static volatile const int8_t*	v_baseWave[Synth::numVoices];		  // Original starting address in wavetable.
-    static          uint8_t			  _note[Synth::numVoices];			    // Index of '_baseInternal' in the '_noteToSamplintInterval' table (for 'pitchBend()').
+    // Scales the note 'velocity' by the 7-bit 'volume' [0 .. 127] and splits the result into left/right
+    // channel volumes for the given 'pan' (see 'panVolume()').  If the DAC is mono, 'left' and 'right'
+    // are the same.
+    static void mixVolume(uint8_t velocity, uint8_t volume, uint8_t pan, uint8_t& left, uint8_t& right) {
+      const uint8_t scaled = (velocity * (volume + 1)) >> 7;    // (A volume of 127 leaves the velocity unchanged.)
+      left = right = scaled;
+      if (TDac::isStereo) {
+        panVolume(scaled, pan, left, right);
+      }
+    }
   
   public:
     void begin(){
-      DAC::setup();
+      TDac::setup();
+      Monitor::setup();
 
       // Setup Timer2 for sample/mix/output ISR.
       TCCR2A = _BV(WGM21);                // CTC Mode (Clears timer and raises interrupt when OCR2B reaches OCR2A)
@@ -137,13 +323,13 @@ class Synth {
       int8_t currentAmp;
     
       {
-        const volatile Envelope& currentMod	= v_ampMod[current];
+        const volatile Envelope& currentMod	= VOICE(current, ampMod);
         currentStage = currentMod.stageIndex;
         currentAmp = currentMod.value;
       }
 
       for (uint8_t candidate = maxVoice - 1; candidate < maxVoice; candidate--) {
-        const volatile Envelope& candidateMod = v_ampMod[candidate];
+        const volatile Envelope& candidateMod = VOICE(candidate, ampMod);
         const uint8_t candidateStage = candidateMod.stageIndex;
       
         if (candidateStage >= currentStage) {                 // If the currently chosen voice is in a later amplitude stage, keep it.
@@ -170,151 +356,258 @@ class Synth {
       return current;
     }
 
-    void noteOn(uint8_t voice, uint8_t note, uint8_t velocity, const Instrument& instrument) {
-      const uint8_t flags = instrument.flags;
+    // Begins playing the given 'note' on 'voice'.  The note 'velocity' is scaled by the 7-bit 'volume'
+    // (e.g., MIDI channel volume and expression).  The 'pan' is ignored unless the DAC is stereo.
+    void noteOn(uint8_t voice, uint8_t note, uint8_t velocity, const InstrumentRecord& record, uint8_t volume = 0x7F, uint8_t pan = 0x40) {
+      const uint8_t flags = record.flags;
       
-      if (flags & InstrumentFlags_HalfAmplitude) {                  // If the half-amplitude flag is set, play at 1/2 volume.  (Allows some
-        velocity >>= 1;                                             // reuse of amplitude envelopes for softer instruments, like hi-hats.)
-      }
+      const uint8_t curve = flags & InstrumentFlags_HalfAmplitude   // If the half-amplitude flag is set, play at 1/2 volume.  (Allows some
+        ? VelocityCurve_Half                                        // reuse of amplitude envelopes for softer instruments, like hi-hats.)
+        : VelocityCurve_Full;
+
+      const uint8_t gain                                            // Map the velocity to a gain once per note, so that the curve adds
+        = pgm_read_byte(&_velocityToGain[curve][velocity & 0x7F]);  // no per-sample cost to the ISR (it is folded into 'vol' below).
     
-      bool isNoise = flags & InstrumentFlags_Noise;                 // If true, the ISR will periodically overwrite 'v_xor[]' with a random
+      bool isNoise = flags & InstrumentFlags_Noise;                 // If true, the ISR will periodically overwrite 'xorBits' with a random
                                                                     // value, mixing the wavetable sample with noise.
     
       const uint8_t noteOffset = offsetTable[note >> 4];            // Optionally change the amplitude envelope from +[0 .. 3] based on the
-      uint8_t ampOffset = flags & InstrumentFlags_SelectAmplitude   // note played.  This helps with the realism of instruments with a wide
-        ? noteOffset                                                // range, like the piano, where higher notes have a shorter sustain.
-        : 0;
+      const EnvelopeStart* pAmpMod = &record.ampMod;                // note played.  This helps with the realism of instruments with a wide
+      EnvelopeStart ampModVariant;                                  // range, like the piano, where higher notes have a shorter sustain.
+      if ((flags & InstrumentFlags_SelectAmplitude) && noteOffset > 0) {
+        Instruments::getAmpModVariant(record.variants + noteOffset - 1, ampModVariant);
+        pAmpMod = &ampModVariant;
+      }
     
       uint8_t waveOffset = flags & InstrumentFlags_SelectWave       // Similarly, we can optionally shift the wavetable offset forward by
         ? noteOffset << 6                                           // multiples of 64 in the range +[0 .. 192].
         : 0;
     
-      _note[voice] = note;                                          // Remember the note being played (for calculating pitch bench later).
+      _state.note[voice] = note;                                    // Remember the note being played (for calculating pitch bench later).
+
+      const uint32_t samplingInterval = getSamplingInterval(note << 6);
+
+      _state.velocity[voice] = gain;                                // Remember the velocity gain (for recalculating volume later).
 
-      uint16_t samplingInterval = pgm_read_word(&_noteToSamplingInterval[note]);
+      uint8_t leftVolume;
+      uint8_t rightVolume;
+      mixVolume(gain, volume, pan, leftVolume, rightVolume);
 
       // Suspend audio processing before updating state shared with the ISR.
       suspend();
 
-      v_wave[voice] = v_baseWave[voice] = instrument.wave + waveOffset;
-      v_interval[voice] = v_bentInterval[voice] = _baseInterval[voice] = samplingInterval;
-      v_xor[voice] = instrument.xorBits;
-      v_amp[voice] = 0;
-      v_isNoise[voice] = isNoise;
-      v_vol[voice] = velocity;
-      v_ampMod[voice].start(instrument.ampMod + ampOffset);
-      v_freqMod[voice].start(instrument.freqMod);
-      v_waveMod[voice].start(instrument.waveMod);
+      const uint16_t wave = record.wave + waveOffset;
+      VOICE(voice, baseWave) = wave;
+      VOICE(voice, wave).set(wave);
+      VOICE(voice, interval) = VOICE(voice, bentInterval) = samplingInterval >> 8;
+      VOICE(voice, bentFraction) = static_cast<uint8_t>(samplingInterval);
+      VOICE(voice, xorBits) = record.xorBits;
+      VOICE(voice, amp) = 0;
+      VOICE(voice, isNoise) = isNoise;
+      VOICE(voice, vol) = leftVolume;
+      if (TDac::isStereo) {
+        VOICE(voice, ampR) = 0;
+        VOICE(voice, volR) = rightVolume;
+      }
+      VOICE(voice, ampMod).start(*pAmpMod);
+      VOICE(voice, freqMod).start(record.freqMod);
+      VOICE(voice, waveMod).start(record.waveMod);
     
       resume();
     }
 
     void noteOff(uint8_t voice) {
       suspend();                                                    // Suspend audio processing before updating state shared with the ISR.
-      v_ampMod[voice].stop();                                       // Move amplitude envelope to 'release' stage, if not there already.
+      VOICE(voice, ampMod).stop();                                  // Move amplitude envelope to 'release' stage, if not there already.
       resume();                                                     // Resume audio processing.
     }
   
+    // Returns the Q8.16 sampling interval for the given 'pitch' in 1/64ths of a semitone (i.e., the MIDI note
+    // << 6, plus any bend) in the range of MIDI notes [-2 .. 129].  The interval of the same pitch in the
+    // highest octave is halved once per octave below it, rounding to nearest, so no multiply is needed.
+    // The 8 extra fraction bits keep the bits shifted out of the Q8.8 interval, which would otherwise
+    // be up to ~64 cents at note 0.  The ISR applies them on average (see 'carry'), so every MIDI note
+    // is within 3 cents of the exact pitch (see 'host/tuning.cpp'.)
+    static uint32_t getSamplingInterval(int16_t pitch) {
+      const uint8_t note = (pitch >> 6) + 12;                       // Offset by one octave, so that notes bent below 0 are positive.
+      const uint8_t octave = note / 12;                             // [0 .. 11], where the '_fineToSamplingInterval' table holds octave 11.
+      const uint16_t index = ((note - octave * 12) << 6) | (pitch & 0x3F);
+
+      uint32_t interval = static_cast<uint32_t>(pgm_read_word(&_fineToSamplingInterval[index])) << 8;
+      const uint8_t shift = 11 - octave;
+      if (shift > 0) {
+        interval = ((interval >> (shift - 1)) + 1) >> 1;
+      }
+      return interval;
+    }
+
+    // Bends the pitch of the note playing on 'voice' by the given MIDI pitch bend 'value' [-8192 .. 8191],
+    // i.e., +/- 2 semitones.
     void pitchBend(uint8_t voice, int16_t value) {
-      uint16_t pitch = _baseInterval[voice];
-      
-      // DANGER: Bending the lowest and highest two notes will read outside the bounds
-      //         of the _noteToPitch[] table.  (Probably harmless. :)
-      uint16_t delta = value >= 0
-        ? pgm_read_word(&_noteToSamplingInterval[_note[voice] + 2]) - pitch
-        : pitch - pgm_read_word(&_noteToSamplingInterval[_note[voice] - 2]);
-
-      int32_t product;
-
-    #ifndef __EMSCRIPTEN__
-      // https://mekonik.wordpress.com/2009/03/18/arduino-avr-gcc-multiplication/
-      asm volatile (
-        "clr r26 \n\t"
-        "mul %A1, %A2 \n\t"
-        "movw %A0, r0 \n\t"
-        "mulsu %B1, %B2 \n\t"
-        "movw %C0, r0 \n\t"
-        "mul %B2, %A1 \n\t"
-        "add %B0, r0 \n\t"
-        "adc %C0, r1 \n\t"
-        "adc %D0, r26 \n\t"
-        "mulsu %B1, %A2 \n\t"
-        "sbc %D0, r26 \n\t"
-        "add %B0, r0 \n\t"
-        "adc %C0, r1 \n\t"
-        "adc %D0, r26 \n\t"
-        "clr r1 \n\t"
-        : "=&r" (product)
-        : "a" (value), "a" (delta)
-        : "r26");
-    #else
-      product = value * delta;
-    #endif
-
-      pitch += static_cast<int16_t>(product / 0x2000);
+      const int16_t bend = (value + 0x20) >> 6;                     // Round to the nearest 1/64 semitone [-128 .. 128].
+      const uint32_t pitch = getSamplingInterval((_state.note[voice] << 6) + bend);
 
       // Suspend audio processing before updating state shared with the ISR.
       suspend();
-      v_bentInterval[voice] = pitch;
+      VOICE(voice, bentInterval) = pitch >> 8;
+      VOICE(voice, bentFraction) = static_cast<uint8_t>(pitch);
       resume();
     }
   
+    // Updates the volume of the note playing on 'voice' for the given 7-bit 'volume' and MIDI 'pan'
+    // [0 .. 127].  The new volume is folded into 'vol' (and 'volR'), and takes effect the next time
+    // the ISR updates the voice's amplitude.  (The 'pan' is ignored unless the DAC is stereo.)
+    void setVolume(uint8_t voice, uint8_t volume, uint8_t pan) {
+      uint8_t leftVolume;
+      uint8_t rightVolume;
+      mixVolume(_state.velocity[voice], volume, pan, leftVolume, rightVolume);
+
+      suspend();
+      VOICE(voice, vol) = leftVolume;
+      if (TDac::isStereo) {
+        VOICE(voice, volR) = rightVolume;
+      }
+      resume();
+    }
+
+    // Returns the synth engine to its power-on state: silences all voices and restarts the noise LFSR
+    // and time divider, so that the output depends only on the messages received after 'reset()'.
+    // (Used by host tools that render more than once per process.)
+    void reset() {
+      suspend();
+      for (uint8_t voice = 0; voice < numVoices; voice++) {
+        VOICE(voice, wave).reset();
+        VOICE(voice, phase) = 0;
+        VOICE(voice, interval) = 0;
+        VOICE(voice, xorBits) = 0;
+        VOICE(voice, amp) = 0;
+        VOICE(voice, ampR) = 0;
+        VOICE(voice, isNoise) = false;
+        VOICE(voice, vol) = 0;
+        VOICE(voice, volR) = 0;
+        VOICE(voice, peak) = 0;
+        VOICE(voice, bentInterval) = 0;
+        VOICE(voice, bentFraction) = 0;
+        VOICE(voice, carry) = 0;
+        VOICE(voice, baseWave) = 0;
+        VOICE(voice, ampMod).reset();
+        VOICE(voice, freqMod).reset();
+        VOICE(voice, waveMod).reset();
+        _state.note[voice] = 0;
+        _state.velocity[voice] = 0;
+      }
+      _state.v_frame = 0;
+      _state.noise = noiseSeed;
+      _state.divider = 0;
+      resume();
+    }
+
     uint8_t getAmp(uint8_t voice) const {
-      return v_amp[voice];
+      return VOICE(voice, amp);
+    }
+
+    // Returns the index of the current stage of the amplitude envelope for the given voice.
+    uint8_t getAmpStage(uint8_t voice) const {
+      return VOICE(voice, ampMod).stageIndex;
+    }
+
+    // Returns the number of completed amplitude update passes (modulo 256).  Each pass updates 'amp'
+    // for all voices, and occurs every 256 samples.
+    uint8_t getFrame() const {
+      return _state.v_frame;
+    }
+
+    // Copies the peak amplitude of each voice since the previous call into 'peaks' and resets the peaks.
+    // (The ISR is suspended once for all voices rather than once per voice.)
+    void takePeaks(uint8_t peaks[Synth::numVoices]) {
+      suspend();
+      for (int8_t voice = maxVoice; voice >= 0; voice--) {
+        peaks[voice] = VOICE(voice, peak);
+        VOICE(voice, peak) = 0;
+      }
+      resume();
     }
   
-    static uint16_t isr() __attribute__((always_inline)) {
-      TIMSK2 = 0;         // Disable timer2 interrupts to prevent reentrancy.
-      sei();              // Re-enable interrupts to ensure USART RX ISR buffers incoming MIDI messages.
+  private:
+    // Performs the periodic work for the next sample: advances the noise LFSR and time divider, then
+    // advances one of the modulation envelopes of the voice selected by the divider and updates the
+    // state derived from it.  Returns the new value of the divider.
+    SYNTH_STATIC uint8_t tick() __attribute__((always_inline)) {
+      _state.noise = (_state.noise >> 1) ^ (-(_state.noise & 1) & 0xB400); // https://en.wikipedia.org/wiki/Linear-feedback_shift_register#Galois_LFSRs
     
-      {
-        static uint16_t noise = 0xACE1;                   // 16-bit maximal-period Galois LFSR
-        noise = (noise >> 1) ^ (-(noise & 1) & 0xB400);   // https://en.wikipedia.org/wiki/Linear-feedback_shift_register#Galois_LFSRs
-      
-        static uint8_t divider = 0;                       // Time division is used to spread lower-frequency / periodic work
-        divider++;                                        // across interrupts.
-      
-        const uint8_t voice = divider & 0x0F;				      // Bottom 4 bits of 'divider' selects which voice to perform work on.
+      _state.divider++;                                 // Time division is used to spread lower-frequency / periodic work
+      const uint8_t divider = _state.divider;           // across interrupts.
+    
+      const uint8_t voice = divider & 0x0F;				      // Bottom 4 bits of 'divider' selects which voice to perform work on.
+    
+      if (VOICE(voice, isNoise)) {                          // To avoid needing a large wavetable for noise, we use xor to combine
+        VOICE(voice, xorBits) = static_cast<uint8_t>(_state.noise); // the a 256B wavetable with samples from the LFSR.
+      }
+
+      const uint8_t fn = divider & 0xF0;                // Top 4 bits of 'divider' selects which additional work to perform.
+      switch (fn) {
+        case 0x00: {									                  // Advance frequency modulation and update 'interval' for the current voice.
+          int8_t freqMod = (VOICE(voice, freqMod).sample() - 0x40);
+          const uint16_t carry = VOICE(voice, carry) + VOICE(voice, bentFraction);      // The interval holds for the next 256 samples, so adding
+          VOICE(voice, carry) = static_cast<uint8_t>(carry);                            // 1 LSB whenever the summed fractions overflow makes the
+          VOICE(voice, interval) = VOICE(voice, bentInterval) + freqMod + (carry >> 8); // average interval the Q8.16 interval (see 'carry'.)
+          break;
+        }
       
-        if (v_isNoise[voice]) {                           // To avoid needing a large wavetable for noise, we use xor to combine
-          v_xor[voice] = static_cast<uint8_t>(noise);     // the a 256B wavetable with samples from the LFSR.
+        case 0x50: {									                  // Advance wave modulation and update 'wave' for the current voice.
+          int8_t waveMod = (VOICE(voice, waveMod).sample());
+          VOICE(voice, wave).set(VOICE(voice, baseWave) + waveMod);
+          break;
         }
 
-        const uint8_t fn = divider & 0xF0;                // Top 4 bits of 'divider' selects which additional work to perform.
-        switch (fn) {
-          case 0x00: {									                  // Advance frequency modulation and update 'v_pitch' for the current voice.
-            int8_t freqMod = (v_freqMod[voice].sample() - 0x40);
-            v_interval[voice] = v_bentInterval[voice] + freqMod;
-            break;
+        case 0xA0: {                                    // Advance the amplitude modulation and update 'amp' for the current voice.
+          uint16_t amp = VOICE(voice, ampMod).sample();
+          uint8_t scaled = (amp * VOICE(voice, vol)) >> 8;
+          VOICE(voice, amp) = scaled;
+          if (TDac::isStereo) {                         // If stereo, also update the right channel amplitude.
+            const uint8_t scaledR = (amp * VOICE(voice, volR)) >> 8;
+            VOICE(voice, ampR) = scaledR;
+            if (scaledR > scaled) { scaled = scaledR; } // (The meter displays the louder of the two channels.)
           }
-        
-          case 0x50: {									                  // Advance wave modulation and update 'v_wave' for the current voice.
-            int8_t waveMod = (v_waveMod[voice].sample());
-            v_wave[voice] = v_baseWave[voice] + waveMod;
-            break;
+          if (scaled > VOICE(voice, peak)) {            // Track the peak amplitude for the meter display.
+            VOICE(voice, peak) = scaled;
           }
-
-          case 0xA0: {                                    // Advance the amplitude modulation and update 'v_amp' for the current voice.
-            uint16_t amp = v_ampMod[voice].sample();
-            v_amp[voice] = (amp * v_vol[voice]) >> 8;
-            break;
+          if (voice == maxVoice) {                      // Once all voices have been updated, advance the frame
+            _state.v_frame++;                           // counter used to pace the meter display (~77 Hz).
+            Monitor::frame();
           }
+          break;
         }
       }
 
+      return divider;
+    }
+
+  public:
+    SYNTH_STATIC uint16_t isr() __attribute__((always_inline)) {
+      TIMSK2 = 0;         // Disable timer2 interrupts to prevent reentrancy.
+      sei();              // Re-enable interrupts to ensure USART RX ISR buffers incoming MIDI messages.
+    
+      tick();                                             // Advance noise and modulation (see 'tick()').
+
       // If using an SPI DAC, we transmit the sample computed in the previous ISR concurrently
       // with calculating the next sample.
-      DAC::sendHiByte();										                              // Begin transmitting upper 8-bits to DAC.
+      TDac::sendHiByte();										                              // Begin transmitting upper 8-bits to DAC.
 
-      // Macro that advances 'v_phase[voice]' by the sampling interval 'v_interval[voice]' and
+      // Macro that advances the 'phase' of the voice by its sampling 'interval' and
       // stores the next 8-bit sample offset as 'offset##voice'.
-      #define PHASE(voice) uint8_t offset##voice = ((v_phase[voice] += v_interval[voice]) >> 8)
+      #define PHASE(voice) uint8_t offset##voice = ((VOICE(voice, phase) += VOICE(voice, interval)) >> 8)
 
-      // Macro that samples the wavetable at the offset 'v_wave[voice] + offset##voice', and stores as 'sample##voice'.
-      #define SAMPLE(voice) int8_t sample##voice = (pgm_read_byte(v_wave[voice] + offset##voice))
+      // Macro that samples the wavetable at the offset 'wave + offset##voice', and stores as 'sample##voice'.
+      #define SAMPLE(voice) int8_t sample##voice = (VOICE(voice, wave).sample(offset##voice))
 
-      // Macro that applies 'v_xor[voice]' to 'sample##voice' and multiplies by 'v_amp[voice]'.
-      #define MIX(voice) ((sample##voice ^ v_xor[voice]) * v_amp[voice])
+      // Macro that applies 'xorBits' to 'sample##voice' and multiplies by 'amp'.
+      #define MIX(voice) ((sample##voice ^ VOICE(voice, xorBits)) * VOICE(voice, amp))
+
+      // Macro that applies 'xorBits' to 'sample##voice' and multiplies by 'ampR' (stereo only).
+      #define MIXR(voice) ((sample##voice ^ VOICE(voice, xorBits)) * VOICE(voice, ampR))
+
+      constexpr Channels<TDac::isStereo> channels = {};
     
       // We The below sampling/mixing code is carefully arranged to allow the compiler to make use of fixed
       // offsets for loads and stores, and to leave temporary calculations in register.
@@ -326,27 +619,48 @@ class Synth {
       SAMPLE(4); SAMPLE(5); SAMPLE(6); SAMPLE(7);                         // (Samples should stay in register.)
     
       int16_t mix = (MIX(0) + MIX(1) + MIX(2) + MIX(3)) >> 1;             // Apply xor, modulate by amp, and mix.
+      int16_t mixR = 0;
+      if (TDac::isStereo) {                                               // If stereo, mix the right channel from the same samples
+        mixR = (MIXR(0) + MIXR(1) + MIXR(2) + MIXR(3)) >> 1;              // while they are still in register.
+      }
+
       mix += (MIX(4) + MIX(5) + MIX(6) + MIX(7)) >> 1;
+      if (TDac::isStereo) {
+        mixR += (MIXR(4) + MIXR(5) + MIXR(6) + MIXR(7)) >> 1;
+      }
 
-      DAC::sendLoByte();													                        // First byte should be done, begin transmitting the lower 8-bits.
+      TDac::sendLoByte();													                        // First byte should be done, begin transmitting the lower 8-bits.
 
       PHASE(8); PHASE(9); PHASE(10); PHASE(11);                           // Advance the Q8.8 phase and calculate the 8-bit offsets into the wavetable.
       PHASE(12); PHASE(13); PHASE(14); PHASE(15);                         // (Load stores should use constant offsets and results should stay in register.)
-    
+
+      sendRightHiByte(channels);                                          // If stereo, begin transmitting upper 8-bits of the right channel.
+
       SAMPLE(8); SAMPLE(9); SAMPLE(10); SAMPLE(11);                       // Sample the wavetable at the offsets calculated above.
       SAMPLE(12); SAMPLE(13); SAMPLE(14); SAMPLE(15);                     // (Samples should stay in register.)
-    
+
       mix += (MIX(8) + MIX(9) + MIX(10) + MIX(11)) >> 1;                  // Apply xor, modulate by amp, and mix.
+      if (TDac::isStereo) {
+        mixR += (MIXR(8) + MIXR(9) + MIXR(10) + MIXR(11)) >> 1;
+      }
+
+      sendRightLoByte(channels);                                          // If stereo, begin transmitting lower 8-bits of the right channel.
+
       mix += (MIX(12) + MIX(13) + MIX(14) + MIX(15)) >> 1;
+      if (TDac::isStereo) {
+        mixR += (MIXR(12) + MIXR(13) + MIXR(14) + MIXR(15)) >> 1;
+      }
 
+      #undef MIXR
       #undef MIX
       #undef SAMPLE
       #undef PHASE
     
       const uint16_t wavOut = mix + 0x8000;
-      DAC::set(wavOut);													                          // Store resulting wave output for transmission on next interrupt.
+      output(wavOut, mixR + 0x8000, channels);                            // Store resulting wave output for transmission on next interrupt.
                                                                           // (If using SPI, also deselects DAC and clears EOT bit.)
     
+      Monitor::exit(samplingInterval);                                    // If enabled, record the ISR duration and detect overruns.
       TIMSK2 = _BV(OCIE2A);                                               // Restore timer2 interrupts.
     
       return wavOut;
@@ -366,39 +680,97 @@ class Synth {
       TIMSK2 = _BV(OCIE2A);
     }
   
+  #ifndef __AVR__
+    // Advances the synth by 'count' samples without sampling, mixing or output.  Leaves the synth in the
+    // same state as 'count' calls to 'isr()' (noise LFSR, time divider, envelopes, 'amp', 'interval',
+    // 'phase', etc.) at a fraction of the cost.  Used by 'host/render.cpp' to fast forward the control
+    // state to the start of each section of a song rendered in parallel.
+    void skip(uint32_t count) {
+      uint16_t phase[Synth::numVoices];                           // Non-volatile copies of 'phase' / 'interval', which
+      uint16_t interval[Synth::numVoices];                        // only 'tick()' changes while skipping.
+      for (uint8_t voice = 0; voice < numVoices; voice++) {
+        phase[voice] = VOICE(voice, phase);
+        interval[voice] = VOICE(voice, interval);
+      }
+
+      while (count-- > 0) {
+        const uint8_t divider = tick();
+        if ((divider & 0xF0) == 0x00) {                           // 'tick()' updated the 'interval' of the current voice.
+          interval[divider & 0x0F] = VOICE(divider & 0x0F, interval);
+        }
+        for (uint8_t voice = 0; voice < numVoices; voice++) {     // Advance the phase as 'PHASE(voice)' in 'isr()'.
+          phase[voice] += interval[voice];
+        }
+      }
+
+      for (uint8_t voice = 0; voice < numVoices; voice++) {
+        VOICE(voice, phase) = phase[voice];
+      }
+    }
+  #endif // !__AVR__
+
+    // Saves or restores the state of the synth engine, including the state private to the ISR (see
+    // 'snapshot.h').
+    template <typename TArchive> void serialize(TArchive& archive) {
+      suspend();
+      for (uint8_t voice = 0; voice < numVoices; voice++) {
+        VOICE(voice, wave).serialize(archive);
+        archive.io(VOICE(voice, phase));
+        archive.io(VOICE(voice, interval));
+        archive.io(VOICE(voice, xorBits));
+        archive.io(VOICE(voice, amp));
+        archive.io(VOICE(voice, ampR));
+        archive.io(VOICE(voice, isNoise));
+        archive.io(VOICE(voice, vol));
+        archive.io(VOICE(voice, volR));
+        archive.io(VOICE(voice, peak));
+        archive.io(VOICE(voice, bentInterval));
+        archive.io(VOICE(voice, bentFraction));
+        archive.io(VOICE(voice, carry));
+        archive.io(VOICE(voice, baseWave));
+        if (!archive.check(WaveWindow::isValidOffset(VOICE(voice, baseWave)))) {
+          VOICE(voice, baseWave) = 0;
+        }
+        VOICE(voice, ampMod).serialize(archive);
+        VOICE(voice, freqMod).serialize(archive);
+        VOICE(voice, waveMod).serialize(archive);
+      }
+      archive.io(_state.v_frame);
+      archive.io(_state.noise);
+      archive.io(_state.divider);
+      archive.io(_state.note);
+      archive.io(_state.velocity);
+      for (uint8_t voice = 0; voice < numVoices; voice++) {
+        if (!archive.check(_state.note[voice] <= 127)) {
+          _state.note[voice] = 0;
+        }
+      }
+      resume();
+    }
+
   #ifdef __EMSCRIPTEN__
-    Instrument instrument0;
+    InstrumentRecord instrument0;
 
     void noteOnEm(uint8_t voice, uint8_t note, uint8_t velocity, uint8_t instrumentIndex) {
-      Instruments::getInstrument(instrumentIndex, instrument0);
+      Instruments::getInstrumentRecord(instrumentIndex, instrument0);
       this->noteOn(voice, note, velocity, instrument0);
     }
   #endif // __EMSCRIPTEN__
 };
 
-constexpr uint16_t Synth::_noteToSamplingInterval[] PROGMEM;
-constexpr uint8_t Synth::offsetTable[];
-
-volatile const int8_t*  Synth::v_wave[Synth::numVoices]         = { 0 };
-volatile uint16_t       Synth::v_phase[Synth::numVoices]        = { 0 };
-volatile uint16_t       Synth::v_interval[Synth::numVoices]     = { 0 };
-volatile int8_t         Synth::v_xor[Synth::numVoices]          = { 0 };
-volatile uint8_t        Synth::v_amp[Synth::numVoices]          = { 0 };
-volatile bool           Synth::v_isNoise[Synth::numVoices]      = { 0 };
+template <typename TDac> constexpr uint16_t Synth<TDac>::_fineToSamplingInterval[] PROGMEM;
+template <typename TDac> constexpr uint8_t Synth<TDac>::offsetTable[];
+template <typename TDac> constexpr uint8_t Synth<TDac>::_velocityToGain[][128] PROGMEM;
 
-volatile Envelope       Synth::v_ampMod[Synth::numVoices]       = {};
-volatile Envelope       Synth::v_freqMod[Synth::numVoices]      = {};
-volatile Envelope       Synth::v_waveMod[Synth::numVoices]      = {};
-
-volatile uint8_t        Synth::v_vol[Synth::numVoices]          = { 0 };
-
-         uint16_t		    Synth::_baseInterval[Synth::numVoices]	= { 0 };
-volatile uint16_t		    Synth::v_bentInterval[Synth::numVoices]	= { 0 };
-volatile const int8_t*  Synth::v_baseWave[Synth::numVoices]	    = { 0 };
-         uint8_t		    Synth::_note[Synth::numVoices]			    = { 0 };
+#ifdef __AVR__
+template <typename TDac> typename Synth<TDac>::State Synth<TDac>::_state = { {}, 0, Synth<TDac>::noiseSeed, 0, { 0 }, { 0 } };
 
 SIGNAL(TIMER2_COMPA_vect) {
-  Synth::isr();
+  Synth<DAC>::isr();
 }
+#endif // __AVR__
+
+#undef SYNTH_STATIC
+#undef VOICE
 
 #endif // __SYNTH_H__
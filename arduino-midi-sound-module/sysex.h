@@ -0,0 +1,47 @@
+/*
+    Sysex messages
+    https://github.com/DLehenbauer/arduino-midi-sound-module
+
+    System exclusive messages used to query the optional diagnostics of the firmware.  All messages
+    use the manufacturer ID reserved for non-commercial use (0x7D), followed by a single command byte:
+
+      Request:  F0 7D 01 F7       Dump the voice usage counters (see 'voicestats.h')
+                F0 7D 03 F7       Reset the voice usage counters
+                F0 7D 04 F7       Dump (and reset) the ISR overrun counters (see 'isrmonitor.h')
+
+      Reply:    F0 7D 02 ... F7   Voice usage counters
+                F0 7D 05 ... F7   ISR overrun counters
+
+      Periodic: F0 7D 06 ... F7   Telemetry report (see 'telemetry.h')
+
+    Requests for diagnostics that were not enabled at compile time are ignored.
+
+    Multi-byte values in replies are sent 7 bits per byte, least significant first (see 'sendSysex7()').
+*/
+
+#ifndef __SYSEX_H__
+#define __SYSEX_H__
+
+#include <stdint.h>
+
+enum Sysex : uint8_t {
+  Sysex_Id                        = 0x7D,         // Manufacturer ID reserved for non-commercial use.
+  Sysex_VoiceStatsRequest         = 0x01,
+  Sysex_VoiceStatsReply           = 0x02,
+  Sysex_VoiceStatsReset           = 0x03,
+  Sysex_IsrStatsRequest           = 0x04,
+  Sysex_IsrStatsReply             = 0x05,
+  Sysex_Telemetry                 = 0x06
+};
+
+// Sends the 'numBytes' least significant 7-bit groups of 'value' via 'send(byte)', least significant
+// first.
+template <typename TSend>
+void sendSysex7(TSend send, uint32_t value, uint8_t numBytes) {
+  while (numBytes--) {
+    send(value & 0x7F);
+    value >>= 7;
+  }
+}
+
+#endif //__SYSEX_H__
@@ -0,0 +1,90 @@
+/*
+    Telemetry
+    https://github.com/DLehenbauer/arduino-midi-sound-module
+
+    Optional periodic health report, enabled by defining 'TELEMETRY' (which also enables the ISR
+    overrun monitor, see 'isrmonitor.h').  About once per second, 'update()' queues a sysex report
+    on USART TX:
+
+                F0 7D 06 <sequence: 1B> <activeVoices: 1B> <rxHighWater: 1B>
+                   <isrMaxCycles: 3B> <isrOverruns: 3B> <rxDropped: 3B>
+                F7
+
+      sequence      - Incremented (modulo 128) for each report, so that lost reports can be detected.
+      activeVoices  - Voices currently sounding.
+      rxHighWater   - Most bytes waiting in the MIDI receive buffer since the previous report.
+      isrMaxCycles  - Longest Timer2 ISR since the previous report (see 'IsrMonitor').
+      isrOverruns   - Timer2 ISRs that overran their period since the previous report.
+      rxDropped     - MIDI bytes dropped because the receive buffer was full (since reset, modulo 2^16).
+
+    Multi-byte values are sent 7 bits per byte, least significant first.  The report is queued for
+    the USART UDRE ISR (see 'Midi::trySend()'), so the main loop never waits for it to be sent.  If the
+    transmit buffer does not have room for the whole report (e.g., while a sysex reply is being sent)
+    the report is skipped, leaving a gap in 'sequence'.
+
+    At 31250 baud, each 16B report occupies the transmitter for ~5ms.  'host/telemetry.cpp' decodes a
+    captured stream of reports to CSV.
+*/
+
+#ifndef __TELEMETRY_H__
+#define __TELEMETRY_H__
+
+#include <stdint.h>
+#include "midi.h"
+#include "sysex.h"
+
+template <typename TSynth>
+class Telemetry final {
+  public:
+    static constexpr uint8_t framesPerReport = 77;      // Synth frames between reports (~77 Hz / 77 ~= 1 Hz)
+    static constexpr uint8_t reportLength = 16;
+
+  private:
+    uint8_t _lastFrame = 0;                             // Synth frame at which the last report was queued.
+    uint8_t _sequence = 0;                              // Sequence number of the next report.
+
+  public:
+    // Queues a report if at least 'framesPerReport' synth frames have passed since the last report.
+    // Called from the main 'loop()'.
+    void update(const TSynth& synth) {
+      const uint8_t frame = synth.getFrame();
+      if (static_cast<uint8_t>(frame - _lastFrame) < framesPerReport) {
+        return;
+      }
+      _lastFrame = frame;
+
+      uint8_t activeVoices = 0;
+      for (int8_t voice = TSynth::maxVoice; voice >= 0; voice--) {
+        if (synth.getAmp(voice) != 0) {
+          activeVoices++;
+        }
+      }
+
+      uint8_t rxHighWater;
+      uint16_t rxDropped;
+      Midi::takeRxStats(rxHighWater, rxDropped);
+
+      uint16_t isrMaxCycles, isrOverruns;
+      TSynth::Monitor::take(isrMaxCycles, isrOverruns);
+
+      uint8_t report[reportLength];
+      uint8_t* pNext = report;
+      auto store = [&pNext](uint8_t byte) { *pNext++ = byte; };
+
+      store(0xF0);
+      store(Sysex_Id);
+      store(Sysex_Telemetry);
+      store(_sequence);
+      store(activeVoices);
+      store(rxHighWater);
+      sendSysex7(store, isrMaxCycles, 3);
+      sendSysex7(store, isrOverruns, 3);
+      sendSysex7(store, rxDropped, 3);
+      store(0xF7);
+
+      Midi::trySend(report, reportLength);
+      _sequence = (_sequence + 1) & 0x7F;
+    }
+};
+
+#endif //__TELEMETRY_H__
@@ -0,0 +1,186 @@
+/*
+    Voice statistics
+    https://github.com/DLehenbauer/arduino-midi-sound-module
+
+    Optional profiling counters for voice usage, enabled by defining 'VOICE_STATS':
+
+      - The number of MIDI messages received of each type ('VoiceStatsEvent').
+      - The number of notes played by each voice, and how many of those stole a voice that was still
+        sounding (i.e., 'getNextVoice()' found no silent voice.)
+      - The number of frames each voice was sounding, the sum of the number of voices sounding at each
+        frame (i.e., average polyphony = polyphonyFrames / frames) and the peak polyphony.
+      - The number of voice-frames spent in each stage of the amplitude envelope.
+
+    A frame is one pass of the ISR's amplitude updates (see 'Synth::getFrame()', ~77 Hz).  Frame counts
+    are collected by 'update()' from the main 'loop()' rather than the ISR.  If the loop falls behind,
+    the voices are attributed with all frames elapsed since the previous 'update()', so the counts are
+    sampled rather than exact.  Message counts are updated as each message is dispatched.
+
+    When 'VOICE_STATS' is not defined, 'MidiSynth' uses 'NoVoiceStats', whose methods are empty.
+
+    The counters can be read via sysex (see 'sysex.h').  The reply to 'F0 7D 01 F7' is:
+
+                F0 7D 02 <numVoices> <numStages> <numEvents>
+                   <events[numEvents]: 3B each>
+                   <frames: 5B> <polyphonyFrames: 5B> <maxPolyphony: 1B>
+                   { <notes: 3B> <steals: 3B> <activeFrames: 5B> } x numVoices
+                   <stageFrames[numStages]: 5B each>
+                F7
+
+    The reply is 292B, which takes ~93ms to send at 31250 baud.  The reply is queued for the USART
+    UDRE ISR (see 'Midi::send()'), but the main loop waits whenever the transmit buffer is full, while
+    incoming MIDI is buffered by the USART RX ISR.  Dumps should therefore be requested while the synth
+    is idle.
+*/
+
+#ifndef __VOICESTATS_H__
+#define __VOICESTATS_H__
+
+#include <stdint.h>
+#include <string.h>
+#include "sysex.h"
+
+enum VoiceStatsEvent : uint8_t {
+  VoiceStatsEvent_NoteOn          = 0,
+  VoiceStatsEvent_NoteOff         = 1,
+  VoiceStatsEvent_ControlChange   = 2,
+  VoiceStatsEvent_ProgramChange   = 3,
+  VoiceStatsEvent_PitchBend       = 4,
+  VoiceStatsEvent_Sysex           = 5,
+  VoiceStatsEvent_Count           = 6
+};
+
+template <uint8_t numVoices>
+class VoiceStats final {
+  public:
+    static constexpr uint8_t numStages = 16;            // Stage indices are 4-bit (see 'EnvelopeStart::loopStartAndEnd').
+
+  private:
+    uint16_t _events[VoiceStatsEvent_Count];            // Messages received of each type.
+    uint16_t _notes[numVoices];                         // Notes played by each voice.
+    uint16_t _steals[numVoices];                        // Notes played by each voice while it was still sounding.
+    uint32_t _activeFrames[numVoices];                  // Frames during which each voice was sounding.
+    uint32_t _stageFrames[numStages];                   // Voice-frames spent in each stage of the amplitude envelope.
+    uint32_t _frames;                                   // Frames elapsed since 'reset()'.
+    uint32_t _polyphonyFrames;                          // Sum of the number of voices sounding in each frame.
+    uint8_t  _maxPolyphony;                             // Most voices sounding in a single frame.
+    uint8_t  _lastFrame;                                // Synth frame at which the counters were last updated.
+
+  public:
+    VoiceStats() { reset(); }
+
+    void reset() {
+      memset(_events, 0, sizeof(_events));
+      memset(_notes, 0, sizeof(_notes));
+      memset(_steals, 0, sizeof(_steals));
+      memset(_activeFrames, 0, sizeof(_activeFrames));
+      memset(_stageFrames, 0, sizeof(_stageFrames));
+      _frames = 0;
+      _polyphonyFrames = 0;
+      _maxPolyphony = 0;
+    }
+
+    // Resets the counters and resynchronizes with the frame counter of 'synth' (e.g., after the synth
+    // itself was reset.)
+    template <typename TSynth>
+    void reset(const TSynth& synth) {
+      reset();
+      _lastFrame = synth.getFrame();
+    }
+
+    void count(VoiceStatsEvent event) {
+      _events[event]++;
+    }
+
+    // Called by 'MidiSynth::midiNoteOn()' after choosing the 'voice', but before starting the note.
+    template <typename TSynth>
+    void noteOn(const TSynth& synth, uint8_t voice) {
+      count(VoiceStatsEvent_NoteOn);
+      _notes[voice]++;
+      if (synth.getAmp(voice) != 0) {
+        _steals[voice]++;
+      }
+    }
+
+    // Attributes the frames elapsed since the previous call to the voices currently sounding.  Called
+    // from the main 'loop()'.
+    template <typename TSynth>
+    void update(const TSynth& synth) {
+      const uint8_t frame = synth.getFrame();
+      const uint8_t elapsed = frame - _lastFrame;
+      if (elapsed == 0) {
+        return;
+      }
+      _lastFrame = frame;
+      _frames += elapsed;
+
+      uint8_t polyphony = 0;
+      for (int8_t voice = numVoices - 1; voice >= 0; voice--) {
+        if (synth.getAmp(voice) == 0) {
+          continue;
+        }
+
+        polyphony++;
+        _activeFrames[voice] += elapsed;
+
+        const uint8_t stage = synth.getAmpStage(voice);
+        if (stage < numStages) {
+          _stageFrames[stage] += elapsed;
+        }
+      }
+
+      _polyphonyFrames += static_cast<uint16_t>(polyphony) * elapsed;
+      if (polyphony > _maxPolyphony) {
+        _maxPolyphony = polyphony;
+      }
+    }
+
+    // Sends the sysex reply described above one byte at a time via 'send(byte)'.
+    template <typename TSend>
+    void dump(TSend send) const {
+      send(0xF0);
+      send(Sysex_Id);
+      send(Sysex_VoiceStatsReply);
+      send(numVoices);
+      send(numStages);
+      send(VoiceStatsEvent_Count);
+      for (uint8_t event = 0; event < VoiceStatsEvent_Count; event++) {
+        sendSysex7(send, _events[event], 3);
+      }
+      sendSysex7(send, _frames, 5);
+      sendSysex7(send, _polyphonyFrames, 5);
+      send(_maxPolyphony);
+      for (uint8_t voice = 0; voice < numVoices; voice++) {
+        sendSysex7(send, _notes[voice], 3);
+        sendSysex7(send, _steals[voice], 3);
+        sendSysex7(send, _activeFrames[voice], 5);
+      }
+      for (uint8_t stage = 0; stage < numStages; stage++) {
+        sendSysex7(send, _stageFrames[stage], 5);
+      }
+      send(0xF7);
+    }
+
+    uint16_t getEventCount(uint8_t event) const       { return _events[event]; }
+    uint16_t getNoteCount(uint8_t voice) const        { return _notes[voice]; }
+    uint16_t getStealCount(uint8_t voice) const       { return _steals[voice]; }
+    uint32_t getActiveFrames(uint8_t voice) const     { return _activeFrames[voice]; }
+    uint32_t getStageFrames(uint8_t stage) const      { return _stageFrames[stage]; }
+    uint32_t getFrames() const                        { return _frames; }
+    uint32_t getPolyphonyFrames() const               { return _polyphonyFrames; }
+    uint8_t  getMaxPolyphony() const                  { return _maxPolyphony; }
+};
+
+// Used in place of 'VoiceStats' when 'VOICE_STATS' is not defined.
+template <uint8_t numVoices>
+class NoVoiceStats final {
+  public:
+    void reset() { /* do nothing */ }
+    template <typename TSynth> void reset(const TSynth&) { /* do nothing */ }
+    void count(VoiceStatsEvent) { /* do nothing */ }
+    template <typename TSynth> void noteOn(const TSynth&, uint8_t) { /* do nothing */ }
+    template <typename TSynth> void update(const TSynth&) { /* do nothing */ }
+    template <typename TSend> void dump(TSend) const { /* do nothing */ }
+};
+
+#endif //__VOICESTATS_H__
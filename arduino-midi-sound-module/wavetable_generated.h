@@ -0,0 +1,486 @@
+/*
+    Deduplicated wavetable pages (generated by 'host/wavepack.cpp' from 'instruments_generated.h')
+    https://github.com/DLehenbauer/arduino-midi-sound-module
+*/
+
+static constexpr uint8_t WavePageIndex[] PROGMEM = {
+	/* 00: */ 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+	/* 10: */ 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f,
+	/* 20: */ 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a,
+	/* 30: */ 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a,
+	/* 40: */ 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2b, 0x2c, 0x2d,
+	/* 50: */ 0x2e, 0x2e,
+};
+
+static constexpr int8_t WavePages[][256] PROGMEM = {
+	/* Page 00 (wavetable offset 0000) */ {
+		/* 00: */   21,   11,    7,   11,   19,   25,   17,   -3,   -7,   -5,    1,    1,   -1,   -5,   -7,   -9,  -17,  -25,  -27,  -36,  -44,  -52,  -58,  -66,  -72,  -86, -113, -121, -127, -125, -117, -119,
+		/* 20: */ -119, -113, -101,  -60,  -46,  -48,  -66,  -72,  -86, -113, -121, -127, -125, -117, -119, -119, -113, -101,  -60,  -46,  -48,  -54,  -58,  -56,  -56,  -54,  -50,  -44,  -44,  -40,  -31,  -34,
+		/* 40: */   -1,   38,   64,   84,   95,   82,   64,   62,   64,   70,   80,  105,  107,   97,   88,   84,   86,   84,   74,   68,   68,   68,   82,   92,   99,  107,  103,   88,   82,   72,   60,   50,
+		/* 60: */   50,   52,   50,   50,   50,   50,   52,   50,   42,   42,   50,   54,   50,   48,   44,   44,   32,   31,   40,   48,   60,   76,   76,   64,   60,   58,   58,   54,   34,   29,   31,   34,
+		/* 80: */   37,   45,   35,   16,   -1,   -5,   -3,   -7,  -13,  -11,  -10,  -11,  -10,  -13,  -21,  -25,  -25,  -34,  -54,  -70,  -79,  -84,  -79,  -68,  -62,  -66,  -68,  -61,  -57,  -56,  -46,  -34,
+		/* a0: */  -37,  -45,  -40,  -28,  -21,  -21,  -24,  -35,  -50,  -49,  -36,  -27,  -29,  -38,  -47,  -48,  -26,   11,   29,   27,   25,   29,   30,   31,   36,   40,   32,   23,   28,   37,   39,   36,
+		/* c0: */  -27,  -56,  -79,  -94, -108, -117, -119, -115, -103,  -86,  -66,  -48,  -31,  -21,  -19,  -21,  -25,  -29,  -30,  -29,  -29,  -29,  -30,  -29,  -26,  -19,  -10,    1,    8,   11,   10,    2,
+		/* e0: */  -12,  -27,  -42,  -55,  -62,  -64,  -59,  -49,  -35,  -23,  -13,   -8,  -10,  -15,  -21,  -24,  -23,  -13,    6,   26,   44,   58,   62,   55,   42,   26,   11,   -2,   -5,   -4,    1,   -2,
+	},
+	/* Page 01 (wavetable offset 0100) */ {
+		/* 00: */  -19,  -16,  -14,  -14,  -16,  -20,  -21,  -23,  -26,  -33,  -42,  -55,  -69,  -86, -102, -117, -126, -127, -122, -109,  -91,  -73,  -56,  -44,  -39,  -36,  -36,  -32,  -25,  -14,    1,   12,
+		/* 20: */   20,   20,   11,   -6,  -24,  -40,  -51,  -58,  -60,  -58,  -55,  -53,  -52,  -52,  -54,  -56,  -60,  -64,  -64,  -60,  -55,  -50,  -48,  -47,  -50,  -55,  -62,  -66,  -65,  -60,  -49,  -35,
+		/* 40: */   12,    9,   12,   15,   15,   12,    9,   12,   20,   25,   31,   36,   41,   57,   66,   82,   87,   92,   95,   98,  106,  108,  106,  103,  103,  106,  108,  114,  116,  119,  119,  122,
+		/* 60: */  124,  127,  124,  122,  111,  106,   92,   87,   79,   76,   74,   74,   74,   71,   68,   63,   63,   63,   60,   49,   44,   36,   28,   23,    8,    8,    6,    5,    4,    0,   -4,   -5,
+		/* 80: */   -5,   -8,  -14,  -15,  -28,  -28,  -31,  -31,  -33,  -33,  -39,  -41,  -52,  -55,  -60,  -71,  -76,  -84,  -84,  -82,  -79,  -74,  -71,  -71,  -63,  -57,  -41,  -36,  -31,  -28,  -25,  -12,
+		/* a0: */   -9,   -7,   -7,   -4,    1,    4,    1,   -1,   -9,  -12,  -15,  -15,  -23,  -25,  -28,  -25,  -20,  -12,  -12,  -17,  -20,  -23,  -23,  -25,  -28,  -33,  -44,  -46,  -47,  -48,  -51,  -52,
+		/* c0: */  -65,  -66,  -70,  -69,  -68,  -69,  -72,  -78,  -82,  -83,  -85,  -91,  -98, -103, -106, -107, -111, -115, -120, -126, -127, -122, -117, -115, -115, -116, -117, -118, -117, -120, -124, -126,
+		/* e0: */ -124, -118, -110, -108, -107, -101,  -97,  -88,  -83,  -79,  -76,  -73,  -64,  -54,  -43,  -38,  -33,  -28,  -26,  -26,  -28,  -28,  -27,  -21,  -17,  -15,  -13,  -12,  -10,   -8,   -7,  -10,
+	},
+	/* Page 02 (wavetable offset 0200) */ {
+		/* 00: */    1,   -1,    1,    4,    9,    9,    7,    7,    9,   15,   20,   31,   36,   41,   49,   52,   52,   47,   33,   28,   23,   23,   23,   20,   17,   20,   23,   25,   28,   25,   28,   28,
+		/* 20: */   33,   36,   28,   25,   23,   23,   23,   20,   17,    7,    7,    7,    9,    9,    9,    9,   12,   15,   17,   17,   15,   15,   20,   25,   28,   28,   25,   21,   21,   21,   19,   16,
+		/* 40: */  -42,  -56,  -72,  -90, -106, -118, -125, -127, -126, -122, -118, -114, -110, -106, -103, -100,  -98,  -96,  -93,  -90,  -87,  -84,  -82,  -79,  -76,  -74,  -71,  -68,  -65,  -63,  -60,  -57,
+		/* 60: */  -56,  -53,  -51,  -48,  -45,  -44,  -41,  -38,  -33,  -30,  -29,  -26,  -23,  -22,  -20,  -17,  -14,  -11,  -10,   -8,   -5,   -2,    1,    4,    5,    8,   11,   13,   16,   17,   19,   20,
+		/* 80: */   22,   25,   26,   29,   32,   35,   36,   38,   39,   42,   44,   45,   47,   50,   53,   54,   56,   59,   62,   65,   68,   70,   72,   75,   78,   82,   85,   89,   94,   99,  103,  107,
+		/* a0: */  112,  117,  121,  125,  126,  127,  126,  123,  119,  111,  100,   85,   70,   54,   35,   14,   -6,  -23,  -38,  -52,  -65,  -75,  -82,  -86,  -90,  -93,  -94,  -96,  -96,  -95,  -94,  -94,
+		/* c0: */  -94,  -94,  -94,  -94,  -94,  -94,  -94,  -94,  -93,  -93,  -93,  -91,  -90,  -90,  -89,  -88,  -87,  -85,  -83,  -81,  -79,  -78,  -76,  -75,  -74,  -74,  -72,  -71,  -68,  -66,  -65,  -62,
+		/* e0: */  -60,  -57,  -56,  -54,  -51,  -48,  -45,  -44,  -41,  -36,  -33,  -29,  -27,  -23,  -19,  -14,  -10,   -7,   -2,    4,   10,   16,   20,   26,   33,   39,   44,   50,   56,   62,   67,   69,
+	},
+	/* Page 03 (wavetable offset 0300) */ {
+		/* 00: */   72,   74,   72,   68,   64,   56,   44,   30,   15,    0,  -17,  -36,  -55,  -70,  -82,  -93, -103, -109, -114, -116, -117, -118, -118, -118, -118, -117, -116, -115, -113, -111, -108, -106,
+		/* 20: */ -105, -105, -102, -100,  -99,  -96,  -94,  -93,  -90,  -87,  -85,  -84,  -81,  -78,  -75,  -73,  -71,  -68,  -64,  -61,  -59,  -56,  -51,  -48,  -45,  -44,  -41,  -36,  -33,  -32,  -32,  -36,
+		/* 40: */   -6,    3,   11,   17,   19,   27,   38,   48,   54,   53,   52,   49,   46,   42,   38,   33,   30,   22,    9,    0,   -4,   -3,   -2,    3,   11,   18,   25,   32,   37,   51,   69,   85,
+		/* 60: */   95,   98,   97,   94,   88,   84,   79,   72,   69,   61,   51,   43,   39,   40,   41,   49,   57,   63,   69,   74,   77,   86,   98,  112,  122,  126,  127,  127,  125,  123,  120,  115,
+		/* 80: */  107,  104,   92,   77,   66,   60,   57,   57,   55,   53,   52,   54,   60,   63,   75,   90,  101,  107,  108,  108,  106,  102,   98,   93,   86,   82,   70,   53,   38,   27,   21,   19,
+		/* a0: */   15,   11,    9,   10,   14,   17,   28,   44,   58,   66,   70,   71,   73,   73,   71,   68,   62,   59,   48,   32,   16,    6,    0,   -2,   -5,   -9,  -15,  -19,  -18,  -17,  -11,   -1,
+		/* c0: */    8,   14,   15,   15,   15,   18,   20,   22,   21,   14,   11,   -1,  -18,  -33,  -46,  -55,  -59,  -68,  -81,  -89,  -93,  -92,  -91,  -84,  -73,  -63,  -55,  -50,  -48,  -44,  -40,  -35,
+		/* e0: */  -37,  -41,  -44,  -55,  -69,  -81,  -90,  -97,  -99, -106, -115, -122, -126, -124, -122, -115, -104,  -96,  -90,  -85,  -83,  -77,  -69,  -59,  -52,  -49,  -50,  -56,  -67,  -77,  -84,  -90,
+	},
+	/* Page 04 (wavetable offset 0400) */ {
+		/* 00: */  -95,  -98, -106, -115, -122, -126, -127, -126, -121, -115, -108, -103,  -97,  -95,  -87,  -75,  -66,  -62,  -61,  -61,  -64,  -68,  -71,  -75,  -81,  -84,  -94, -108, -120, -126, -127, -126,
+		/* 20: */ -121, -113, -104,  -96,  -89,  -86,  -74,  -57,  -41,  -30,  -26,  -26,  -27,  -30,  -32,  -34,  -34,  -35,  -38,  -43,  -50,  -54,  -55,  -55,  -52,  -47,  -44,  -40,  -35,  -32,  -23,  -11,
+		/* 40: */   -5,    1,    3,    7,   10,   10,   10,    7,    4,    2,    2,    3,    5,    7,   11,   20,   28,   32,   41,   49,   56,   58,   61,   62,   62,   60,   57,   55,   53,   51,   52,   55,
+		/* 60: */   56,   62,   68,   71,   79,   89,   94,   96,   99,  100,   99,   97,   93,   91,   90,   89,   88,   90,   91,   95,  101,  107,  109,  114,  118,  120,  122,  121,  120,  118,  114,  108,
+		/* 80: */  104,  103,  100,   99,   99,  101,  105,  110,  112,  117,  123,  125,  127,  126,  123,  121,  116,  108,  101,   99,   94,   91,   90,   90,   92,   95,   96,  100,  101,  101,  101,   97,
+		/* a0: */   91,   89,   82,   73,   66,   64,   58,   53,   50,   50,   51,   53,   55,   57,   60,   63,   63,   62,   58,   53,   51,   42,   34,   31,   23,   15,   10,    9,    7,    7,    9,    9,
+		/* c0: */   12,   12,   12,   10,    6,    0,   -3,  -12,  -22,  -31,  -34,  -39,  -43,  -45,  -47,  -47,  -46,  -45,  -43,  -42,  -42,  -42,  -45,  -48,  -50,  -55,  -63,  -70,  -72,  -77,  -82,  -85,
+		/* e0: */  -85,  -85,  -83,  -82,  -79,  -77,  -76,  -76,  -78,  -83,  -89,  -91,  -99, -107, -109, -114, -119, -121, -121, -119, -114, -110, -109, -105, -102, -101, -101, -102, -105, -106, -110, -116,
+	},
+	/* Page 05 (wavetable offset 0500) */ {
+		/* 00: */ -120, -122, -125, -127, -127, -127, -124, -118, -116, -110, -104, -102,  -99,  -96,  -97,  -98, -101, -105, -109, -110, -114, -116, -116, -114, -108, -101,  -99,  -92,  -82,  -75,  -74,  -71,
+		/* 20: */  -69,  -69,  -69,  -71,  -74,  -74,  -76,  -77,  -75,  -73,  -69,  -64,  -62,  -56,  -48,  -42,  -40,  -35,  -30,  -28,  -28,  -30,  -31,  -31,  -33,  -34,  -33,  -32,  -28,  -20,  -11,   -9,
+		/* 40: */   -9,   -5,    5,   11,   20,   25,   30,   33,   36,   37,   40,   40,   37,   37,   35,   33,   31,   29,   27,   27,   25,   25,   27,   27,   29,   29,   31,   31,   33,   35,   37,   37,
+		/* 60: */   37,   37,   37,   35,   35,   33,   31,   31,   29,   27,   27,   27,   29,   31,   33,   35,   40,   45,   51,   57,   65,   71,   78,   84,   93,   98,  104,  108,  112,  117,  121,  123,
+		/* 80: */  125,  127,  127,  127,  127,  127,  125,  125,  123,  123,  123,  121,  121,  121,  121,  121,  121,  121,  119,  117,  115,  110,  107,  102,   98,   92,   86,   78,   72,   63,   58,   53,
+		/* a0: */   47,   42,   36,   32,   28,   25,   23,   23,   23,   25,   25,   27,   29,   32,   34,   36,   37,   40,   40,   40,   37,   37,   37,   35,   35,   33,   33,   31,   31,   31,   31,   31,
+		/* c0: */   31,   33,   33,   33,   35,   35,   35,   35,   35,   33,   32,   29,   25,   22,   15,   10,    2,   -5,  -14,  -22,  -32,  -40,  -49,  -56,  -61,  -70,  -74,  -80,  -83,  -87,  -90,  -94,
+		/* e0: */  -96,  -98, -100, -100, -102, -104, -106, -108, -110, -112, -115, -117, -119, -121, -124, -125, -127, -127, -127, -127, -125, -121, -118, -112, -108, -102,  -98,  -94,  -90,  -85,  -82,  -81,
+	},
+	/* Page 06 (wavetable offset 0600) */ {
+		/* 00: */  -79,  -77,  -77,  -77,  -79,  -79,  -81,  -85,  -87,  -92,  -94,  -97,  -99, -101, -102, -104, -104, -104, -104, -104, -102, -102, -100, -100, -100, -100, -100, -102, -104, -106, -108, -110,
+		/* 20: */ -112, -117, -119, -121, -121, -123, -123, -121, -121, -118, -113, -109, -104,  -99,  -92,  -86,  -78,  -71,  -62,  -56,  -49,  -44,  -40,  -33,  -29,  -25,  -23,  -19,  -17,  -15,  -12,   -9,
+		/* 40: */   20,   24,   30,   37,   45,   54,   65,   74,   83,   89,   92,   92,   90,   85,   77,   67,   59,   50,   40,   29,   17,    6,   -6,  -16,  -26,  -33,  -38,  -44,  -49,  -54,  -57,  -59,
+		/* 60: */  -62,  -64,  -64,  -62,  -57,  -51,  -42,  -34,  -27,  -21,  -17,  -16,  -17,  -20,  -23,  -27,  -29,  -32,  -36,  -41,  -47,  -55,  -64,  -74,  -85,  -94, -101, -108, -113, -118, -120, -122,
+		/* 80: */ -122, -122, -120, -118, -115, -113, -109, -107, -106, -107, -109, -113, -118, -122, -125, -127, -127, -127, -125, -123, -122, -123, -125, -126, -125, -123, -119, -111, -101,  -90,  -78,  -67,
+		/* a0: */  -58,  -51,  -42,  -35,  -28,  -22,  -15,  -10,   -3,    1,    3,    6,    6,    3,    3,    1,   -1,   -4,  -10,  -16,  -23,  -30,  -38,  -43,  -45,  -44,  -41,  -35,  -26,  -16,   -7,    2,
+		/* c0: */   10,   18,   28,   38,   50,   63,   77,   91,  104,  114,  120,  125,  127,  127,  124,  118,  113,  108,  101,   96,   88,   81,   73,   66,   61,   57,   55,   53,   52,   50,   50,   50,
+		/* e0: */   50,   52,   55,   60,   67,   76,   86,   98,  108,  115,  120,  125,  127,  127,  125,  125,  125,  123,  122,  120,  115,  109,  101,   93,   84,   76,   69,   62,   57,   53,   50,   48,
+	},
+	/* Page 07 (wavetable offset 0700) */ {
+		/* 00: */   48,   48,   48,   49,   51,   53,   56,   57,   57,   55,   53,   48,   43,   36,   31,   28,   27,   27,   27,   25,   24,   22,   17,   15,   13,   12,   13,   17,   24,   33,   41,   49,
+		/* 20: */   55,   59,   64,   67,   71,   74,   78,   80,   83,   85,   85,   83,   80,   76,   71,   66,   62,   56,   48,   39,   28,   19,    8,   -1,   -7,  -11,  -12,  -10,   -6,    0,    7,   14,
+		/* 40: */   67,   72,   79,   86,   94,  101,  109,  115,  120,  125,  127,  127,  124,  118,  112,  104,   96,   78,   51,   17,  -20,  -54,  -79,  -97, -108, -117, -124, -127, -127, -125, -122, -120,
+		/* 60: */ -118, -115, -112, -110, -107, -104, -100,  -97,  -92,  -86,  -79,  -71,  -64,  -56,  -50,  -46,  -41,  -39,  -43,  -49,  -53,  -54,  -52,  -47,  -43,  -37,  -31,  -25,  -21,  -19,  -20,  -22,
+		/* 80: */  -23,  -26,  -26,  -23,  -17,  -11,   -7,   -1,    5,   10,   16,   20,   25,   29,   31,   35,   36,   33,   25,   14,    2,   -6,  -11,  -14,  -17,  -19,  -20,  -20,  -19,  -16,  -14,  -13,
+		/* a0: */  -14,  -16,  -19,  -22,  -25,  -26,  -25,  -25,  -26,  -28,  -32,  -37,  -40,  -40,  -39,  -35,  -33,  -35,  -41,  -49,  -54,  -56,  -54,  -50,  -44,  -38,  -32,  -25,  -18,  -12,   -5,    1,
+		/* c0: */    7,   14,   22,   28,   32,   38,   44,   50,   55,   61,   65,   70,   72,   76,   79,   81,   82,   79,   67,   51,   34,   16,    0,  -11,  -18,  -22,  -23,  -22,  -20,  -16,  -10,   -4,
+		/* e0: */    4,   11,   18,   24,   31,   38,   46,   53,   59,   67,   73,   78,   83,   88,   92,   97,   99,   97,   91,   85,   76,   66,   59,   53,   47,   41,   36,   32,   28,   23,   17,   10,
+	},
+	/* Page 08 (wavetable offset 0800) */ {
+		/* 00: */    2,   -4,   -7,   -8,   -6,   -2,    2,    7,   13,   19,   23,   28,   32,   37,   41,   46,   48,   47,   42,   32,   22,   12,    7,    5,    4,    4,    4,    5,    7,   11,   17,   23,
+		/* 20: */   29,   33,   38,   43,   49,   53,   58,   60,   59,   56,   52,   46,   41,   39,   39,   41,   42,   40,   34,   25,   17,   12,   13,   16,   20,   24,   29,   34,   40,   46,   53,   59,
+		/* 40: */  -20,    0,   17,   46,   73,   90,   98,  106,  114,  120,  125,  127,  127,  124,  122,  120,  118,  117,  115,  114,  112,  109,  107,  106,  104,  103,  103,  100,   98,   96,   96,   94,
+		/* 60: */   92,   91,   90,   88,   87,   86,   85,   83,   82,   81,   80,   80,   78,   76,   75,   74,   73,   71,   71,   69,   68,   68,   67,   65,   64,   64,   63,   62,   62,   59,   51,   40,
+		/* 80: */   28,    1,  -28,  -44,  -64,  -79,  -86,  -96, -108, -116, -121, -125, -127, -127, -124, -122, -121, -121, -119, -117, -117, -115, -113, -112, -112, -110, -109, -108, -106, -105, -105, -104,
+		/* a0: */ -103, -102, -101, -100,  -99,  -99,  -97,  -96,  -95,  -95,  -94,  -93,  -92,  -91,  -90,  -90,  -89,  -88,  -87,  -87,  -86,  -85,  -85,  -84,  -83,  -82,  -82,  -81,  -80,  -80,  -80,  -78,
+		/* c0: */  -77,  -77,  -77,  -76,  -76,  -75,  -74,  -74,  -73,  -73,  -72,  -72,  -71,  -71,  -71,  -69,  -69,  -68,  -68,  -68,  -67,  -67,  -67,  -65,  -65,  -65,  -64,  -64,  -64,  -63,  -63,  -63,
+		/* e0: */  -62,  -62,  -60,  -60,  -60,  -59,  -59,  -59,  -59,  -59,  -58,  -58,  -56,  -56,  -56,  -56,  -56,  -55,  -55,  -54,  -54,  -54,  -52,  -48,  -36,  -11,   18,   38,   67,   88,   94,   91,
+	},
+	/* Page 09 (wavetable offset 0900) */ {
+		/* 00: */   80,   68,   45,   21,    6,   -1,   -8,  -16,  -23,  -35,  -47,  -56,  -59,  -62,  -64,  -64,  -63,  -62,  -62,  -62,  -60,  -60,  -60,  -59,  -59,  -59,  -58,  -58,  -56,  -56,  -56,  -55,
+		/* 20: */  -55,  -55,  -54,  -54,  -54,  -54,  -53,  -53,  -53,  -51,  -51,  -51,  -51,  -50,  -50,  -50,  -50,  -50,  -49,  -49,  -49,  -49,  -47,  -47,  -47,  -47,  -46,  -46,  -46,  -42,  -36,  -31,
+		/* 40: */  -19,    0,   25,   46,   64,   78,   86,   86,   83,   75,   66,   58,   52,   44,   40,   40,   41,   44,   52,   58,   66,   74,   79,   85,   91,   94,   98,  102,  105,  105,  101,   98,
+		/* 60: */   94,   90,   87,   82,   77,   71,   64,   57,   48,   37,   29,   20,    9,   -3,  -15,  -25,  -29,  -36,  -38,  -38,  -41,  -41,  -44,  -50,  -55,  -63,  -71,  -83,  -96, -103, -111, -121,
+		/* 80: */ -125, -127, -124, -121, -112,  -99,  -82,  -66,  -53,  -40,  -28,  -19,  -13,   -9,   -4,   -1,    3,    9,   13,   22,   31,   40,   45,   53,   58,   61,   67,   72,   75,   79,   83,   88,
+		/* a0: */   94,   96,   98,  100,  101,  105,  108,  109,  110,  112,  114,  120,  123,  125,  127,  127,  126,  123,  120,  113,  105,   97,   88,   78,   67,   58,   43,   29,   15,    4,   -3,  -17,
+		/* c0: */  -66,  -63,  -58,  -55,  -54,  -51,  -46,  -42,  -39,  -33,  -30,  -29,  -25,  -19,  -15,  -11,   -5,   -2,    0,    3,    8,   12,   16,   22,   26,   30,   36,   40,   41,   44,   50,   53,
+		/* e0: */   57,   62,   65,   66,   69,   75,   78,   81,   85,   87,   87,   90,   95,   98,  100,  104,  105,  105,  107,  111,  113,  114,  117,  118,  118,  119,  121,  122,  122,  125,  125,  125,
+	},
+	/* Page 0a (wavetable offset 0a00) */ {
+		/* 00: */  127,  127,  127,  127,  127,  127,  127,  125,  125,  125,  125,  123,  123,  123,  120,  120,  120,  119,  115,  114,  113,  110,  109,  109,  107,  104,  102,  100,   95,   93,   93,   91,
+		/* 20: */   87,   86,   83,   79,   77,   77,   74,   69,   66,   64,   59,   57,   54,   49,   46,   46,   43,   38,   35,   33,   28,   26,   26,   23,   18,   15,   12,    8,    5,    5,    3,    0,
+		/* 40: */  -13,  -19,  -25,  -30,  -37,  -45,  -51,  -59,  -65,  -72,  -77,  -81,  -86,  -89,  -93,  -96, -101, -105, -108, -113, -117, -121, -123, -126, -127, -127, -125, -124, -121, -118, -113, -109,
+		/* 60: */ -106, -102,  -98,  -92,  -88,  -82,  -77,  -72,  -66,  -61,  -53,  -46,  -38,  -32,  -27,  -21,  -17,  -12,   -8,   -4,   -2,    0,    4,    6,    8,   10,   10,   12,   12,   12,   12,   10,
+		/* 80: */   10,    8,    7,    5,    4,    2,    0,   -2,   -6,   -8,  -10,  -12,  -14,  -16,  -18,  -22,  -24,  -26,  -28,  -30,  -32,  -34,  -36,  -38,  -40,  -40,  -42,  -44,  -44,  -44,  -46,  -46,
+		/* a0: */  -46,  -48,  -48,  -48,  -46,  -46,  -46,  -46,  -44,  -44,  -44,  -42,  -40,  -38,  -38,  -36,  -36,  -34,  -32,  -30,  -28,  -26,  -24,  -22,  -20,  -18,  -16,  -13,  -12,  -10,   -8,   -6,
+		/* c0: */   -2,    0,    2,    4,    6,    8,   10,   12,   14,   16,   18,   18,   20,   22,   24,   26,   28,   28,   30,   32,   32,   34,   34,   36,   36,   36,   38,   38,   40,   40,   40,   40,
+		/* e0: */   40,   40,   40,   40,   40,   42,   42,   42,   42,   42,   42,   42,   42,   42,   42,   44,   44,   46,   46,   48,   48,   50,   52,   52,   54,   56,   58,   60,   62,   64,   65,   67,
+	},
+	/* Page 0b (wavetable offset 0b00) */ {
+		/* 00: */   69,   73,   75,   79,   81,   82,   85,   87,   91,   93,   97,   99,  101,  103,  105,  109,  111,  115,  117,  118,  120,  121,  123,  123,  125,  125,  125,  127,  127,  127,  127,  125,
+		/* 20: */  125,  123,  121,  119,  117,  115,  113,  111,  109,  105,  102,   97,   93,   87,   83,   80,   74,   70,   64,   60,   54,   50,   46,   40,   35,   28,   22,   15,   10,    5,   -1,   -7,
+		/* 40: */  -12,  -16,  -18,  -24,  -32,  -34,  -42,  -51,  -59,  -61,  -69,  -74,  -76,  -81,  -90,  -98, -102, -110, -118, -121, -125, -127, -127, -126, -123, -118, -116, -112, -108, -107, -107, -106,
+		/* 60: */ -105, -105, -102,  -99,  -95,  -93,  -87,  -82,  -80,  -73,  -63,  -52,  -48,  -35,  -24,  -20,  -10,   -1,    7,    9,   14,   19,   21,   27,   32,   36,   38,   42,   45,   46,   50,   54,
+		/* 80: */   56,   56,   55,   53,   52,   48,   44,   41,   40,   37,   34,   34,   33,   33,   34,   34,   35,   38,   38,   40,   43,   43,   43,   40,   36,   34,   29,   24,   21,   20,   17,   14,
+		/* a0: */   12,    6,   -3,  -10,  -12,  -17,  -20,  -20,  -21,  -19,  -15,  -13,   -8,   -4,   -3,   -2,   -3,   -6,   -8,  -11,  -13,  -14,  -17,  -20,  -23,  -23,  -24,  -24,  -22,  -22,  -19,  -17,
+		/* c0: */   30,   35,   41,   51,   56,   58,   58,   54,   44,   39,   29,   25,   25,   29,   37,   42,   49,   56,   56,   51,   46,   32,   25,   20,   18,   20,   25,   29,   32,   34,   34,   34,
+		/* e0: */   32,   32,   32,   34,   35,   35,   37,   35,   30,   25,   13,   10,    6,    8,   13,   18,   22,   34,   39,   42,   41,   30,   22,   13,   -1,   -4,   -1,    4,   25,   35,   54,   60,
+	},
+	/* Page 0c (wavetable offset 0c00) */ {
+		/* 00: */   61,   58,   53,   42,   39,   34,   35,   37,   49,   56,   67,   70,   73,   73,   79,   82,   84,   87,   89,   91,   92,   94,   92,   91,   84,   80,   82,   87,   99,  106,  117,  120,
+		/* 20: */  124,  127,  125,  115,  108,   96,   92,   89,   86,   87,   89,   91,   94,   94,   89,   86,   80,   65,   58,   37,   25,    8,   18,    6,  -10,  -15,  -23,  -27,  -30,  -29,  -25,  -25,
+		/* 40: */  -27,  -37,  -44,  -58,  -65,  -77,  -84,  -91, -103, -106, -108, -108, -108, -108, -110, -110, -108, -110, -111, -118, -120, -125, -125, -127, -127, -125, -122, -122, -120, -120, -117, -113,
+		/* 60: */ -110, -101,  -99,  -98,  -96,  -87,  -82,  -77,  -73,  -75,  -79,  -79,  -72,  -67,  -63,  -65,  -65,  -63,  -61,  -54,  -51,  -51,  -51,  -51,  -48,  -44,  -39,  -39,  -37,  -37,  -35,  -34,
+		/* 80: */  -30,  -27,  -25,  -23,  -23,  -23,  -20,  -18,  -11,   -8,   -8,  -10,  -11,  -10,   -3,   -1,    1,    1,    1,    1,    1,    6,    6,    8,   10,   10,   15,   18,   20,   20,   16,   15,
+		/* a0: */   13,   16,   20,   27,   29,   30,   29,   29,   27,   27,   29,   30,   34,   35,   39,   39,   39,   35,   34,   29,   29,   32,   37,   42,   49,   51,   51,   48,   41,   37,   30,   30,
+		/* c0: */   39,   64,   73,   87,   98,  105,  113,  119,  125,  127,  125,  120,  111,  100,   84,   65,   52,   38,   30,   24,   24,   28,   35,   46,   56,   66,   72,   74,   73,   72,   70,   69,
+		/* e0: */   71,   71,   73,   77,   82,   88,   91,   91,   88,   82,   75,   66,   57,   46,   39,   32,   27,   24,   19,   15,   12,   13,   23,   34,   51,   61,   71,   75,   75,   74,   72,   55,
+	},
+	/* Page 0d (wavetable offset 0d00) */ {
+		/* 00: */   -9,  -10,   -8,   -5,    2,   14,   26,   35,   50,   68,   81,   86,   91,   95,   96,   96,   95,   91,   87,   83,   75,   61,   48,   38,   21,    3,   -9,  -11,   -7,    8,   24,   36,
+		/* 20: */   51,   69,   79,   83,   87,   88,   88,   89,   91,   93,   96,   97,   99,   99,   98,   98,   95,   89,   84,   81,   75,   68,   62,   58,   52,   43,   36,   30,   23,   18,   14,   13,
+		/* 40: */   15,   18,   23,   25,   27,   30,   33,   35,   43,   58,   74,   85,  100,  115,  123,  126,  127,  125,  122,  118,  112,  103,   96,   92,   90,   88,   88,   88,   86,   81,   75,   69,
+		/* 60: */   62,   59,   61,   68,   81,   97,  109,  114,  118,  118,  114,  109,   94,   72,   51,   37,   20,    6,    1,    1,    5,   10,   13,   13,   16,   21,   28,   35,   49,   67,   80,   86,
+		/* 80: */   89,   88,   82,   74,   57,   33,   12,   -2,  -21,  -39,  -52,  -59,  -71,  -87, -101, -108, -118, -125, -127, -126, -120, -106,  -89,  -75,  -51,  -24,   -5,    3,    4,    2,   -4,   -6,
+		/* a0: */   -4,    4,   13,   19,   25,   29,   28,   22,    6,  -21,  -47,  -62,  -82,  -97, -103, -104, -100,  -92,  -86,  -81,  -74,  -67,  -63,  -61,  -57,  -52,  -46,  -42,  -34,  -26,  -18,  -11,
+		/* c0: */  -12,  -14,  -17,  -18,  -23,  -27,  -29,  -28,  -23,  -14,   -5,   -2,    5,    5,   -2,   -7,  -29,  -60,  -90,  -99, -115, -125, -125, -122, -110,  -86,  -61,  -52,  -29,  -13,  -13,  -18,
+		/* e0: */  -40,  -71,  -96, -103, -116, -123, -123, -122, -119, -115, -112, -111, -111, -111, -110, -109, -104,  -95,  -83,  -79,  -68,  -59,  -57,  -58,  -66,  -75,  -80,  -80,  -73,  -55,  -30,  -22,
+	},
+	/* Page 0e (wavetable offset 0e00) */ {
+		/* 00: */   74,   -8,  -17,   74,   60,   40,   97,    8,   15,   62,   -2,  -78,  -71,   17,  -11,  -56,    4,  -29,   15,  -60,  -73,   43,   42,   -6,   14,   25,   68,   -7,   -9,   39,   31,   60,
+		/* 20: */   31,  -65,  -12,  -50,  -83,    1,   33,   -1,   -7,  -13, -106,   55,  -65,  -31,   23,  -11,   -1,    0,  -40,   23,   31,  -23,  -54,  -49,   46,   -7,   54,   38,    6,  -45,    2,  -53,
+		/* 40: */  -21,  -32,   18,   13,  -57, -127,  -10,   -8,   -9,   13,  -66, -103,   39,   19,   30,   14,  -39,  -60,  -25,   -4,    9,  -45,    0,   21,  -35,  -53,    1,  -35,    3,    4,   -6,  -64,
+		/* 60: */  -62,   54,    7,   65,    9,  -31,  -17,   45,   -7,  -65,   -6,  -29,  -28,  -52,  -25,   47,  -13,   14,  110,   25,  -51,  -15,   40,  -33,   10,   64,  -70,  -42,   60,   33,   30,   11,
+		/* 80: */   45,    9,  -33,  -34,  -73,   -1,   35,  -99,   -1,  -62,  -27,   53,   -9,   20,   68,   46,    2,  -34,   61,   60,  -21,   35,   34,  -49,  -60,   -4,   36,   18,  -44,  -75,  -22,  -43,
+		/* a0: */  -34,  -34,  -52,   -8,   49,  -13,   21,   12,    0,    1,  -20,   68,  -29,  -32,   39,   60,  -73,  -33,  -27,  -98,  -49,    2,   15,   33,  -35,  -74,  -28,   20,  -23,    7,  -44,   42,
+		/* c0: */   17,   23,  -49,  -63,   18,   65,  -99,  -38,   31,  -15,  -56,  -66,   35,   32,  -25,   11,  -29,   -4,  127,   -6,  -70,  -57,  -25,  -10,  -25,   63,   12,  -51,   12,   51,   54,   29,
+		/* e0: */   25, -110,  -57,    8,   20,   17,  -81,   34,   -1,  -47,  -70,    6,   13,   67,   85,  -35,  -47,   89,    3,  -46,   -3,   22,  -68,   63,   39,    8,  -57,   57,   76,  -82,  -64,  -83,
+	},
+	/* Page 0f (wavetable offset 0f00) */ {
+		/* 00: */   11,    8,  -14,  -22,   16,   33,   -5,   -5,   42,   29,  -46,  -53,   40,   96,   19,  -66,  -26,   38,   18,    7,   48,   19,  -61,  -52,   23,   53,   41,   33,    5,  -48,  -52,   38,
+		/* 20: */  100,   14,  -85,  -18,   81,   22,  -56,   18,   87,  -14, -113,  -15,  124,   74,  -51,  -34,   34,  -12,  -67,   26,  124,   48,  -82,  -61,   36,   31,  -22,   22,   81,    7,  -81,  -14,
+		/* 40: */   78,   27,  -34,    8,   20,  -38,  -14,   86,   81,  -37,  -93,  -18,   60,   37,   11,   41,    1,  -91,  -44,   86,   81,   10,   -1,  -26,  -63,  -15,   63,   78,   33,  -44,  -75,  -12,
+		/* 60: */   51,   53,   42,   20,  -30,  -49,  -16,   31,   57,   31,  -16,  -22,   -5,    3,   27,   42,   -3,  -37,  -11,   16,   29,   45,   29,  -25,  -44,   -4,   27,   25,   26,   30,   -3,  -41,
+		/* 80: */  -25,   20,   49,   46,    3,  -46,  -27,   25,   38,   34,   18,  -40,  -44,   37,   46,  -15,   22,   78,  -25, -113,  -11,   94,   51,    3,   12,  -30,  -76,   11,  127,   74,  -74,  -90,
+		/* a0: */   12,   48,    5,   25,   71,   14,  -75,  -44,   45,   55,   15,    0,   -4,  -25,  -25,   29,   81,   44,  -48,  -66,   -5,   25,   22,   44,   53,    0,  -56,  -41,   26,   63,   22,  -33,
+		/* c0: */   -7,   56,   16,  -76,  -26,  112,   81,  -86,  -96,   55,  107,   19,  -52,  -38,   16,   36,   -4,   12,   93,   37, -127,  -93,  104,  120,  -26,  -34,   63,   18, -101,  -44,  119,   97,
+		/* e0: */  -71,  -82,   55,   56,  -51,   -7,  105,   22, -126,  -51,  122,   89,  -56,  -44,   55,   12,  -78,   -3,  126,   60,  -93,  -63,   74,   49,  -63,  -16,   90,   23,  -91,  -15,  120,   64,
+	},
+	/* Page 10 (wavetable offset 1000) */ {
+		/* 00: */    0,  -18,  -25,   13,   64,   73,   31,  -13,  -17,    3,    0,  -25,  -34,   -3,   41,   42,   -8,  -65,  -86,  -66,  -21,   17,   35,   28,   -8,  -54,  -62,  -18,   32,   38,   21,   41,
+		/* 20: */   89,  106,   82,   62,   59,   30,  -45, -114, -127,  -76,   -1,   49,   66,   58,   23,  -34,  -86, -102,  -76,  -31,    7,   30,   48,   75,   95,   79,   41,   20,   23,   25,    7,  -16,
+		/* 40: */  -27,  -35,  -55,  -79,  -80,  -38,   31,   86,   95,   51,  -14,  -66,  -90,  -85,  -49,   13,   79,  116,  111,   82,   41,   -3,  -44,  -58,  -32,   10,   32,   32,   30,   27,    8,  -30,
+		/* 60: */  -63,  -63,  -34,   -3,    6,  -11,  -31,  -38,  -32,  -11,   31,   87,  127,  124,   80,   16,  -42,  -83, -100,  -78,  -17,   55,   96,   78,   17,  -45,  -80,  -87,  -69,  -31,   14,   49,
+		/* 80: */   64,   56,   31,  -10,  -40,  -35,   -1,   38,   59,   58,   37,    1,  -30,  -37,  -10,   28,   49,   45,   16,  -34,  -92, -127, -119,  -72,   -8,   51,   96,  110,   86,   31,  -28,  -62,
+		/* a0: */  -55,  -11,   45,   85,   85,   54,    8,  -34,  -56,  -54,  -27,    3,   20,   20,    6,  -18,  -42,  -48,  -28,    6,   35,   51,   45,   13,  -32,  -62,  -58,  -23,   24,   69,  103,  109,
+		/* c0: */   80,   28,  -24,  -56,  -62,  -47,  -18,    8,   20,   11,  -11,  -35,  -45,  -31,   -3,   25,   44,   47,   32,   11,   -4,   -6,    8,   30,   48,   51,   32,   -1,  -37,  -61,  -63,  -41,
+		/* e0: */   -4,   35,   56,   54,   32,    4,  -20,  -32,  -31,  -18,   -4,    8,   13,    8,    1,   -3,    1,   14,   27,   35,   34,   23,    4,  -14,  -25,  -24,  -14,    1,   14,   18,   13,   -1,
+	},
+	/* Page 11 (wavetable offset 1100) */ {
+		/* 00: */    1,  -13,  -13,  -12,  -16,   -3,  -15,  -28,  -26,  -19,  -42,  -36,  -33,  -36,  -48,  -53,  -63,  -49,  -50,  -75,  -75,  -79,  -81,  -69,  -99,  -77,  -82, -102,  -96, -109, -106, -105,
+		/* 20: */ -106, -121, -126, -122, -115, -127, -125, -123, -124, -114, -123, -127, -120, -122, -125, -126, -106, -111,  -93,  -86,  -87,  -84,  -69,  -50,  -57,  -60,  -40,  -33,  -36,  -23,  -23,  -21,
+		/* 40: */    7,   13,   21,   32,   39,   48,   57,   62,   68,   74,   78,   83,   88,   91,   95,   98,  100,  103,  106,  107,  110,  112,  114,  116,  117,  118,  119,  121,  121,  122,  123,  124,
+		/* 60: */  124,  125,  125,  126,  126,  126,  126,  127,  127,  127,  127,  126,  126,  126,  126,  126,  125,  125,  124,  124,  123,  123,  122,  122,  121,  120,  119,  118,  117,  117,  116,  115,
+		/* 80: */  114,  112,  110,  109,  108,  107,  106,  104,  103,  102,  100,   99,   98,   96,   95,   93,   92,   90,   89,   87,   84,   83,   81,   79,   78,   76,   74,   73,   71,   69,   67,   65,
+		/* a0: */   63,   62,   60,   57,   55,   53,   51,   49,   47,   45,   43,   41,   39,   37,   35,   33,   31,   29,   25,   24,   21,   19,   17,   15,   12,   11,    8,    5,    4,    1,   -3,   -5,
+		/* c0: */   -7,  -10,  -12,  -15,  -18,  -19,  -22,  -25,  -27,  -31,  -34,  -36,  -39,  -42,  -44,  -47,  -50,  -51,  -54,  -58,  -60,  -63,  -66,  -68,  -70,  -73,  -75,  -77,  -80,  -82,  -84,  -88,
+		/* e0: */  -89,  -92,  -94,  -96,  -98, -100, -101, -103, -105, -107, -109, -110, -111, -114, -116, -116, -118, -119, -120, -121, -122, -123, -124, -124, -125, -125, -126, -126, -126, -127, -127, -127,
+	},
+	/* Page 12 (wavetable offset 1200) */ {
+		/* 00: */ -127, -127, -126, -126, -126, -125, -125, -124, -123, -122, -122, -121, -120, -119, -117, -116, -115, -112, -111, -109, -108, -106, -104, -102, -100,  -99,  -96,  -94,  -92,  -90,  -87,  -84,
+		/* 20: */  -82,  -79,  -77,  -74,  -71,  -69,  -66,  -63,  -61,  -58,  -54,  -52,  -49,  -46,  -44,  -41,  -38,  -36,  -33,  -30,  -27,  -24,  -21,  -19,  -16,  -13,  -11,   -8,   -5,   -3,   -1,    0,
+		/* 40: */   -1,    0,    1,    1,    3,    4,    6,   11,   13,   15,   20,   23,   27,   29,   30,   34,   36,   40,   42,   44,   47,   49,   50,   53,   55,   59,   60,   62,   65,   67,   68,   72,
+		/* 60: */   74,   78,   79,   80,   83,   85,   89,   91,   93,   96,   98,   99,  102,  104,  107,  108,  109,  112,  114,  116,  117,  117,  120,  120,  120,  122,  122,  124,  124,  124,  125,  125,
+		/* 80: */  127,  127,  127,  125,  125,  125,  124,  123,  121,  120,  119,  116,  115,  113,  109,  106,  101,   98,   95,   89,   83,   76,   72,   67,   61,   56,   50,   41,   33,   24,   18,   11,
+		/* a0: */    2,   -7,  -16,  -22,  -26,  -33,  -37,  -41,  -48,  -53,  -58,  -61,  -62,  -64,  -65,  -65,  -67,  -67,  -65,  -65,  -64,  -61,  -59,  -55,  -54,  -53,  -49,  -48,  -47,  -43,  -42,  -39,
+		/* c0: */  -39,  -38,  -36,  -35,  -37,  -37,  -38,  -40,  -41,  -42,  -45,  -48,  -52,  -54,  -56,  -61,  -65,  -70,  -73,  -77,  -82,  -86,  -89,  -94,  -98, -103, -105, -107, -111, -113, -115, -119,
+		/* e0: */ -121, -124, -125, -125, -127, -127, -127, -127, -127, -124, -124, -123, -121, -119, -115, -113, -110, -105, -101,  -96,  -94,  -92,  -89,  -87,  -85,  -81,  -78,  -74,  -72,  -70,  -65,  -62,
+	},
+	/* Page 13 (wavetable offset 1300) */ {
+		/* 00: */  -58,  -56,  -56,  -53,  -53,  -52,  -49,  -47,  -43,  -41,  -39,  -36,  -34,  -33,  -31,  -30,  -30,  -30,  -30,  -29,  -29,  -27,  -27,  -27,  -30,  -30,  -31,  -33,  -34,  -37,  -37,  -37,
+		/* 20: */  -39,  -39,  -42,  -42,  -43,  -45,  -46,  -47,  -50,  -51,  -53,  -53,  -53,  -53,  -53,  -53,  -53,  -53,  -51,  -51,  -50,  -47,  -44,  -39,  -37,  -34,  -29,  -24,  -18,  -12,   -7,   -3,
+		/* 40: */    1,    7,   13,   22,   31,   42,   52,   63,   72,   81,   88,   93,  100,  105,  109,  114,  117,  120,  121,  124,  126,  126,  127,  127,  127,  127,  126,  124,  123,  120,  115,  112,
+		/* 60: */  108,  103,   99,   93,   88,   82,   76,   72,   67,   61,   55,   49,   43,   37,   31,   28,   22,   18,   12,    7,    3,    0,   -3,   -7,  -10,  -15,  -18,  -19,  -22,  -24,  -25,  -27,
+		/* 80: */  -28,  -30,  -31,  -33,  -33,  -34,  -34,  -34,  -34,  -34,  -34,  -34,  -34,  -34,  -34,  -34,  -33,  -33,  -33,  -31,  -31,  -30,  -28,  -28,  -27,  -27,  -27,  -25,  -25,  -24,  -22,  -21,
+		/* a0: */  -19,  -19,  -18,  -18,  -18,  -16,  -16,  -15,  -15,  -15,  -13,  -13,  -12,  -10,  -10,  -10,   -9,   -9,  -10,  -10,  -10,  -12,  -12,  -12,  -12,  -12,  -10,  -10,   -9,   -9,   -9,   -9,
+		/* c0: */   -9,   -9,   -9,  -10,  -10,  -10,  -12,  -12,  -12,  -12,  -12,  -10,  -10,  -12,  -12,  -12,  -13,  -13,  -15,  -16,  -18,  -19,  -21,  -22,  -22,  -22,  -22,  -22,  -22,  -22,  -21,  -21,
+		/* e0: */  -22,  -22,  -22,  -24,  -25,  -25,  -27,  -27,  -28,  -28,  -30,  -31,  -31,  -33,  -36,  -36,  -37,  -39,  -40,  -42,  -42,  -42,  -42,  -40,  -40,  -39,  -37,  -36,  -34,  -34,  -34,  -33,
+	},
+	/* Page 14 (wavetable offset 1400) */ {
+		/* 00: */  -33,  -34,  -34,  -36,  -36,  -37,  -39,  -39,  -40,  -42,  -43,  -45,  -46,  -49,  -51,  -54,  -57,  -60,  -62,  -66,  -69,  -73,  -76,  -81,  -84,  -87,  -91,  -94,  -99, -102, -106, -109,
+		/* 20: */ -112, -114, -117, -120, -121, -123, -124, -126, -126, -126, -126, -127, -127, -127, -127, -126, -126, -124, -123, -120, -117, -112, -108, -103,  -96,  -88,  -78,  -65,  -51,  -35,  -20,   -8,
+		/* 40: */    7,   14,   21,   25,   26,   26,   32,   42,   56,   72,   88,  101,  109,  113,  115,  115,  113,  108,  102,  101,  104,  108,  112,  115,  118,  122,  125,  126,  123,  120,  117,  114,
+		/* 60: */  112,  107,  100,   91,   85,   81,   77,   71,   65,   61,   62,   64,   72,   82,   89,   88,   82,   71,   59,   49,   42,   39,   37,   30,   16,   -7,  -34,  -57,  -69,  -70,  -65,  -58,
+		/* 80: */  -53,  -51,  -51,  -52,  -53,  -46,  -35,  -23,  -18,  -10,   -8,  -12,  -18,  -25,  -32,  -36,  -35,  -28,  -17,   -8,   -4,   -5,  -10,  -17,  -27,  -42,  -63,  -85, -104, -116, -123, -123,
+		/* a0: */ -119, -113, -109, -109, -111, -117, -124, -127, -125, -117, -107,  -94,  -84,  -76,  -70,  -62,  -49,  -33,  -16,    1,   13,   16,   11,    4,    0,    1,    6,   12,   15,   16,   14,   12,
+		/* c0: */   12,   12,   12,   14,   17,   17,   14,   12,    9,    5,   -2,  -12,  -24,  -35,  -45,  -49,  -46,  -36,  -20,    1,   21,   38,   49,   55,   55,   51,   45,   42,   44,   45,   51,   58,
+		/* e0: */   61,   58,   51,   39,   25,   13,    9,   17,   30,   40,   43,   36,   23,    6,  -12,  -22,  -20,   -6,   14,   35,   51,   62,   69,   71,   73,   73,   74,   74,   74,   68,   56,   39,
+	},
+	/* Page 15 (wavetable offset 1500) */ {
+		/* 00: */   20,    3,   -9,  -17,  -23,  -31,  -41,  -49,  -50,  -42,  -29,  -18,  -13,  -15,  -22,  -31,  -37,  -40,  -39,  -39,  -40,  -41,  -42,  -45,  -45,  -39,  -24,    0,   29,   60,   88,  107,
+		/* 20: */  116,  117,  118,  120,  123,  126,  127,  124,  116,  103,   83,   56,   29,    9,   -2,   -5,   -6,   -7,   -8,  -13,  -20,  -25,  -27,  -26,  -22,  -18,  -17,  -17,  -15,  -10,   -4,    0,
+		/* 40: */  -16,  -20,  -23,  -25,  -29,  -35,  -42,  -51,  -60,  -66,  -74,  -84,  -95, -108, -118, -124, -127, -127, -126, -125, -123, -118, -109, -101,  -94,  -88,  -82,  -75,  -70,  -66,  -59,  -51,
+		/* 60: */  -44,  -36,  -30,  -22,  -15,   -8,   -2,    2,    6,    8,   13,   15,   19,   25,   31,   34,   36,   38,   38,   38,   38,   38,   40,   42,   41,   37,   30,   20,    7,   -3,  -10,  -12,
+		/* 80: */  -10,   -4,    4,   14,   21,   25,   28,   30,   34,   38,   44,   49,   52,   51,   48,   41,   32,   21,   10,   -3,  -13,  -20,  -25,  -30,  -32,  -34,  -38,  -43,  -49,  -52,  -52,  -49,
+		/* a0: */  -44,  -39,  -35,  -34,  -35,  -38,  -44,  -50,  -53,  -53,  -50,  -44,  -37,  -32,  -28,  -23,  -19,  -15,  -12,   -6,    2,   13,   25,   36,   45,   55,   64,   70,   78,   87,   97,  103,
+		/* c0: */  105,  103,   97,   90,   84,   81,   79,   80,   82,   80,   80,   83,   87,   94,  101,  105,  103,   96,   85,   72,   62,   53,   46,   41,   38,   37,   38,   40,   40,   42,   46,   51,
+		/* e0: */   56,   62,   70,   78,   87,   95,  102,  107,  112,  116,  121,  125,  127,  127,  124,  121,  119,  118,  118,  119,  121,  121,  119,  115,  111,  108,  106,  104,  103,  103,  105,  108,
+	},
+	/* Page 16 (wavetable offset 1600) */ {
+		/* 00: */  112,  112,  109,  106,  104,   99,   93,   87,   78,   70,   64,   60,   60,   61,   62,   61,   56,   48,   37,   26,   18,   14,   13,   12,    8,    2,   -6,  -15,  -25,  -32,  -37,  -39,
+		/* 20: */  -38,  -35,  -30,  -26,  -23,  -21,  -19,  -17,  -15,  -15,  -17,  -21,  -27,  -34,  -42,  -48,  -51,  -51,  -53,  -55,  -55,  -55,  -53,  -49,  -46,  -42,  -40,  -39,  -35,  -28,  -20,  -14,
+		/* 40: */   99,  101,  103,  103,  102,  102,  100,   98,   95,   91,   89,   85,   82,   80,   77,   75,   73,   70,   68,   66,   65,   63,   61,   58,   56,   54,   51,   50,   48,   47,   47,   47,
+		/* 60: */   47,   47,   46,   46,   44,   40,   38,   34,   31,   27,   26,   25,   27,   30,   34,   39,   45,   52,   58,   63,   66,   68,   71,   72,   73,   75,   76,   77,   77,   77,   77,   77,
+		/* 80: */   77,   77,   77,   77,   77,   77,   78,   79,   80,   81,   82,   83,   84,   85,   84,   83,   81,   78,   76,   75,   74,   74,   74,   74,   75,   76,   78,   80,   81,   83,   85,   88,
+		/* a0: */   89,   90,   89,   88,   85,   83,   81,   75,   73,   69,   65,   63,   60,   59,   57,   56,   55,   54,   55,   55,   56,   57,   58,   59,   60,   62,   62,   63,   63,   64,   65,   66,
+		/* c0: */   66,   66,   66,   66,   66,   66,   66,   66,   67,   71,   74,   79,   85,   90,   96,  101,  104,  106,  107,  106,  105,  104,  102,  100,   98,   97,   94,   92,   90,   87,   85,   82,
+		/* e0: */   80,   79,   77,   75,   73,   70,   68,   64,   60,   56,   53,   48,   44,   37,   31,   23,   16,    7,   -3,  -17,  -28,  -42,  -64,  -81, -101, -114, -124, -127, -121, -109,  -83,  -54,
+	},
+	/* Page 17 (wavetable offset 1700) */ {
+		/* 00: */  -13,   18,   51,   52,   67,   91,  106,  118,  125,  127,  127,  123,  119,  111,  106,   99,   96,   93,   91,   90,   89,   88,   88,   88,   88,   89,   91,   92,   93,   94,   94,   93,
+		/* 20: */   91,   89,   86,   84,   83,   81,   80,   78,   77,   77,   76,   75,   74,   73,   71,   70,   68,   67,   65,   64,   64,   66,   68,   70,   74,   77,   81,   85,   87,   90,   94,   97,
+		/* 40: */   99,  101,  103,  103,  102,  102,  100,   98,   95,   91,   89,   85,   82,   80,   77,   75,   73,   70,   68,   66,   65,   63,   61,   58,   56,   54,   51,   50,   48,   47,   47,   47,
+		/* 60: */   47,   47,   46,   46,   44,   40,   38,   34,   31,   27,   26,   25,   27,   30,   34,   39,   45,   52,   58,   63,   66,   68,   71,   72,   73,   75,   76,   77,   77,   77,   77,   77,
+		/* 80: */   67,   67,   65,   64,   62,   61,   61,   59,   58,   58,   57,   57,   57,   55,   55,   55,   55,   55,   57,   57,   57,   57,   57,   57,   58,   58,   59,   60,   61,   63,   63,   64,
+		/* a0: */   66,   67,   69,   71,   72,   74,   76,   79,   82,   83,   84,   86,   86,   87,   89,   89,   89,   90,   90,   90,   90,   90,   89,   89,   89,   87,   86,   86,   84,   82,   80,   78,
+		/* c0: */   77,   75,   73,   72,   69,   67,   66,   64,   62,   59,   57,   56,   53,   52,   51,   48,   46,   45,   41,   38,   34,   32,   30,   26,   23,   21,   17,   14,   11,    5,    0,   -6,
+		/* e0: */   -9,  -13,  -19,  -23,  -28,  -35,  -40,  -46,  -54,  -63,  -72,  -78,  -85,  -93,  -98, -104, -111, -116, -120, -125, -127, -126, -125, -121, -114, -107,  -97,  -85,  -73,  -57,  -38,  -18,
+	},
+	/* Page 18 (wavetable offset 1800) */ {
+		/* 00: */    8,   22,   28,   42,   58,   71,   75,   85,   95,  103,  106,  112,  117,  119,  123,  126,  127,  127,  127,  126,  123,  123,  120,  116,  114,  109,  105,   99,   97,   92,   86,   80,
+		/* 20: */   78,   72,   67,   65,   58,   53,   48,   46,   41,   36,   32,   30,   26,   23,   22,   19,   16,   13,   13,   10,    9,    7,    7,    7,    6,    6,    6,    6,    7,    7,    9,   12,
+		/* 40: */   15,   15,   18,   20,   20,   23,   28,   31,   32,   35,   38,   39,   42,   47,   50,   52,   55,   60,   63,   65,   69,   72,   72,   74,   77,   79,   79,   82,   83,   86,   86,   88,
+		/* 60: */   89,   89,   92,   93,   93,   93,   93,   93,   92,   92,   89,   86,   85,   82,   77,   74,   72,   69,   66,   62,   61,   58,   55,   54,   51,   47,   43,   42,   39,   35,   32,   31,
+		/* 80: */    3,   -5,  -10,  -18,  -26,  -34,  -42,  -48,  -54,  -58,  -60,  -62,  -63,  -62,  -60,  -59,  -56,  -54,  -52,  -50,  -48,  -46,  -46,  -45,  -45,  -45,  -45,  -45,  -45,  -45,  -42,  -40,
+		/* a0: */  -35,  -30,  -22,  -16,   -8,    4,   15,   24,   32,   42,   50,   59,   66,   73,   81,   86,   92,   96,   97,   98,   98,   97,   94,   90,   86,   81,   76,   70,   65,   58,   51,   45,
+		/* c0: */   37,   30,   22,   14,    7,   -3,  -13,  -26,  -39,  -52,  -65,  -80,  -92, -101, -111, -119, -124, -127, -127, -124, -120, -116, -109,  -98,  -86,  -73,  -60,  -46,  -32,  -21,   -8,    6,
+		/* e0: */   18,   29,   38,   44,   48,   51,   52,   52,   51,   50,   47,   45,   42,   41,   39,   38,   38,   38,   38,   39,   42,   45,   47,   50,   52,   56,   60,   64,   68,   72,   75,   77,
+	},
+	/* Page 19 (wavetable offset 1900) */ {
+		/* 00: */   80,   84,   86,   89,   92,   93,   94,   96,   98,  100,  101,  102,  103,  104,  106,  107,  109,  110,  111,  113,  114,  117,  118,  119,  120,  122,  124,  126,  127,  127,  127,  127,
+		/* 20: */  124,  123,  120,  117,  113,  107,  101,   94,   87,   79,   68,   56,   43,   29,   14,    0,  -13,  -29,  -45,  -60,  -75,  -88, -100, -108, -114, -120, -124, -127, -127, -126, -122, -117,
+		/* 40: */ -111, -103,  -93,  -81,  -68,  -54,  -39,  -25,  -11,    0,   13,   26,   37,   47,   56,   64,   70,   73,   77,   80,   82,   82,   82,   81,   79,   77,   76,   73,   71,   69,   68,   67,
+		/* 60: */   65,   65,   64,   64,   63,   63,   63,   62,   62,   60,   59,   58,   56,   56,   55,   54,   52,   52,   52,   51,   50,   48,   47,   45,   43,   41,   38,   34,   29,   24,   17,   10,
+		/* 80: */    4,   -3,  -12,  -19,  -21,  -28,  -33,  -35,  -41,  -49,  -56,  -58,  -63,  -69,  -71,  -77,  -83,  -88,  -90,  -93,  -98, -103, -104, -106, -109, -110, -112, -115, -116, -117, -118, -119,
+		/* a0: */ -120, -121, -122, -122, -123, -124, -125, -125, -125, -125, -125, -126, -127, -127, -127, -127, -127, -127, -127, -126, -125, -125, -124, -123, -121, -120, -119, -118, -117, -116, -115, -113,
+		/* c0: */ -111, -110, -109, -108, -107, -106, -103, -102, -101,  -99,  -98,  -97,  -96,  -94,  -92,  -92,  -89,  -87,  -85,  -84,  -83,  -81,  -80,  -77,  -75,  -73,  -72,  -70,  -67,  -65,  -64,  -63,
+		/* e0: */  -61,  -60,  -58,  -55,  -54,  -54,  -51,  -49,  -49,  -47,  -44,  -43,  -43,  -41,  -40,  -40,  -40,  -38,  -38,  -38,  -37,  -35,  -35,  -35,  -34,  -34,  -34,  -34,  -32,  -32,  -32,  -32,
+	},
+	/* Page 1a (wavetable offset 1a00) */ {
+		/* 00: */  -32,  -32,  -32,  -32,  -32,  -32,  -32,  -32,  -32,  -32,  -32,  -32,  -32,  -32,  -32,  -32,  -32,  -32,  -32,  -32,  -32,  -32,  -32,  -32,  -32,  -32,  -32,  -32,  -32,  -32,  -31,  -31,
+		/* 20: */  -31,  -31,  -31,  -29,  -29,  -28,  -28,  -28,  -26,  -26,  -26,  -26,  -24,  -24,  -24,  -23,  -23,  -23,  -21,  -21,  -21,  -20,  -20,  -18,  -18,  -18,  -17,  -17,  -17,  -17,  -15,  -15,
+		/* 40: */  -15,  -15,  -17,  -17,  -17,  -17,  -17,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -17,  -17,  -17,  -14,  -12,  -10,   -9,   -6,   -3,   -1,    5,   11,   17,   20,   28,   36,   39,
+		/* 60: */   47,   58,   68,   72,   81,   92,  102,  105,  112,  118,  120,  124,  127,  126,  125,  121,  113,  106,  103,   95,   85,   82,   72,   61,   52,   49,   41,   33,   29,   21,   12,    6,
+		/* 80: */    4,   -9,  -21,  -31,  -41,  -50,  -57,  -62,  -65,  -66,  -68,  -70,  -68,  -64,  -56,  -49,  -52,  -47,  -40,  -35,  -29,  -25,  -25,  -28,  -30,  -31,  -32,  -30,  -29,  -29,  -33,  -30,
+		/* a0: */  -27,  -25,  -24,  -24,  -24,  -23,  -20,  -15,  -15,  -15,  -12,   -7,   -5,   -1,   -2,   -5,  -10,  -16,  -22,  -28,  -29,  -26,  -23,  -25,  -30,  -35,  -43,  -55,  -81, -109,  -86,  -13,
+		/* c0: */  -32,  -29,  -37,  -40,  -42,  -45,  -48,  -50,  -52,  -52,  -50,  -47,  -44,  -41,  -38,  -35,  -32,  -31,  -31,  -34,  -37,  -36,  -31,  -26,  -23,  -23,  -25,  -26,  -28,  -31,  -36,  -40,
+		/* e0: */  -43,  -45,  -45,  -44,  -41,  -39,  -37,  -37,  -39,  -42,  -46,  -50,  -52,  -52,  -55,  -55,  -48,  -33,  -19,  -10,   -3,    1,    1,   -2,   -4,   -6,   -8,  -10,   -8,   -6,   -5,   -4,
+	},
+	/* Page 1b (wavetable offset 1b00) */ {
+		/* 00: */   -8,   -6,   -6,   -5,   -4,   -4,   -2,    0,    4,    7,   10,   12,   10,    6,    5,    6,    8,   10,   10,    7,    2,   -2,   -4,   -6,   -4,   -4,   -6,   -9,   -8,   -7,   -7,   -8,
+		/* 20: */  -10,  -13,  -15,  -17,  -19,  -23,  -26,  -26,  -26,  -25,  -23,  -25,  -30,  -33,  -38,  -43,  -49,  -54,  -55,  -53,  -53,  -56,  -62,  -72,  -87, -106, -113,  -85,  -45,  -37,  -47,  -56,
+		/* 40: */  -73,  -66,  -69,  -72,  -75,  -78,  -80,  -79,  -77,  -74,  -69,  -62,  -55,  -47,  -40,  -35,  -31,  -28,  -24,  -19,  -15,  -11,   -8,   -4,    2,    8,   12,   14,   15,   15,   15,   13,
+		/* 60: */    8,    3,    1,    2,    7,   15,   20,   24,   26,   26,   26,   26,   25,   24,   23,   25,   30,   38,   50,   70,   93,  113,  125,  127,  127,  125,  116,   98,   78,   57,   37,   19,
+		/* 80: */   -3,  -24,  -43,  -58,  -72,  -83,  -92, -100, -105, -109, -110, -110, -109, -107, -104, -100,  -95,  -91,  -86,  -82,  -77,  -72,  -68,  -64,  -62,  -61,  -61,  -60,  -60,  -59,  -57,  -56,
+		/* a0: */  -55,  -53,  -52,  -50,  -48,  -46,  -43,  -40,  -38,  -35,  -32,  -28,  -25,  -24,  -25,  -28,  -33,  -39,  -45,  -51,  -56,  -61,  -68,  -75,  -82,  -89,  -96, -102, -105, -105, -101,  -93,
+		/* c0: */  -92,  -90,  -87,  -85,  -84,  -83,  -83,  -82,  -81,  -80,  -79,  -77,  -75,  -73,  -71,  -69,  -67,  -65,  -63,  -61,  -60,  -59,  -57,  -55,  -54,  -54,  -55,  -57,  -59,  -61,  -64,  -67,
+		/* e0: */  -70,  -73,  -74,  -75,  -76,  -77,  -78,  -79,  -80,  -81,  -82,  -83,  -83,  -83,  -82,  -78,  -71,  -61,  -52,  -43,  -35,  -29,  -25,  -23,  -23,  -24,  -26,  -26,  -26,  -24,  -23,  -20,
+	},
+	/* Page 1c (wavetable offset 1c00) */ {
+		/* 00: */  -22,  -23,  -23,  -22,  -21,  -21,  -19,  -16,  -12,   -8,   -5,   -4,   -5,   -8,  -10,  -10,   -7,   -6,   -7,  -10,  -14,  -19,  -21,  -22,  -21,  -21,  -23,  -25,  -25,  -24,  -24,  -25,
+		/* 20: */  -28,  -31,  -33,  -36,  -39,  -42,  -46,  -47,  -47,  -48,  -50,  -53,  -57,  -62,  -67,  -73,  -80,  -87,  -94, -100, -106, -112, -117, -121, -124, -126, -126, -126, -126, -126, -126, -116,
+		/* 40: */ -125, -124, -123, -122, -121, -120, -118, -116, -113, -109, -104,  -97,  -90,  -82,  -74,  -66,  -58,  -51,  -45,  -39,  -34,  -29,  -25,  -21,  -14,   -8,   -4,   -1,    1,    1,    1,   -2,
+		/* 60: */   -6,   -8,   -9,   -8,   -5,    1,    6,   11,   13,   14,   14,   15,   18,   23,   30,   39,   49,   60,   72,   85,   99,  112,  122,  127,  127,  122,  113,   99,   82,   61,   38,   15,
+		/* 80: */  -22,    8,   60,   77,   88,   79,   45,   26,   -3,   -7,   -4,   14,   26,   49,   61,   79,   86,   94,  103,  104,   94,   84,   64,   59,   63,   70,   78,   98,  109,  122,  127,  127,
+		/* a0: */  125,  119,  101,   90,   63,   49,   22,   10,  -10,  -20,  -28,  -42,  -49,  -61,  -67,  -73,  -75,  -75,  -67,  -61,  -49,  -45,  -38,  -38,  -40,  -42,  -44,  -46,  -46,  -45,  -45,  -44,
+		/* c0: */  -44,  -44,  -42,  -40,  -40,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -44,  -46,  -46,  -46,  -48,  -49,  -52,  -53,  -55,  -57,  -57,  -59,  -59,  -59,  -57,  -55,  -55,  -53,  -51,
+		/* e0: */  -48,  -44,  -42,  -37,  -33,  -29,  -25,  -21,  -18,  -15,  -13,  -13,  -11,   -9,   -7,   -6,   -4,   -4,   -2,   -2,   -2,   -2,    0,    0,   -2,   -2,   -4,   -6,   -6,   -7,   -9,  -11,
+	},
+	/* Page 1d (wavetable offset 1d00) */ {
+		/* 00: */  -15,  -17,  -22,  -24,  -28,  -30,  -33,  -37,  -40,  -43,  -47,  -50,  -52,  -53,  -55,  -57,  -59,  -59,  -61,  -63,  -63,  -63,  -63,  -63,  -63,  -63,  -64,  -64,  -66,  -66,  -68,  -68,
+		/* 20: */  -70,  -70,  -70,  -70,  -70,  -68,  -68,  -66,  -64,  -63,  -61,  -61,  -59,  -57,  -57,  -57,  -57,  -59,  -59,  -59,  -61,  -61,  -61,  -63,  -63,  -64,  -64,  -64,  -64,  -64,  -64,  -65,
+		/* 40: */  -67,  -71,  -77,  -81,  -85,  -90,  -94,  -98, -103, -108, -113, -115, -117, -120, -121, -123, -126, -127, -127, -127, -127, -127, -127, -127, -125, -125, -124, -122, -121, -120, -118, -116,
+		/* 60: */ -113, -112, -111, -108, -106, -103,  -99,  -96,  -93,  -87,  -82,  -77,  -73,  -70,  -65,  -62,  -59,  -54,  -50,  -47,  -42,  -38,  -34,  -31,  -30,  -30,  -31,  -30,  -27,  -25,  -24,  -21,
+		/* 80: */  -15,   -6,    6,   17,   28,   38,   48,   57,   67,   74,   82,   92,  100,  108,  114,  119,  122,  126,  126,  127,  126,  123,  119,  113,  105,   96,   84,   70,   54,   35,   16,   -6,
+		/* a0: */  -26,  -45,  -61,  -75,  -90, -102, -112, -119, -125, -127, -127, -127, -125, -120, -116, -110, -104,  -98,  -92,  -85,  -80,  -75,  -68,  -63,  -58,  -53,  -48,  -44,  -42,  -40,  -40,  -41,
+		/* c0: */  -47,  -47,  -47,  -47,  -48,  -50,  -51,  -52,  -54,  -54,  -55,  -57,  -58,  -60,  -60,  -60,  -60,  -58,  -57,  -55,  -54,  -53,  -50,  -48,  -47,  -45,  -44,  -42,  -41,  -39,  -38,  -35,
+		/* e0: */  -34,  -32,  -29,  -28,  -26,  -26,  -28,  -29,  -32,  -35,  -37,  -41,  -44,  -47,  -48,  -50,  -51,  -51,  -51,  -51,  -53,  -53,  -53,  -54,  -54,  -53,  -53,  -53,  -51,  -50,  -50,  -47,
+	},
+	/* Page 1e (wavetable offset 1e00) */ {
+		/* 00: */  -45,  -43,  -40,  -38,  -34,  -31,  -28,  -26,  -23,  -23,  -22,  -20,  -20,  -18,  -18,  -16,  -15,  -13,  -10,  -10,   -7,   -6,   -6,   -5,   -6,   -6,   -7,   -9,  -11,  -14,  -16,  -20,
+		/* 20: */  -23,  -25,  -29,  -31,  -34,  -35,  -38,  -39,  -42,  -44,  -47,  -50,  -53,  -55,  -57,  -60,  -60,  -61,  -63,  -63,  -64,  -64,  -66,  -66,  -66,  -66,  -66,  -64,  -63,  -61,  -60,  -58,
+		/* 40: */  -57,  -57,  -55,  -54,  -53,  -53,  -51,  -51,  -51,  -51,  -51,  -51,  -52,  -51,  -51,  -51,  -50,  -50,  -48,  -48,  -47,  -47,  -45,  -45,  -45,  -44,  -44,  -44,  -42,  -42,  -42,  -41,
+		/* 60: */  -41,  -41,  -41,  -42,  -42,  -44,  -45,  -47,  -50,  -53,  -55,  -60,  -64,  -71,  -75,  -82,  -88,  -93,  -98, -103, -108, -111, -115, -117, -117, -115, -111, -103,  -93,  -77,  -64,  -48,
+		/* 80: */   -4,   -1,   -1,    2,    5,    8,    9,   12,   15,   15,   18,   21,   23,   23,   24,   27,   30,   31,   34,   37,   37,   38,   41,   43,   43,   44,   44,   44,   44,   43,   41,   41,
+		/* a0: */   38,   36,   34,   30,   26,   22,   20,   16,   13,   11,    7,    2,   -3,   -5,   -9,  -12,  -13,  -13,  -13,  -12,  -11,   -8,   -2,    3,    5,    9,   14,   16,   19,   24,   27,   29,
+		/* c0: */   32,   35,   37,   41,   48,   53,   57,   62,   67,   71,   77,   85,   90,   93,   97,  103,  107,  109,  113,  116,  116,  118,  118,  118,  118,  119,  119,  119,  121,  124,  125,  125,
+		/* e0: */  125,  127,  127,  125,  124,  122,  121,  118,  114,  112,  107,  100,   95,   91,   86,   80,   76,   72,   66,   62,   59,   54,   48,   43,   40,   37,   32,   29,   24,   18,   13,   10,
+	},
+	/* Page 1f (wavetable offset 1f00) */ {
+		/* 00: */    5,    2,    0,   -5,  -12,  -17,  -19,  -23,  -26,  -27,  -30,  -32,  -35,  -35,  -37,  -37,  -38,  -38,  -38,  -40,  -40,  -41,  -43,  -46,  -46,  -48,  -48,  -48,  -48,  -46,  -44,  -44,
+		/* 20: */  -41,  -37,  -34,  -30,  -24,  -20,  -17,  -13,  -10,  -10,   -7,   -5,   -4,   -4,   -4,   -1,    1,    1,    4,    5,    5,    6,    5,    4,    3,   -1,   -4,   -7,  -13,  -21,  -27,  -31,
+		/* 40: */  -37,  -44,  -48,  -54,  -62,  -67,  -70,  -75,  -79,  -82,  -86,  -91,  -96,  -98, -102, -107, -110, -110, -111, -113, -113, -113, -115, -115, -115, -116, -118, -118, -119, -121, -124, -124,
+		/* 60: */ -125, -125, -125, -127, -127, -127, -127, -127, -125, -125, -124, -119, -116, -114, -108, -101,  -94,  -88,  -80,  -74,  -68,  -60,  -50,  -42,  -37,  -30,  -23,  -20,  -15,   -9,   -6,   -5,
+		/* 80: */   80,   76,   70,   66,   63,   60,   58,   58,   58,   58,   57,   54,   52,   52,   52,   52,   52,   50,   49,   46,   44,   42,   38,   36,   31,   24,   19,   12,    4,   -3,   -9,  -16,
+		/* a0: */  -22,  -26,  -32,  -35,  -36,  -36,  -36,  -33,  -28,  -23,  -18,  -14,  -12,   -8,   -6,   -4,    1,    3,    3,    3,    1,   -4,  -12,  -20,  -30,  -41,  -50,  -60,  -71,  -79,  -84,  -88,
+		/* c0: */  -91,  -91,  -91,  -91,  -89,  -88,  -86,  -83,  -80,  -78,  -75,  -73,  -72,  -70,  -69,  -69,  -69,  -70,  -73,  -78,  -83,  -90,  -98, -105, -112, -119, -123, -122, -121, -118, -113, -108,
+		/* e0: */ -104, -101,  -98,  -98,  -98, -101, -104, -109, -113, -118, -124, -127, -127, -127, -127, -125, -123, -122, -122, -123, -124, -126, -127, -126, -123, -121, -120, -118, -116, -114, -111, -108,
+	},
+	/* Page 20 (wavetable offset 2000) */ {
+		/* 00: */ -104, -100,  -98,  -97,  -97,  -97,  -95,  -91,  -89,  -88,  -88,  -86,  -82,  -80,  -80,  -80,  -80,  -78,  -75,  -73,  -73,  -73,  -73,  -71,  -70,  -70,  -70,  -70,  -70,  -70,  -70,  -70,
+		/* 20: */  -70,  -70,  -71,  -71,  -71,  -71,  -71,  -71,  -70,  -70,  -70,  -70,  -67,  -64,  -62,  -62,  -61,  -58,  -53,  -49,  -47,  -47,  -45,  -40,  -34,  -30,  -27,  -24,  -19,  -11,   -6,   -3,
+		/* 40: */   -2,    1,    3,    4,    4,    4,    7,   11,   14,   20,   25,   30,   33,   36,   41,   43,   46,   49,   52,   55,   59,   62,   66,   68,   70,   73,   74,   76,   79,   81,   83,   85,
+		/* 60: */   88,   91,   92,   94,   97,   99,  100,  102,  104,  106,  109,  111,  113,  115,  116,  118,  120,  120,  122,  122,  123,  126,  126,  127,  127,  127,  127,  127,  127,  127,  127,  127,
+		/* 80: */  125,  125,  123,  123,  123,  121,  121,  121,  119,  118,  118,  116,  116,  114,  113,  113,  111,  110,  110,  107,  106,  105,  101,   99,   96,   94,   92,   88,   86,   84,   80,   78,
+		/* a0: */   75,   70,   65,   61,   58,   55,   51,   48,   46,   42,   39,   37,   33,   30,   26,   23,   22,   19,   17,   17,   14,   14,   13,   11,   10,    7,    7,    7,    6,    6,    6,    6,
+		/* c0: */    6,    6,    6,    6,    7,    7,    7,    9,    9,    9,   10,   10,   10,   10,   10,   10,   10,   10,    9,    9,    9,    6,    6,    5,    3,    2,    1,   -1,   -4,   -6,   -7,   -9,
+		/* e0: */  -12,  -14,  -15,  -18,  -20,  -23,  -27,  -30,  -34,  -36,  -38,  -42,  -44,  -47,  -51,  -53,  -56,  -60,  -64,  -69,  -72,  -74,  -78,  -80,  -82,  -86,  -88,  -91,  -95,  -98, -102, -104,
+	},
+	/* Page 21 (wavetable offset 2100) */ {
+		/* 00: */ -105, -109, -110, -111, -115, -116, -117, -119, -120, -123, -123, -123, -126, -126, -126, -127, -127, -127, -127, -127, -126, -126, -126, -125, -125, -125, -122, -122, -122, -120, -118, -116,
+		/* 20: */ -115, -113, -111, -110, -109, -105, -104, -102,  -99,  -96,  -92,  -90,  -88,  -84,  -81,  -79,  -74,  -72,  -69,  -63,  -58,  -52,  -48,  -44,  -38,  -35,  -31,  -26,  -21,  -15,  -10,   -5,
+		/* 40: */   15,   98,  122,  126,  125,  124,  124,  126,  124,  122,  119,  117,  116,  116,  119,  122,  122,  121,  119,  119,  119,  119,  121,  122,  121,  121,  121,  121,  120,  119,  119,  120,
+		/* 60: */  121,  121,  121,  121,  121,  121,  121,  121,  121,  120,  119,  119,  119,  119,  119,  119,  120,  121,  121,  121,  121,  121,  121,  121,  121,  121,  120,  119,  119,  119,  120,  121,
+		/* 80: */  121,  121,  121,  121,  121,  121,  121,  121,  121,  120,  119,  119,  119,  119,  119,  120,  121,  121,  121,  121,  121,  121,  121,  121,  121,  121,  121,  120,  119,  119,  120,  121,
+		/* a0: */  121,  121,  121,  121,  121,  121,  121,  119,  117,  118,  118,  120,  123,  123,  120,  118,  115,  116,  122,  126,  127,  127,  125,  120,  120,  121,  124,  118,  112,  106,   79,   -8,
+		/* c0: */  -81, -106, -116, -121, -116, -117, -120, -120, -120, -121, -119, -119, -121, -120, -120, -120, -120, -118, -118, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127,
+		/* e0: */ -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127,
+	},
+	/* Page 22 (wavetable offset 2200) */ {
+		/* 00: */ -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127,
+		/* 20: */ -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127,
+		/* 40: */ -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127,
+		/* 60: */ -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127,
+		/* 80: */ -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127,
+		/* a0: */ -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127,
+		/* c0: */  -45,   14,  108,  117,  127,  124,  127,  124,  126,  123,  123,  124,  124,  123,  122,  121,  119,  119,  118,  117,  117,  115,  114,  113,  112,  110,  110,  110,  109,  108,  108,  105,
+		/* e0: */  104,  103,  103,  101,  100,  100,   99,   97,   95,   95,   94,   92,   91,   90,   87,   85,   83,   82,   81,   81,   80,   80,   78,   78,   77,   76,   74,   74,   73,   72,   71,   72,
+	},
+	/* Page 23 (wavetable offset 2300) */ {
+		/* 00: */   71,   71,   71,   71,   69,   69,   67,   67,   65,   65,   64,   63,   62,   60,   59,   56,   55,   54,   53,   50,   49,   46,   45,   45,   42,   42,   41,   41,   40,   41,   41,   40,
+		/* 20: */   40,   37,   37,   35,   33,   32,   31,   31,   30,   30,   28,   28,   27,   26,   24,   23,   22,   21,   21,   18,   17,   17,   18,   18,   18,   18,   17,   15,   14,   13,   12,   10,
+		/* 40: */    8,    6,    4,    1,    1,   -1,   -1,   -3,   -3,   -3,   -3,   -3,   -4,   -4,   -5,   -6,   -8,   -9,   -9,  -10,  -12,  -13,  -13,  -15,  -17,  -18,  -19,  -19,  -22,  -22,  -24,  -26,
+		/* 60: */  -27,  -27,  -28,  -30,  -31,  -32,  -33,  -37,  -38,  -41,  -42,  -44,  -45,  -45,  -45,  -45,  -45,  -45,  -46,  -47,  -49,  -50,  -50,  -50,  -51,  -51,  -53,  -54,  -55,  -58,  -59,  -60,
+		/* 80: */  -63,  -64,  -64,  -64,  -67,  -67,  -68,  -69,  -69,  -71,  -71,  -73,  -74,  -76,  -78,  -80,  -81,  -82,  -85,  -85,  -86,  -86,  -87,  -87,  -89,  -90,  -90,  -92,  -94,  -96,  -96,  -97,
+		/* a0: */  -99,  -99, -100, -101, -101, -103, -104, -105, -105, -109, -109, -112, -113, -115, -115, -117, -118, -119, -119, -119, -121, -121, -122, -121, -122, -124, -127, -113,  -95,  -60,  -31,  -23,
+		/* c0: */  -22,  -11,   -3,   -1,   -1,   -3,   -4,   -6,   -6,   -8,  -10,  -15,  -16,  -18,  -20,  -22,  -22,  -23,  -25,  -27,  -29,  -30,  -34,  -35,  -37,  -37,  -39,  -39,  -41,  -41,  -42,  -42,
+		/* e0: */  -44,  -44,  -48,  -49,  -49,  -49,  -49,  -51,  -51,  -53,  -53,  -54,  -56,  -58,  -60,  -61,  -63,  -65,  -67,  -65,  -67,  -67,  -65,  -67,  -67,  -67,  -67,  -70,  -67,  -61,  -46,  -15,
+	},
+	/* Page 24 (wavetable offset 2400) */ {
+		/* 00: */   -4,  -16,  -28,  -40,  -54,  -67,  -78,  -89,  -95,  -98, -101, -100,  -98,  -97,  -97,  -97,  -98, -100, -102, -104, -104, -104, -104, -103, -102,  -98,  -94,  -92,  -88,  -84,  -80,  -76,
+		/* 20: */  -69,  -60,  -53,  -48,  -41,  -35,  -30,  -28,  -26,  -24,  -23,  -19,  -16,  -14,  -14,  -14,  -14,  -16,  -16,  -17,  -20,  -22,  -23,  -21,  -17,  -15,  -12,  -10,   -9,   -9,  -10,  -12,
+		/* 40: */  -15,  -18,  -23,  -27,  -29,  -30,  -28,  -26,  -25,  -21,  -16,  -12,   -9,  -10,  -12,  -12,  -12,  -12,  -14,  -14,  -16,  -19,  -21,  -21,  -21,  -19,  -18,  -14,   -7,   -2,    2,    6,
+		/* 60: */    8,    8,    9,   11,   11,    9,    7,    4,    1,    1,    2,    6,   11,   14,   18,   23,   25,   25,   27,   30,   31,   34,   39,   42,   42,   41,   37,   35,   34,   31,   25,   21,
+		/* 80: */   19,   16,   15,   16,   18,   18,   20,   20,   20,   20,   20,   20,   18,   16,   15,   13,    8,    3,   -2,   -7,  -14,  -18,  -19,  -16,  -12,   -8,   -7,   -5,   -1,    4,   12,   21,
+		/* a0: */   29,   36,   44,   51,   54,   54,   51,   48,   46,   42,   39,   37,   37,   34,   32,   30,   30,   32,   37,   42,   45,   46,   45,   41,   35,   25,   15,    7,   -6,  -20,  -30,  -27,
+		/* c0: */  -16,  -15,  -20,  -31,  -42,  -50,  -56,  -63,  -73,  -81,  -87,  -93, -100, -105, -111, -118, -123, -124, -126, -127, -124, -122, -116, -107,  -97,  -88,  -76,  -65,  -55,  -43,  -29,  -17,
+		/* e0: */   -8,    4,   18,   28,   36,   45,   54,   62,   71,   83,   93,  100,  108,  117,  122,  123,  125,  127,  127,  127,  122,  116,  111,  104,   97,   90,   84,   67,   52,   38,   23,    9,
+	},
+	/* Page 25 (wavetable offset 2500) */ {
+		/* 00: */  -12,  -13,  -14,  -17,  -20,  -26,  -31,  -36,  -39,  -39,  -42,  -42,  -42,  -42,  -42,  -43,  -45,  -46,  -46,  -46,  -46,  -46,  -46,  -46,  -49,  -49,  -49,  -52,  -52,  -54,  -57,  -59,
+		/* 20: */  -62,  -62,  -62,  -65,  -65,  -65,  -68,  -68,  -69,  -71,  -72,  -72,  -72,  -70,  -67,  -65,  -62,  -58,  -55,  -51,  -46,  -42,  -38,  -33,  -29,  -24,  -17,   -9,   -2,    3,    8,   15,
+		/* 40: */   20,   24,   29,   33,   35,   40,   44,   49,   52,   55,   59,   62,   66,   71,   75,   79,   84,   88,   92,   98,  104,  110,  114,  115,  119,  120,  122,  125,  127,  127,  127,  127,
+		/* 60: */  127,  127,  125,  122,  120,  119,  115,  114,  112,  109,  107,  105,  100,   95,   89,   85,   81,   76,   72,   66,   58,   52,   46,   39,   33,   26,   17,    9,    2,   -3,   -9,  -17,
+		/* 80: */  -23,  -28,  -34,  -39,  -45,  -54,  -62,  -68,  -72,  -76,  -81,  -85,  -86,  -90,  -91,  -93,  -96,  -98,  -99, -103, -105, -109, -111, -113, -118, -120, -122, -125, -127, -127, -127, -127,
+		/* a0: */ -124, -124, -121, -117, -114, -111, -107, -104, -101,  -97,  -94,  -90,  -84,  -78,  -72,  -68,  -64,  -59,  -55,  -53,  -48,  -46,  -44,  -41,  -39,  -36,  -31,  -26,  -20,  -16,  -12,   -7,
+		/* c0: */   -3,    1,    6,   10,   11,   15,   18,   23,   26,   28,   31,   33,   34,   38,   39,   39,   42,   42,   42,   42,   42,   39,   39,   39,   39,   39,   39,   39,   39,   38,   34,   32,
+		/* e0: */   28,   26,   23,   19,   16,   16,   13,   13,   13,   16,   16,   16,   16,   16,   16,   16,   16,   13,   13,   12,    8,    7,    4,    0,   -3,   -7,  -13,  -19,  -22,  -22,  -18,  -14,
+	},
+	/* Page 26 (wavetable offset 2600) */ {
+		/* 00: */  -11,   -8,   -7,   -9,   -9,  -11,  -12,  -14,  -18,  -19,  -22,  -25,  -29,  -32,  -35,  -39,  -42,  -43,  -45,  -48,  -51,  -53,  -56,  -57,  -58,  -61,  -64,  -66,  -68,  -72,  -76,  -79,
+		/* 20: */  -80,  -82,  -83,  -86,  -89,  -91,  -92,  -94,  -96,  -97,  -99, -101, -102, -103, -106, -111, -113, -114, -116, -119, -119, -121, -122, -124, -124, -124, -125, -125, -126, -126, -127, -126,
+		/* 40: */ -125, -126, -127, -127, -126, -123, -122, -122, -121, -121, -119, -118, -116, -115, -114, -112, -112, -111, -109, -106, -105, -102, -101,  -99,  -98,  -96,  -95,  -94,  -92,  -92,  -92,  -91,
+		/* 60: */  -89,  -86,  -85,  -84,  -83,  -80,  -78,  -76,  -73,  -72,  -69,  -66,  -63,  -61,  -58,  -54,  -52,  -51,  -48,  -44,  -40,  -36,  -30,  -26,  -23,  -19,  -15,  -12,   -7,   -2,    1,    1,
+		/* 80: */    2,    2,    4,    6,    9,   12,   14,   16,   19,   22,   23,   24,   25,   28,   31,   32,   32,   34,   36,   37,   38,   40,   42,   44,   45,   44,   44,   45,   47,   50,   53,   54,
+		/* a0: */   54,   54,   54,   55,   56,   58,   61,   62,   63,   63,   64,   66,   69,   72,   76,   79,   82,   84,   85,   88,   93,   98,  101,  102,  103,  106,  111,  117,  121,  123,  124,  127,
+		/* c0: */  127,  127,  127,  127,  127,  127,  127,  126,  124,  122,  119,  118,  117,  114,  110,  107,  105,  103,   98,   93,   88,   84,   81,   78,   73,   68,   65,   60,   56,   52,   49,   46,
+		/* e0: */   44,   41,   38,   36,   33,   31,   29,   28,   28,   27,   25,   24,   25,   26,   24,   21,   19,   19,   18,   14,    8,    5,    2,   -2,   -6,  -11,  -13,  -13,  -12,  -14,  -16,  -15,
+	},
+	/* Page 27 (wavetable offset 2700) */ {
+		/* 00: */  -35,  -47,  -57,  -64,  -73,  -80,  -84,  -88,  -93,  -96, -100, -105, -109, -110, -110, -110, -110, -111, -113, -113, -111, -110, -111, -112, -111, -109, -108, -109, -109, -106, -104, -103,
+		/* 20: */ -104, -105, -105, -105, -107, -110, -113, -114, -114, -114, -115, -117, -119, -122, -123, -123, -123, -123, -123, -124, -126, -127, -126, -124, -123, -123, -122, -119, -118, -117, -117, -119,
+		/* 40: */ -111, -109, -106, -104, -101,  -96,  -90,  -86,  -82,  -80,  -79,  -75,  -70,  -66,  -63,  -62,  -61,  -59,  -58,  -58,  -57,  -54,  -52,  -52,  -53,  -54,  -54,  -53,  -52,  -53,  -55,  -58,
+		/* 60: */  -61,  -63,  -66,  -66,  -64,  -64,  -66,  -68,  -70,  -71,  -69,  -66,  -65,  -66,  -67,  -67,  -66,  -62,  -59,  -57,  -55,  -53,  -51,  -49,  -45,  -42,  -36,  -28,  -21,  -14,   -8,   -3,
+		/* 80: */   12,   28,   45,   63,   81,   93,  107,  118,  124,  127,  127,  125,  122,  117,  112,  108,  103,  101,  100,  100,  100,  100,   99,   95,   90,   86,   83,   79,   75,   71,   70,   68,
+		/* a0: */   67,   65,   67,   72,   81,   88,   83,   64,   42,   20,    7,   -6,  -14,  -15,  -13,  -13,  -19,  -32,  -49,  -61,  -78,  -94, -104, -108, -111, -111, -108, -102,  -95,  -89,  -82,  -76,
+		/* c0: */  -73,  -74,  -73,  -72,  -72,  -70,  -67,  -64,  -58,  -49,  -39,  -26,  -13,   -5,    0,    6,    7,    4,   -1,   -3,    0,    8,   19,   29,   37,   42,   45,   45,   45,   42,   37,   31,
+		/* e0: */   27,   27,   29,   31,   34,   35,   37,   39,   37,   34,   29,   25,   18,   11,    6,   -4,  -13,  -25,  -36,  -51,  -63,  -71,  -81,  -88,  -91,  -88,  -81,  -71,  -63,  -52,  -43,  -36,
+	},
+	/* Page 28 (wavetable offset 2800) */ {
+		/* 00: */  -23,  -11,   -3,   10,   25,   36,   51,   68,   85,   98,  111,  121,  125,  126,  120,  115,  105,   91,   77,   65,   49,   33,   25,   12,    0,   -8,  -18,  -30,  -38,  -51,  -65,  -79,
+		/* 20: */  -88, -100, -110, -117, -122, -124, -124, -121, -113, -103,  -96,  -83,  -66,  -54,  -35,  -16,   -3,   12,   28,   38,   48,   56,   63,   68,   72,   77,   79,   83,   86,   86,   83,   78,
+		/* 40: */   73,   69,   59,   49,   39,   26,   13,    7,   -1,   -9,  -16,  -23,  -31,  -36,  -38,  -40,  -42,  -43,  -45,  -45,  -45,  -45,  -42,  -39,  -29,  -18,   -8,    1,   12,   22,   29,   34,
+		/* 60: */   37,   37,   33,   26,   18,   11,   -1,  -14,  -25,  -40,  -55,  -66,  -81,  -94, -103, -111, -119, -124, -127, -127, -123, -121, -114, -108, -102,  -94,  -84,  -71,  -58,  -40,  -21,    0,
+		/* 80: */  -82,  -97, -113, -116, -127, -126, -124, -124, -127, -117, -119, -117, -115, -116, -119, -122, -103,  -88,  -78,  -78,  -78,  -79,  -81,  -85,  -73,  -70,  -74,  -85,  -90,  -97, -100,  -96,
+		/* a0: */  -63,  -46,  -25,  -21,   -9,   -7,   -9,  -14,   -7,   -5,   -9,  -17,  -18,  -22,  -32,  -37,  -14,   -2,   -3,   -6,  -13,  -18,  -35,  -44,  -51,  -54,  -65,  -71,  -75,  -77,  -73,  -63,
+		/* c0: */  -26,  -24,   -2,   10,   32,   40,   46,   43,   58,   66,   66,   62,   63,   60,   48,   44,   63,   75,   77,   75,   69,   65,   54,   47,   48,   48,   40,   31,   17,   10,    2,    6,
+		/* e0: */   37,   54,   69,   73,   70,   71,   66,   59,   56,   58,   48,   39,   21,   14,   -2,   -7,   -7,    2,   -5,   -9,  -24,  -29,  -40,  -50,  -52,  -52,  -56,  -62,  -59,  -59,  -47,  -37,
+	},
+	/* Page 29 (wavetable offset 2900) */ {
+		/* 00: */ -114, -127, -123, -114,  -98,  -87,  -77,  -81,  -48,  -33,  -25,  -29,  -17,  -21,  -37,  -42,   10,   35,   44,   44,   50,   46,   35,   23,   40,   46,   37,   21,    0,  -10,  -21,  -17,
+		/* 20: */   40,   60,   92,  100,  108,  114,  108,   98,  104,  112,  102,   89,   73,   65,   42,   33,   54,   73,   73,   69,   52,   44,   21,    6,  -12,  -10,  -25,  -35,  -46,  -48,  -42,  -31,
+		/* 40: */   -2,  -27,  -13,    0,   35,   44,   56,   60,   77,   87,   92,   92,   96,   92,   85,   83,  102,  110,  112,  110,  106,  106,  100,  102,   92,   90,   77,   69,   52,   48,   44,   44,
+		/* 60: */   64,   73,   83,   83,   73,   69,   65,   64,   58,   62,   58,   56,   40,   40,   35,   37,   25,   29,   17,   10,  -13,  -19,  -29,  -29,  -27,  -25,  -29,  -31,  -23,  -23,  -12,  -10,
+		/* 80: */  -44,  -63,  -63,  -52,  -33,  -21,   -8,   -8,   27,   40,   50,   46,   58,   56,   46,   44,   75,   94,  102,  104,  108,  106,   96,   89,   94,   98,   89,   77,   60,   54,   44,   48,
+		/* a0: */   83,   94,  117,  121,  125,  127,  123,  117,  114,  123,  115,  108,   92,   89,   73,   69,   67,   81,   79,   73,   54,   50,   31,   21,    6,    8,   -2,  -10,  -17,  -19,  -15,  -10,
+		/* c0: */   -8,  -33,  -31,  -23,   -4,    2,   10,   13,   19,   21,   25,   25,   27,   25,   25,   29,   35,   38,   42,   42,   42,   46,   46,   52,   46,   44,   38,   37,   31,   31,   33,   33,
+		/* e0: */   33,   31,   35,   29,   15,   10,    4,    4,  -10,   -6,   -8,   -4,  -12,   -6,   -2,    6,    8,    8,    0,   -6,  -19,  -23,  -27,  -21,  -10,   -6,   -8,   -8,    2,    2,    4,    2,
+	},
+	/* Page 2a (wavetable offset 2a00) */ {
+		/* 00: */    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+		/* 20: */    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+		/* 40: */    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+		/* 60: */    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+		/* 80: */    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+		/* a0: */    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+		/* c0: */    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+		/* e0: */    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+	},
+	/* Page 2b (wavetable offset 4d00) */ {
+		/* 00: */    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+		/* 20: */    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+		/* 40: */    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+		/* 60: */    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+		/* 80: */   -5,    2,    1,    3,    7,   12,   15,   16,   20,   26,   34,   40,   44,   48,   54,   62,   68,   71,   72,   75,   80,   88,   93,   96,   97,  101,  108,  112,  113,  113,  116,  120,
+		/* a0: */  123,  123,  123,  123,  124,  126,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  125,  125,  125,  125,  124,  122,  121,  121,  121,  121,  118,  115,  113,  113,  113,  111,
+		/* c0: */ -105, -109, -110, -111, -115, -116, -116, -120, -120, -123, -123, -123, -126, -126, -126, -127, -127, -127, -127, -127, -126, -126, -126, -125, -125, -125, -122, -122, -122, -120, -118, -116,
+		/* e0: */ -115, -113, -111, -110, -109, -105, -104, -102,  -99,  -96,  -91,  -90,  -88,  -84,  -81,  -79,  -74,  -72,  -69,  -63,  -58,  -52,  -48,  -44,  -38,  -35,  -31,  -26,  -21,  -15,  -10,   -5,
+	},
+	/* Page 2c (wavetable offset 4e00) */ {
+		/* 00: */    6,    6,    6,    6,    7,    7,    7,    9,    9,    9,   10,   10,   10,   10,   10,   10,   10,   10,    9,    9,    9,    6,    6,    6,    2,    2,    1,   -1,   -4,   -6,   -7,   -9,
+		/* 20: */  -12,  -14,  -15,  -18,  -20,  -22,  -27,  -30,  -35,  -36,  -38,  -42,  -44,  -47,  -51,  -53,  -55,  -60,  -64,  -69,  -72,  -74,  -78,  -80,  -81,  -86,  -88,  -90,  -95,  -97, -102, -104,
+		/* 40: */  125,  125,  123,  123,  123,  121,  121,  121,  118,  118,  118,  116,  116,  113,  113,  113,  110,  110,  110,  106,  106,  105,  101,   99,   95,   94,   92,   88,   86,   84,   80,   78,
+		/* 60: */   75,   70,   65,   60,   58,   55,   51,   48,   46,   42,   39,   37,   32,   30,   25,   23,   22,   18,   17,   17,   14,   14,   14,   10,   10,    7,    7,    7,    6,    6,    6,    6,
+		/* 80: */   -2,    1,    3,    4,    4,    4,    7,   11,   14,   20,   25,   31,   33,   36,   41,   43,   46,   49,   52,   54,   59,   62,   67,   68,   69,   73,   74,   75,   80,   81,   83,   85,
+		/* a0: */   88,   91,   92,   94,   97,   99,  100,  102,  104,  105,  109,  111,  113,  115,  116,  118,  120,  120,  122,  122,  122,  126,  126,  127,  127,  127,  127,  127,  127,  127,  127,  127,
+		/* c0: */  -97,  -97,  -95,  -90,  -88,  -88,  -88,  -86,  -82,  -80,  -80,  -80,  -80,  -78,  -75,  -73,  -73,  -73,  -73,  -70,  -70,  -70,  -70,  -70,  -70,  -70,  -70,  -70,  -70,  -70,  -71,  -71,
+		/* e0: */  -71,  -71,  -71,  -71,  -70,  -70,  -70,  -70,  -67,  -64,  -62,  -62,  -61,  -58,  -52,  -48,  -47,  -47,  -45,  -40,  -34,  -29,  -27,  -24,  -19,  -11,   -6,   -3,   -2,    1,    5,    7,
+	},
+	/* Page 2d (wavetable offset 4f00) */ {
+		/* 00: */    5,   -3,   -9,  -13,  -15,  -19,  -25,  -33,  -40,  -44,  -48,  -54,  -61,  -67,  -70,  -71,  -73,  -78,  -84,  -89,  -92,  -93,  -97, -104, -108, -109, -109, -109, -112, -118, -121, -122,
+		/* 20: */ -122, -123, -126, -127, -127, -127, -127, -127, -127, -127, -127, -127, -126, -123, -122, -122, -122, -122, -120, -117, -115, -115, -115, -113, -109, -107, -107, -107, -104, -100,  -97,  -97,
+		/* 40: */   94,   89,   86,   84,   80,   78,   75,   70,   65,   60,   58,   55,   51,   48,   46,   42,   39,   37,   32,   30,   25,   23,   22,   18,   17,   17,   14,   14,   13,   11,   10,    7,
+		/* 60: */    7,    7,    6,    6,    6,    6,    6,    6,    6,    6,    7,    7,    7,    9,    9,    9,   10,   10,   10,   10,   10,   10,   10,   10,    9,    9,    9,    6,    6,    5,    3,    1,
+		/* 80: */  -90,  -81,  -81,  -81,  -86,  -87,  -90,  -93,  -97, -101, -103, -106, -108, -110, -112, -114, -122, -123, -126, -126, -127, -126, -126, -123, -123, -122, -120, -119, -116, -114, -114, -112,
+		/* a0: */ -119, -118, -118, -118, -118, -118, -120, -120, -120, -122, -120, -122, -120, -118, -116, -115, -118, -118, -116, -116, -115, -115, -114, -112, -110, -110, -106, -105,  -98,  -94,  -85,  -77,
+		/* c0: */  -20,    1,   13,   17,   15,   11,    9,    4,   -1,   -7,   -9,  -12,  -17,  -21,  -26,  -29,  -44,  -46,  -53,  -54,  -63,  -65,  -66,  -66,  -70,  -71,  -74,  -75,  -81,  -82,  -85,  -85,
+		/* e0: */  -95,  -95,  -97,  -98, -105, -108, -108, -110, -114, -115, -112, -111, -110, -108, -106, -103, -106, -106, -105, -105, -105, -106, -105, -103, -102, -103,  -99,  -98,  -98,  -98,  -95,  -91,
+	},
+	/* Page 2e (wavetable offset 5000) */ {
+		/* 00: */   -4,    5,    4,    3,   -4,   -7,   -9,  -13,  -25,  -29,  -34,  -37,  -40,  -41,  -45,  -48,  -56,  -58,  -61,  -61,  -62,  -61,  -60,  -57,  -61,  -60,  -58,  -57,  -53,  -50,  -50,  -49,
+		/* 20: */  -53,  -53,  -53,  -53,  -53,  -53,  -56,  -57,  -63,  -65,  -65,  -65,  -65,  -62,  -62,  -61,  -69,  -70,  -70,  -70,  -67,  -67,  -67,  -66,  -69,  -69,  -69,  -67,  -65,  -61,  -56,  -49,
+		/* 40: */   44,   67,   93,   97,  119,  118,  120,  115,  127,  122,  122,  118,  119,  115,  108,  105,  105,  102,   94,   93,   89,   87,   83,   85,   81,   78,   74,   73,   65,   65,   60,   58,
+		/* 60: */   53,   52,   49,   48,   37,   33,   32,   29,   22,   20,   20,   21,   17,   19,   21,   22,   17,   17,   17,   17,   11,   11,    9,    9,   -1,   -3,   -1,    0,   -4,   -4,   -4,    0,
+		/* 80: */  114,  110,  105,  102,   99,   97,   89,   84,   67,   62,   56,   52,   42,   39,   27,   19,   -4,  -11,  -16,  -14,  -17,  -16,  -14,  -14,  -12,   -9,   -1,    7,   24,   31,   42,   46,
+		/* a0: */   56,   59,   64,   64,   64,   62,   62,   61,   61,   61,   61,   64,   66,   69,   72,   77,   82,   87,   90,   90,   92,   94,   99,  100,  100,  104,  105,  107,  107,  107,   97,   72,
+		/* c0: */   77,   76,   74,   72,   71,   69,   67,   69,   66,   66,   62,   61,   51,   47,   41,   36,   19,   12,    4,    1,   -6,   -6,   -7,   -6,   -7,   -9,  -11,  -11,   -6,   -6,   -2,   -1,
+		/* e0: */    6,    9,   14,   16,   26,   27,   31,   32,   41,   44,   47,   51,   57,   61,   62,   64,   67,   67,   71,   74,   84,   87,   94,   99,  112,  114,  119,  120,  127,  127,  122,  117,
+	},
+};